@@ -28,42 +28,52 @@
 *
 * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
 
+#include <algorithm>
+#include <limits>
 #include <memory>
 
 #include "ExportMoabMesh.h"
 
 #include <QtCore/QDir>
+#include <QtCore/QFile>
 #include <QtCore/QFileInfo>
+#include <QtCore/QJsonObject>
 
 #include <QtCore/QTextStream>
 
+#include "SIMPLib/SIMPLib.h"
 #include "SIMPLib/Common/Constants.h"
 
+#include "SIMPLib/FilterParameters/BooleanFilterParameter.h"
+#include "SIMPLib/FilterParameters/ChoiceFilterParameter.h"
 #include "SIMPLib/FilterParameters/DataArraySelectionFilterParameter.h"
+#include "SIMPLib/FilterParameters/IntFilterParameter.h"
+#include "SIMPLib/FilterParameters/LinkedBooleanFilterParameter.h"
+#include "SIMPLib/FilterParameters/LinkedChoicesFilterParameter.h"
+#include "SIMPLib/FilterParameters/MultiDataArraySelectionFilterParameter.h"
+#include "SIMPLib/FilterParameters/MultiDataContainerSelectionFilterParameter.h"
 #include "SIMPLib/FilterParameters/OutputFileFilterParameter.h"
+#include "SIMPLib/FilterParameters/PreflightUpdatedValueFilterParameter.h"
 #include "SIMPLib/Utilities/FileSystemPathHelper.h"
 #include "SIMPLib/DataContainers/DataContainerArray.h"
 #include "SIMPLib/DataContainers/DataContainer.h"
+#include "SIMPLib/Geometry/RectGridGeom.h"
 
-#include "smtk/extension/vtk/io/mesh/ExportVTKData.h"
-#include "smtk/extension/vtk/io/mesh/ImportVTKData.h"
-
-#ifdef DEBUG
-#undef DEBUG
-#define DEBUG_ExportMoabMesh
-#endif
-
-#include "smtk/mesh/core/Collection.h"
-#include "smtk/mesh/core/Manager.h"
-#include "smtk/mesh/core/CellField.h"
-#include "smtk/io/WriteMesh.h"
-#include "smtk/io/ExportMesh.h"
-
-#ifdef DEBUG_ExportMoabMesh
-#define DEBUG
-#endif
-
-#include "Utilities/SIMPLVtkBridge.h"
+#include "Utilities/ElementListH5mExporter.h"
+#include "Utilities/ExodusExporter.h"
+#include "Utilities/FeatureBoundaryExporter.h"
+#include "Utilities/ImageRegion.h"
+#include "Utilities/ImageSlabMesher.h"
+#include "Utilities/MeshExporter.h"
+#include "Utilities/MeshPartitioner.h"
+#include "Utilities/MeshReorderer.h"
+#include "Utilities/MoabH5mWriter.h"
+#include "Utilities/NativeH5mExporter.h"
+#include "Utilities/OctreeCoarsener.h"
+#include "Utilities/OctreeExporter.h"
+#include "Utilities/SmtkMeshExporter.h"
+#include "Utilities/StreamingVtuExporter.h"
+#include "Utilities/StructuredBoxExporter.h"
 
 #include "vtkImageData.h"
 #include "vtkNew.h"
@@ -75,6 +85,49 @@
 #include "SMTKPlugin/SMTKPluginConstants.h"
 #include "SMTKPlugin/SMTKPluginVersion.h"
 
+namespace
+{
+// Rough rates for the time estimate of the preflight. They only give the order of magnitude;
+// the opt-in ExportCompressionBenchmark program measures the write throughput of a given machine.
+const double k_WriteBytesPerSecond = 500.0e6;
+const double k_CompressedWriteBytesPerSecond = 150.0e6;
+const double k_SmtkSecondsPerElement = 2.0e-6;
+const double k_ScanSecondsPerCell = 10.0e-9;
+const double k_SortSecondsPerEntity = 100.0e-9;
+
+/**
+ * @brief Describes the expected cost of an export
+ */
+struct ExportEstimate
+{
+  double peakBytes = 0.0; //!< Memory used on top of the Data Container
+  double fileBytes = 0.0; //!< Size of the output file before compression
+  double seconds = 0.0;   //!< Duration of the export
+};
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QString FormatSeconds(double seconds)
+{
+  if(seconds < 120.0)
+  {
+    return QString("%1 s").arg(seconds, 0, 'f', 1);
+  }
+  return QString("%1 min").arg(seconds / 60.0, 0, 'f', 1);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+template <typename Exporter, typename... Args> bool RunExporter(AbstractFilter* filter, const MeshExportSettings& settings, Args&&... args)
+{
+  Exporter exporter(filter, settings);
+  exporter.write(std::forward<Args>(args)...);
+  return exporter.getStoppedEarly();
+}
+} // namespace
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -101,6 +154,8 @@ void ExportMoabMesh::initialize()
   m_AllowedExtensions.push_back("mhdf");
   m_AllowedExtensions.push_back("vtk");
   m_AllowedExtensions.push_back("vtu");
+  m_AllowedExtensions.push_back("exo");
+  m_AllowedExtensions.push_back("e");
 
   m_ExtensionsString = m_AllowedExtensions.join(" *.");
   m_ExtensionsString.prepend("*.");
@@ -116,13 +171,121 @@ void ExportMoabMesh::setupFilterParameters()
   parameters.push_back(SIMPL_NEW_OUTPUT_FILE_FP("Output File", OutputFile, FilterParameter::Parameter, ExportMoabMesh, m_ExtensionsString, "Output"));
 
   {
-    DataArraySelectionFilterParameter::RequirementType req = DataArraySelectionFilterParameter::CreateRequirement(SIMPL::TypeNames::Double, 1, AttributeMatrix::Type::Cell, IGeometry::Type::Image);
-    parameters.push_back(SIMPL_NEW_DA_SELECTION_FP("Selected Array", SelectedArrayPath, FilterParameter::RequiredArray, ExportMoabMesh, req));
+    LinkedChoicesFilterParameter::Pointer parameter = LinkedChoicesFilterParameter::New();
+    parameter->setHumanLabel("Export Mode");
+    parameter->setPropertyName("ExportMode");
+    parameter->setSetterCallback(SIMPL_BIND_SETTER(ExportMoabMesh, this, ExportMode));
+    parameter->setGetterCallback(SIMPL_BIND_GETTER(ExportMoabMesh, this, ExportMode));
+    QVector<QString> choices;
+    choices.push_back("Explicit Hexahedra");
+    choices.push_back("Structured Box (MOAB ScdInterface)");
+    choices.push_back("Streaming Z Slabs (Bounded Memory)");
+    choices.push_back("Feature Boundary Quads");
+    choices.push_back("Coarsened Octree Hexahedra");
+    parameter->setChoices(choices);
+    QStringList linkedProps = {"MemoryBudget", "MaxOctreeLevel", "WriteHangingNodes"};
+    parameter->setLinkedProperties(linkedProps);
+    parameter->setEditable(false);
+    parameter->setCategory(FilterParameter::Parameter);
+    parameters.push_back(parameter);
+  }
+  parameters.push_back(SIMPL_NEW_INTEGER_FP("Memory Budget (MB)", MemoryBudget, FilterParameter::Parameter, ExportMoabMesh, 2));
+  parameters.push_back(SIMPL_NEW_INTEGER_FP("Maximum Octree Level", MaxOctreeLevel, FilterParameter::Parameter, ExportMoabMesh, 4));
+  parameters.push_back(SIMPL_NEW_BOOL_FP("Write Hanging Node Constraints", WriteHangingNodes, FilterParameter::Parameter, ExportMoabMesh, 4));
+
+  // Images are meshed from their grid. The other geometries are written as they are, with the
+  // values of the Attribute Matrix that holds one tuple per element.
+  IGeometry::Types exportGeometryTypes = {IGeometry::Type::Image, IGeometry::Type::RectGrid,    IGeometry::Type::Vertex,     IGeometry::Type::Edge,
+                                          IGeometry::Type::Triangle, IGeometry::Type::Quad, IGeometry::Type::Tetrahedral, IGeometry::Type::Hexahedral};
+  AttributeMatrix::Types elementMatrixTypes = {AttributeMatrix::Type::Vertex, AttributeMatrix::Type::Edge, AttributeMatrix::Type::Face, AttributeMatrix::Type::Cell};
+
+  {
+    MultiDataArraySelectionFilterParameter::RequirementType req =
+        MultiDataArraySelectionFilterParameter::CreateRequirement(SIMPL::Defaults::AnyPrimitive, SIMPL::Defaults::AnyComponentSize, AttributeMatrix::Type::Any, IGeometry::Type::Any);
+    req.dcGeometryTypes = exportGeometryTypes;
+    req.amTypes = elementMatrixTypes;
+    req.daTypes = {SIMPL::TypeNames::Int8,  SIMPL::TypeNames::UInt8,  SIMPL::TypeNames::Int16, SIMPL::TypeNames::UInt16, SIMPL::TypeNames::Int32,
+                   SIMPL::TypeNames::UInt32, SIMPL::TypeNames::Int64, SIMPL::TypeNames::UInt64, SIMPL::TypeNames::Float, SIMPL::TypeNames::Double};
+    parameters.push_back(SIMPL_NEW_MDA_SELECTION_FP("Attribute Arrays to Export", SelectedArrayPaths, FilterParameter::RequiredArray, ExportMoabMesh, req));
+  }
+
+  parameters.push_back(SIMPL_NEW_BOOL_FP("Write Feature Meshsets", WriteFeatureSets, FilterParameter::Parameter, ExportMoabMesh));
+  {
+    DataArraySelectionFilterParameter::RequirementType req = DataArraySelectionFilterParameter::CreateRequirement(SIMPL::TypeNames::Int32, 1, AttributeMatrix::Type::Any, IGeometry::Type::Any);
+    req.dcGeometryTypes = exportGeometryTypes;
+    req.amTypes = elementMatrixTypes;
+    parameters.push_back(SIMPL_NEW_DA_SELECTION_FP("Feature Ids", FeatureIdsArrayPath, FilterParameter::RequiredArray, ExportMoabMesh, req));
   }
 
+  QStringList linkedProps = {"XMin", "YMin", "ZMin", "XMax", "YMax", "ZMax"};
+  parameters.push_back(SIMPL_NEW_LINKED_BOOL_FP("Crop to Region of Interest", CropToRegion, FilterParameter::Parameter, ExportMoabMesh, linkedProps));
+  parameters.push_back(SIMPL_NEW_INTEGER_FP("X Min (Column)", XMin, FilterParameter::Parameter, ExportMoabMesh));
+  parameters.push_back(SIMPL_NEW_INTEGER_FP("Y Min (Row)", YMin, FilterParameter::Parameter, ExportMoabMesh));
+  parameters.push_back(SIMPL_NEW_INTEGER_FP("Z Min (Plane)", ZMin, FilterParameter::Parameter, ExportMoabMesh));
+  parameters.push_back(SIMPL_NEW_INTEGER_FP("X Max (Column)", XMax, FilterParameter::Parameter, ExportMoabMesh));
+  parameters.push_back(SIMPL_NEW_INTEGER_FP("Y Max (Row)", YMax, FilterParameter::Parameter, ExportMoabMesh));
+  parameters.push_back(SIMPL_NEW_INTEGER_FP("Z Max (Plane)", ZMax, FilterParameter::Parameter, ExportMoabMesh));
+
+  linkedProps = QStringList({"ChunkSize", "Shuffle", "DeflateLevel", "Hdf5FilterId"});
+  parameters.push_back(SIMPL_NEW_LINKED_BOOL_FP("Compress HDF5 Datasets", CompressOutput, FilterParameter::Parameter, ExportMoabMesh, linkedProps));
+  parameters.push_back(SIMPL_NEW_INTEGER_FP("Chunk Size (Entities)", ChunkSize, FilterParameter::Parameter, ExportMoabMesh));
+  parameters.push_back(SIMPL_NEW_BOOL_FP("Shuffle Bytes", Shuffle, FilterParameter::Parameter, ExportMoabMesh));
+  parameters.push_back(SIMPL_NEW_INTEGER_FP("Deflate Level (0-9)", DeflateLevel, FilterParameter::Parameter, ExportMoabMesh));
+  parameters.push_back(SIMPL_NEW_INTEGER_FP("Additional HDF5 Filter Id", Hdf5FilterId, FilterParameter::Parameter, ExportMoabMesh));
+
+  linkedProps = QStringList({"PartitionCount", "PartitionStrategy"});
+  parameters.push_back(SIMPL_NEW_LINKED_BOOL_FP("Write Partition Meshsets", WritePartitionSets, FilterParameter::Parameter, ExportMoabMesh, linkedProps));
+  parameters.push_back(SIMPL_NEW_INTEGER_FP("Number of Partitions", PartitionCount, FilterParameter::Parameter, ExportMoabMesh));
+  {
+    QVector<QString> choices = {"Z Slabs", "Recursive Coordinate Bisection", "Feature Preserving"};
+    parameters.push_back(SIMPL_NEW_CHOICE_FP("Partition Strategy", PartitionStrategy, FilterParameter::Parameter, ExportMoabMesh, choices, false));
+  }
+
+  {
+    QVector<QString> choices = {"Natural (X Fastest)", "Morton (Z-Order) Curve", "Hilbert Curve", "Reverse Cuthill-McKee"};
+    parameters.push_back(SIMPL_NEW_CHOICE_FP("Mesh Ordering", MeshOrdering, FilterParameter::Parameter, ExportMoabMesh, choices, false));
+  }
+
+  linkedProps = QStringList({"BatchDataContainerNames", "BatchLayout", "BatchThreadLimit"});
+  parameters.push_back(SIMPL_NEW_LINKED_BOOL_FP("Export Batch of Data Containers", ExportBatch, FilterParameter::Parameter, ExportMoabMesh, linkedProps));
+  {
+    MultiDataContainerSelectionFilterParameter::RequirementType req;
+    req.dcGeometryTypes = IGeometry::Types(1, IGeometry::Type::Image);
+    parameters.push_back(SIMPL_NEW_MDC_SELECTION_FP("Batch Data Containers", BatchDataContainerNames, FilterParameter::RequiredArray, ExportMoabMesh, req));
+  }
+  {
+    QVector<QString> choices = {"Single File with Per-Step Tags", "One File per Step"};
+    parameters.push_back(SIMPL_NEW_CHOICE_FP("Batch Layout", BatchLayout, FilterParameter::Parameter, ExportMoabMesh, choices, false));
+  }
+  parameters.push_back(SIMPL_NEW_INTEGER_FP("Batch Thread Limit (0 = All Cores)", BatchThreadLimit, FilterParameter::Parameter, ExportMoabMesh));
+
+  parameters.push_back(SIMPL_NEW_BOOL_FP("Reuse Unchanged Mesh in Output File", ReuseUnchangedMesh, FilterParameter::Parameter, ExportMoabMesh));
+
+  parameters.push_back(SIMPL_NEW_PREFLIGHTUPDATEDVALUE_FP("Estimated Export Cost", EstimatedCost, FilterParameter::Parameter, ExportMoabMesh));
+  parameters.push_back(SIMPL_NEW_INTEGER_FP("Peak Memory Limit (MB, 0 = None)", PeakMemoryLimit, FilterParameter::Parameter, ExportMoabMesh));
+
   setFilterParameters(parameters);
 }
 
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void ExportMoabMesh::readFilterParameters(QJsonObject& obj)
+{
+  AbstractFilter::readFilterParameters(obj);
+
+  // Pipelines saved before several arrays could be exported hold a single SelectedArrayPath
+  if(!obj.contains("SelectedArrayPaths") && obj.contains("SelectedArrayPath"))
+  {
+    QJsonObject pathObj = obj["SelectedArrayPath"].toObject();
+    DataArrayPath path;
+    if(path.readJson(pathObj))
+    {
+      m_SelectedArrayPaths = {path};
+    }
+  }
+}
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -130,27 +293,707 @@ void ExportMoabMesh::dataCheck()
 {
   clearErrorCode();
   clearWarningCode();
+  m_EstimatedCost.clear();
 
   QFileInfo fi(getOutputFile());
   if(fi.suffix().compare("") == 0)
   {
     setOutputFile(getOutputFile().append(".h5m"));
   }
-  FileSystemPathHelper::CheckOutputFile(this, "Output File Path", getOutputFile(), true);
-
-  std::vector<size_t> cDims = {1};
-  m_SelectedArrayPtr = getDataContainerArray()->getPrereqArrayFromPath<DoubleArrayType, AbstractFilter>(this, getSelectedArrayPath(), cDims);
-  if (getErrorCondition() < 0)
+  FileSystemPathHelper::CheckOutputFile(this, "Output File Path", getOutputFile(), true);
+
+  if(m_ExportMode < static_cast<int>(ExportModeType::ExplicitHex) || m_ExportMode > static_cast<int>(ExportModeType::CoarsenedOctree))
+  {
+    QString ss = QObject::tr("The selected export mode (%1) is not valid.").arg(m_ExportMode);
+    setErrorCondition(-101005, ss);
+    return;
+  }
+
+  bool hexMode = (m_ExportMode == static_cast<int>(ExportModeType::ExplicitHex) || m_ExportMode == static_cast<int>(ExportModeType::StreamingSlabs));
+  if(MeshExporter::IsExodusFile(getOutputFile()) && !hexMode)
+  {
+    QString ss = QObject::tr("Exodus export writes element blocks of hexahedra and supports the explicit and streaming export modes only.");
+    setErrorCondition(-101045, ss);
+    return;
+  }
+
+  if(m_ExportMode == static_cast<int>(ExportModeType::StructuredBox) && QFileInfo(getOutputFile()).completeSuffix() == "vtu")
+  {
+    QString ss = QObject::tr("Structured export is written by MOAB directly and supports the h5m, mhdf and vtk formats only.");
+    setErrorCondition(-101006, ss);
+    return;
+  }
+
+  if(m_ExportMode == static_cast<int>(ExportModeType::StreamingSlabs))
+  {
+    if(QFileInfo(getOutputFile()).completeSuffix() == "vtk")
+    {
+      QString ss = QObject::tr("Streaming export appends to the output file slab by slab and supports the h5m, mhdf, vtu and Exodus formats only.");
+      setErrorCondition(-101011, ss);
+      return;
+    }
+    if(m_MemoryBudget <= 0)
+    {
+      QString ss = QObject::tr("The memory budget must be greater than 0 MB.");
+      setErrorCondition(-101012, ss);
+      return;
+    }
+  }
+
+  if(m_MeshOrdering < static_cast<int>(MeshReorderer::Ordering::Natural) || m_MeshOrdering > static_cast<int>(MeshReorderer::Ordering::ReverseCuthillMcKee))
+  {
+    QString ss = QObject::tr("The selected mesh ordering (%1) is not valid.").arg(m_MeshOrdering);
+    setErrorCondition(-101046, ss);
+    return;
+  }
+
+  // The native writers generate the renumbered mesh; SMTK and MOAB write the cells as they are
+  if(m_MeshOrdering != static_cast<int>(MeshReorderer::Ordering::Natural))
+  {
+    QString suffix = QFileInfo(getOutputFile()).completeSuffix();
+    bool streamingVtu = (suffix == "vtu" && m_ExportMode == static_cast<int>(ExportModeType::StreamingSlabs));
+    if(!hexMode || (suffix != "h5m" && suffix != "mhdf" && !MeshExporter::IsExodusFile(getOutputFile()) && !streamingVtu))
+    {
+      QString ss = QObject::tr("Mesh ordering renumbers the explicit hexahedra written to h5m, mhdf and Exodus files and the streaming vtu files only.");
+      setErrorCondition(-101047, ss);
+      return;
+    }
+  }
+
+  if(m_CompressOutput)
+  {
+    dataCheckCompression();
+    if(getErrorCondition() < 0)
+    {
+      return;
+    }
+  }
+
+  if(m_ReuseUnchangedMesh)
+  {
+    QString suffix = QFileInfo(getOutputFile()).completeSuffix();
+    bool nativeMode = (m_ExportMode == static_cast<int>(ExportModeType::ExplicitHex) || m_ExportMode == static_cast<int>(ExportModeType::StreamingSlabs));
+    if((suffix != "h5m" && suffix != "mhdf") || !nativeMode)
+    {
+      QString ss = QObject::tr("Only h5m and mhdf files of the explicit and streaming export modes can be reused; the mesh is written in full.");
+      setWarningCondition(-101043, ss);
+    }
+  }
+
+  if(m_WritePartitionSets)
+  {
+    dataCheckPartitions();
+    if(getErrorCondition() < 0)
+    {
+      return;
+    }
+  }
+
+  if(m_ExportMode == static_cast<int>(ExportModeType::CoarsenedOctree))
+  {
+    QString suffix = QFileInfo(getOutputFile()).completeSuffix();
+    if(suffix != "h5m" && suffix != "mhdf")
+    {
+      QString ss = QObject::tr("Octree export writes its hanging node constraints in the MOAB file layout and supports the h5m and mhdf formats only.");
+      setErrorCondition(-101026, ss);
+      return;
+    }
+    if(m_MaxOctreeLevel < 1 || m_MaxOctreeLevel > 16)
+    {
+      QString ss = QObject::tr("The maximum octree level (%1) must be between 1 and 16.").arg(m_MaxOctreeLevel);
+      setErrorCondition(-101027, ss);
+      return;
+    }
+  }
+
+  m_SelectedWeakPtrVector.clear();
+
+  // The boundary surface is built from the Feature Ids alone since cell values have no place on a face
+  if(m_ExportMode == static_cast<int>(ExportModeType::FeatureBoundaries))
+  {
+    if(QFileInfo(getOutputFile()).completeSuffix() == "vtk")
+    {
+      QString ss = QObject::tr("Feature boundary export supports the h5m, mhdf and vtu formats only.");
+      setErrorCondition(-101022, ss);
+      return;
+    }
+    if(m_WriteFeatureSets)
+    {
+      QString ss = QObject::tr("Feature meshsets group volume elements and cannot be written with the feature boundary surface.");
+      setErrorCondition(-101023, ss);
+      return;
+    }
+    if(!m_SelectedArrayPaths.isEmpty())
+    {
+      QString ss = QObject::tr("The selected Attribute Arrays are not written in the feature boundary export mode.");
+      setWarningCondition(-101024, ss);
+    }
+
+    std::vector<size_t> cDims(1, 1);
+    m_FeatureIdsPtr = getDataContainerArray()->getPrereqArrayFromPath<Int32ArrayType, AbstractFilter>(this, m_FeatureIdsArrayPath, cDims);
+    ImageGeom::Pointer image = getDataContainerArray()->getPrereqGeometryFromDataContainer<ImageGeom, AbstractFilter>(this, m_FeatureIdsArrayPath.getDataContainerName());
+    if(getErrorCondition() >= 0)
+    {
+      dataCheckRegion(image);
+    }
+    return;
+  }
+
+  if(m_SelectedArrayPaths.isEmpty())
+  {
+    QString ss = QObject::tr("At least one Attribute Array must be selected.");
+    setErrorCondition(-101015, ss);
+    return;
+  }
+
+  if(!DataArrayPath::ValidateVector(m_SelectedArrayPaths))
+  {
+    QString ss = QObject::tr("All selected Attribute Arrays must belong to the same Data Container and Attribute Matrix.");
+    setErrorCondition(-101016, ss);
+    return;
+  }
+
+  for(const DataArrayPath& path : m_SelectedArrayPaths)
+  {
+    IDataArray::Pointer ptr = getDataContainerArray()->getPrereqIDataArrayFromPath<IDataArray, AbstractFilter>(this, path);
+    if(getErrorCondition() < 0)
+    {
+      return;
+    }
+
+    ExportTypeInfo typeInfo;
+    if(!MeshExporter::GetExportTypeInfo(ptr->getTypeAsString(), typeInfo))
+    {
+      QString ss = QObject::tr("The Attribute Array '%1' is of type %2, which cannot be exported.").arg(path.getDataArrayName()).arg(ptr->getTypeAsString());
+      setErrorCondition(-101017, ss);
+      return;
+    }
+    m_SelectedWeakPtrVector.push_back(ptr);
+  }
+
+  IGeometry::Pointer geom = getDataContainerArray()->getPrereqGeometryFromDataContainer<IGeometry, AbstractFilter>(this, m_SelectedArrayPaths[0].getDataContainerName());
+  if(getErrorCondition() < 0)
+  {
+    return;
+  }
+
+  // Only an ImageGeom is meshed from its grid; the other geometries are written as they are
+  ImageGeom::Pointer image = std::dynamic_pointer_cast<ImageGeom>(geom);
+  if(image)
+  {
+    dataCheckRegion(image);
+  }
+  else
+  {
+    dataCheckGeometry(geom);
+  }
+
+  m_BatchWeakPtrVectors.clear();
+  if(m_ExportBatch && getErrorCondition() >= 0)
+  {
+    dataCheckBatch(image);
+  }
+
+  // The octree is coarsened wherever the Feature Ids are uniform, and the feature preserving
+  // partitions follow the Feature Ids
+  bool coarsening = (m_ExportMode == static_cast<int>(ExportModeType::CoarsenedOctree));
+  bool featurePartitions = (m_WritePartitionSets && m_PartitionStrategy == static_cast<int>(MeshPartitioner::Strategy::FeaturePreserving));
+  if(getErrorCondition() < 0 || (!m_WriteFeatureSets && !coarsening && !featurePartitions))
+  {
+    return;
+  }
+
+  QString suffix = QFileInfo(getOutputFile()).completeSuffix();
+  if(m_WriteFeatureSets && suffix != "h5m" && suffix != "mhdf" && !MeshExporter::IsExodusFile(getOutputFile()))
+  {
+    QString ss = QObject::tr("Feature meshsets can only be written to h5m and mhdf files, or as element blocks to Exodus files.");
+    setErrorCondition(-101018, ss);
+    return;
+  }
+
+  // Each Feature Id labels the cell with the same index, so it must share the Attribute Matrix of the exported arrays
+  if(!m_FeatureIdsArrayPath.hasSameAttributeMatrixPath(m_SelectedArrayPaths[0]))
+  {
+    QString ss = QObject::tr("The Feature Ids must belong to the same Data Container and Attribute Matrix as the selected Attribute Arrays.");
+    setErrorCondition(-101019, ss);
+    return;
+  }
+
+  std::vector<size_t> cDims(1, 1);
+  m_FeatureIdsPtr = getDataContainerArray()->getPrereqArrayFromPath<Int32ArrayType, AbstractFilter>(this, m_FeatureIdsArrayPath, cDims);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void ExportMoabMesh::dataCheckCompression()
+{
+  if(m_ChunkSize <= 0)
+  {
+    QString ss = QObject::tr("The chunk size (%1) must be greater than 0.").arg(m_ChunkSize);
+    setErrorCondition(-101028, ss);
+    return;
+  }
+  if(m_DeflateLevel < 0 || m_DeflateLevel > 9)
+  {
+    QString ss = QObject::tr("The deflate level (%1) must be between 0 and 9.").arg(m_DeflateLevel);
+    setErrorCondition(-101029, ss);
+    return;
+  }
+  if(m_Hdf5FilterId != 0 && !MoabH5mWriter::IsFilterAvailable(m_Hdf5FilterId))
+  {
+    QString ss = QObject::tr("The HDF5 filter with id %1 is not available for writing in this HDF5 library. Check that its plugin is on HDF5_PLUGIN_PATH.").arg(m_Hdf5FilterId);
+    setErrorCondition(-101030, ss);
+    return;
+  }
+
+  // Only the native writer controls how datasets are stored; MOAB and SMTK write them contiguous
+  QString suffix = QFileInfo(getOutputFile()).completeSuffix();
+  if((suffix != "h5m" && suffix != "mhdf") || m_ExportMode == static_cast<int>(ExportModeType::StructuredBox))
+  {
+    QString ss = QObject::tr("Compression only applies to h5m and mhdf files written by the native writer and is ignored for this output.");
+    setWarningCondition(-101031, ss);
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void ExportMoabMesh::dataCheckPartitions()
+{
+  if(m_PartitionCount < 1)
+  {
+    QString ss = QObject::tr("The number of partitions (%1) must be at least 1.").arg(m_PartitionCount);
+    setErrorCondition(-101032, ss);
+    return;
+  }
+  if(m_PartitionStrategy < static_cast<int>(MeshPartitioner::Strategy::Slabs) || m_PartitionStrategy > static_cast<int>(MeshPartitioner::Strategy::FeaturePreserving))
+  {
+    QString ss = QObject::tr("The selected partition strategy (%1) is not valid.").arg(m_PartitionStrategy);
+    setErrorCondition(-101033, ss);
+    return;
+  }
+
+  // The partition sets are written with the native writer, which knows the element ids
+  QString suffix = QFileInfo(getOutputFile()).completeSuffix();
+  bool volumeMode = (m_ExportMode == static_cast<int>(ExportModeType::ExplicitHex) || m_ExportMode == static_cast<int>(ExportModeType::StreamingSlabs) ||
+                     m_ExportMode == static_cast<int>(ExportModeType::CoarsenedOctree));
+  if((suffix != "h5m" && suffix != "mhdf") || !volumeMode)
+  {
+    QString ss = QObject::tr("Partition meshsets can only be written to h5m and mhdf files in the explicit, streaming and octree export modes.");
+    setErrorCondition(-101034, ss);
+    return;
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void ExportMoabMesh::dataCheckBatch(const ImageGeom::Pointer& image)
+{
+  if(m_BatchDataContainerNames.isEmpty())
+  {
+    QString ss = QObject::tr("At least one Data Container must be selected for the batch export.");
+    setErrorCondition(-101036, ss);
+    return;
+  }
+  if(m_BatchLayout < static_cast<int>(BatchLayoutType::SingleFile) || m_BatchLayout > static_cast<int>(BatchLayoutType::FilePerStep))
+  {
+    QString ss = QObject::tr("The selected batch layout (%1) is not valid.").arg(m_BatchLayout);
+    setErrorCondition(-101037, ss);
+    return;
+  }
+  if(m_BatchThreadLimit < 0)
+  {
+    QString ss = QObject::tr("The batch thread limit (%1) must be 0 or greater.").arg(m_BatchThreadLimit);
+    setErrorCondition(-101038, ss);
+    return;
+  }
+
+  // The steps share one topology, which only the native writer can write once for all of them
+  QString suffix = QFileInfo(getOutputFile()).completeSuffix();
+  bool nativeMode = (m_ExportMode == static_cast<int>(ExportModeType::ExplicitHex) || m_ExportMode == static_cast<int>(ExportModeType::StreamingSlabs));
+  if((suffix != "h5m" && suffix != "mhdf") || !nativeMode)
+  {
+    QString ss = QObject::tr("Batch export writes h5m and mhdf files in the explicit and streaming export modes only.");
+    setErrorCondition(-101039, ss);
+    return;
+  }
+
+  // The Feature Ids belong to one Data Container, so their sets would be wrong for the other steps
+  if(m_WriteFeatureSets || (m_WritePartitionSets && m_PartitionStrategy == static_cast<int>(MeshPartitioner::Strategy::FeaturePreserving)))
+  {
+    QString ss = QObject::tr("Feature meshsets and feature preserving partitions cannot be written in a batch export, whose steps may hold different Features.");
+    setErrorCondition(-101040, ss);
+    return;
+  }
+
+  size_t dims[3] = {0, 0, 0};
+  float res[3] = {0.0f, 0.0f, 0.0f};
+  float origin[3] = {0.0f, 0.0f, 0.0f};
+  std::tie(dims[0], dims[1], dims[2]) = image->getDimensions();
+  image->getResolution(res);
+  image->getOrigin(origin);
+
+  for(const QString& dcName : m_BatchDataContainerNames)
+  {
+    ImageGeom::Pointer stepImage = getDataContainerArray()->getPrereqGeometryFromDataContainer<ImageGeom, AbstractFilter>(this, dcName);
+    if(getErrorCondition() < 0)
+    {
+      return;
+    }
+
+    size_t stepDims[3] = {0, 0, 0};
+    float stepRes[3] = {0.0f, 0.0f, 0.0f};
+    float stepOrigin[3] = {0.0f, 0.0f, 0.0f};
+    std::tie(stepDims[0], stepDims[1], stepDims[2]) = stepImage->getDimensions();
+    stepImage->getResolution(stepRes);
+    stepImage->getOrigin(stepOrigin);
+    if(!std::equal(dims, dims + 3, stepDims) || !std::equal(res, res + 3, stepRes) || !std::equal(origin, origin + 3, stepOrigin))
+    {
+      QString ss = QObject::tr("The Image Geometry of the Data Container '%1' does not match the dimensions, resolution and origin of '%2'.")
+                       .arg(dcName)
+                       .arg(m_SelectedArrayPaths[0].getDataContainerName());
+      setErrorCondition(-101041, ss);
+      return;
+    }
+
+    // Each step holds the selected arrays under the same Attribute Matrix and names
+    QVector<IDataArray::WeakPointer> stepArrays;
+    for(int i = 0; i < m_SelectedArrayPaths.size(); i++)
+    {
+      DataArrayPath path(dcName, m_SelectedArrayPaths[i].getAttributeMatrixName(), m_SelectedArrayPaths[i].getDataArrayName());
+      IDataArray::Pointer ptr = getDataContainerArray()->getPrereqIDataArrayFromPath<IDataArray, AbstractFilter>(this, path);
+      if(getErrorCondition() < 0)
+      {
+        return;
+      }
+
+      IDataArray::Pointer selectedArray = m_SelectedWeakPtrVector[i].lock();
+      if(ptr->getTypeAsString() != selectedArray->getTypeAsString() || ptr->getNumberOfComponents() != selectedArray->getNumberOfComponents())
+      {
+        QString ss = QObject::tr("The Attribute Array '%1' of the Data Container '%2' does not have the type and component count of the selected array.").arg(path.getDataArrayName()).arg(dcName);
+        setErrorCondition(-101042, ss);
+        return;
+      }
+      stepArrays.push_back(ptr);
+    }
+    m_BatchWeakPtrVectors.push_back(stepArrays);
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+MeshExportSettings ExportMoabMesh::getExportSettings() const
+{
+  MeshExportSettings settings;
+  settings.outputFile = m_OutputFile;
+  settings.selectedArrayPaths = m_SelectedArrayPaths;
+  settings.selectedWeakPtrVector = m_SelectedWeakPtrVector;
+  settings.batchWeakPtrVectors = m_BatchWeakPtrVectors;
+  settings.batchDataContainerNames = m_BatchDataContainerNames;
+  settings.exportBatch = m_ExportBatch;
+  settings.filePerStep = (m_ExportBatch && m_BatchLayout == static_cast<int>(BatchLayoutType::FilePerStep));
+  settings.batchThreadLimit = m_BatchThreadLimit;
+  settings.reuseUnchangedMesh = m_ReuseUnchangedMesh;
+  settings.featureIdsArrayPath = m_FeatureIdsArrayPath;
+  settings.featureIdsPtr = m_FeatureIdsPtr;
+  settings.writeFeatureSets = m_WriteFeatureSets;
+  settings.writePartitionSets = m_WritePartitionSets;
+  settings.partitionCount = m_PartitionCount;
+  settings.partitionStrategy = m_PartitionStrategy;
+  settings.meshOrdering = m_MeshOrdering;
+  settings.memoryBudget = m_MemoryBudget;
+  settings.compressOutput = m_CompressOutput;
+  settings.chunkSize = m_ChunkSize;
+  settings.shuffle = m_Shuffle;
+  settings.deflateLevel = m_DeflateLevel;
+  settings.hdf5FilterId = m_Hdf5FilterId;
+  settings.cropToRegion = m_CropToRegion;
+  settings.xMin = m_XMin;
+  settings.yMin = m_YMin;
+  settings.zMin = m_ZMin;
+  settings.xMax = m_XMax;
+  settings.yMax = m_YMax;
+  settings.zMax = m_ZMax;
+  settings.maxOctreeLevel = m_MaxOctreeLevel;
+  settings.writeHangingNodes = m_WriteHangingNodes;
+  return settings;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void ExportMoabMesh::dataCheckEstimate()
+{
+  bool boundaries = (m_ExportMode == static_cast<int>(ExportModeType::FeatureBoundaries));
+  QString dcName = boundaries ? m_FeatureIdsArrayPath.getDataContainerName() : m_SelectedArrayPaths[0].getDataContainerName();
+  IGeometry::Pointer geom = getDataContainerArray()->getPrereqGeometryFromDataContainer<IGeometry, AbstractFilter>(this, dcName);
+  if(getErrorCondition() < 0)
+  {
+    return;
+  }
+
+  // The grid below only describes an ImageGeom; the other geometries count their own entities
+  ImageGeom::Pointer image = std::dynamic_pointer_cast<ImageGeom>(geom);
+  size_t dims[3] = {0, 0, 0};
+  float res[3] = {0.0f, 0.0f, 0.0f};
+  float origin[3] = {0.0f, 0.0f, 0.0f};
+  ImageRegion region = image ? MeshExporter::GetRegion(getExportSettings(), image, dims, res, origin) : ImageRegion(dims);
+  ImageSlabMesher mesher(dims, res, origin);
+  double numElements = static_cast<double>(mesher.getNumberOfElements());
+  double numNodes = static_cast<double>(mesher.getNumberOfNodes());
+  double nodesPerElement = 8.0;
+  double numRows = static_cast<double>(dims[1] * dims[2]);
+
+  // An element list is counted from its shared lists, and its sets may need one run per element
+  GeometryElements elements;
+  bool elementList = !image && MeshExporter::GetGeometryElements(geom, elements);
+  if(elementList)
+  {
+    numNodes = static_cast<double>(elements.vertices->getNumberOfTuples());
+    numElements = elements.elements ? static_cast<double>(elements.elements->getNumberOfTuples()) : numNodes;
+    nodesPerElement = static_cast<double>(elements.nodesPerElement);
+    numRows = numElements;
+  }
+  else if(RectGridGeom::Pointer rectGrid = std::dynamic_pointer_cast<RectGridGeom>(geom))
+  {
+    size_t gridDims[3] = {0, 0, 0};
+    std::tie(gridDims[0], gridDims[1], gridDims[2]) = rectGrid->getDimensions();
+    numElements = static_cast<double>(gridDims[0] * gridDims[1] * gridDims[2]);
+    numNodes = static_cast<double>((gridDims[0] + 1) * (gridDims[1] + 1) * (gridDims[2] + 1));
+  }
+
+  // Bytes of tag values per element over every selected array and batch step
+  double tagBytes = 0.0;
+  for(const IDataArray::WeakPointer& weakPtr : m_SelectedWeakPtrVector)
+  {
+    IDataArray::Pointer selectedArray = weakPtr.lock();
+    ExportTypeInfo typeInfo;
+    MeshExporter::GetExportTypeInfo(selectedArray->getTypeAsString(), typeInfo);
+    tagBytes += static_cast<double>(typeInfo.size * static_cast<size_t>(selectedArray->getNumberOfComponents()));
+  }
+  if(m_ExportBatch)
+  {
+    tagBytes *= m_BatchWeakPtrVectors.size();
+  }
+
+  // Feature Ids are copied out of a cropped region, and each group of sets holds the element
+  // order of its labels. The sets store about one run of elements per row of cells.
+  bool octree = (m_ExportMode == static_cast<int>(ExportModeType::CoarsenedOctree));
+  bool featurePartitions = (m_WritePartitionSets && m_PartitionStrategy == static_cast<int>(MeshPartitioner::Strategy::FeaturePreserving));
+  bool usesFeatureIds = (m_WriteFeatureSets || featurePartitions || boundaries || octree);
+  double gatherBytes = (usesFeatureIds && !region.isLayerContiguous()) ? sizeof(int32_t) * numElements : 0.0;
+  double numSetGroups = (m_WriteFeatureSets ? 1.0 : 0.0) + (m_WritePartitionSets ? 1.0 : 0.0);
+  double setBytes = numSetGroups * sizeof(size_t) * numElements + (m_WritePartitionSets ? sizeof(int32_t) * numElements : 0.0);
+  double setFileBytes = numSetGroups * 2.0 * sizeof(int64_t) * numRows;
+
+  double meshFileBytes = 3.0 * sizeof(double) * numNodes + nodesPerElement * sizeof(int64_t) * numElements + tagBytes * numElements + setFileBytes;
+  double writeRate = m_CompressOutput ? k_CompressedWriteBytesPerSecond : k_WriteBytesPerSecond;
+  QString suffix = QFileInfo(getOutputFile()).completeSuffix();
+  bool native = (suffix == "h5m" || suffix == "mhdf");
+  bool exodus = MeshExporter::IsExodusFile(getOutputFile());
+
+  ExportEstimate estimate;
+  bool worstCase = false;
+  if(boundaries)
+  {
+    // Any face between two cells may separate Features, so the estimate is the worst case
+    double numQuads = 3.0 * numElements + static_cast<double>(dims[0] * dims[1] + dims[1] * dims[2] + dims[2] * dims[0]);
+    double quadBytes = 4.0 * sizeof(int64_t) + 2.0 * sizeof(int32_t) + (native ? 0.0 : sizeof(int64_t) + 1.0);
+    estimate.fileBytes = 3.0 * sizeof(double) * numNodes + quadBytes * numQuads;
+    estimate.peakBytes = gatherBytes + estimate.fileBytes + sizeof(int64_t) * numNodes;
+    estimate.seconds = k_ScanSecondsPerCell * numElements + estimate.fileBytes / writeRate;
+    worstCase = true;
+  }
+  else if(octree)
+  {
+    // A volume where no block can be merged keeps one leaf per cell
+    estimate.fileBytes = meshFileBytes;
+    estimate.peakBytes = gatherBytes + setBytes + (sizeof(OctreeCoarsener::Leaf) + sizeof(int32_t) + 8.0 * sizeof(int64_t) + tagBytes) * numElements +
+                         (3.0 * sizeof(double) + sizeof(int64_t)) * numNodes;
+    estimate.seconds = k_ScanSecondsPerCell * numElements + estimate.fileBytes / writeRate;
+    worstCase = true;
+  }
+  else if(m_ExportMode == static_cast<int>(ExportModeType::StructuredBox))
+  {
+    // MOAB holds the coordinates and a copy of every tag, and streams the connectivity out
+    estimate.fileBytes = meshFileBytes;
+    estimate.peakBytes = gatherBytes + setBytes + 3.0 * sizeof(double) * numNodes + tagBytes * numElements;
+    estimate.seconds = estimate.fileBytes / k_WriteBytesPerSecond;
+  }
+  else if(elementList && native)
+  {
+    // The shared lists are converted block by block on their way to the writer thread. The
+    // partitions are computed from the element centers.
+    double blockBytes = std::min(static_cast<double>(MeshExporter::DefaultBlockBytes), std::max(3.0 * sizeof(double) * numNodes, nodesPerElement * sizeof(int64_t) * numElements));
+    double centerBytes = m_WritePartitionSets ? 3.0 * sizeof(float) * numElements : 0.0;
+    estimate.fileBytes = meshFileBytes;
+    estimate.peakBytes = setBytes + centerBytes + (MeshExporter::WriteQueueDepth + 1) * blockBytes;
+    estimate.seconds = estimate.fileBytes / writeRate;
+  }
+  else if(image && (native || exodus || m_ExportMode == static_cast<int>(ExportModeType::StreamingSlabs)))
+  {
+    // The native writers only hold the blocks in flight through the writer thread. The Exodus
+    // writer also splits each block of coordinates into X, Y and Z.
+    bool streaming = (m_ExportMode == static_cast<int>(ExportModeType::StreamingSlabs));
+    double orderBytes = 0.0;
+    double orderSeconds = 0.0;
+    size_t blockBudget = streaming ? static_cast<size_t>(m_MemoryBudget) * 1024 * 1024 / (MeshExporter::WriteQueueDepth + 1) : MeshExporter::DefaultBlockBytes;
+    size_t layers = std::max<size_t>(mesher.getLayersPerSlab(blockBudget), 1);
+    double blockBytes = std::max(mesher.getNodeBufferSize(layers) * sizeof(double), mesher.getConnectivityBufferSize(layers) * sizeof(int64_t));
+    if(!region.isLayerContiguous())
+    {
+      blockBytes = std::max(blockBytes, layers * mesher.getElementsPerLayer() * tagBytes);
+    }
+    if(m_MeshOrdering != static_cast<int>(MeshReorderer::Ordering::Natural))
+    {
+      // The orders stay for the whole export and the sort keys while they are computed. Sets
+      // and Exodus blocks also hold their labels and cells in the new order.
+      orderBytes = sizeof(size_t) * numElements + (sizeof(size_t) + sizeof(int64_t)) * numNodes + 2.0 * sizeof(uint64_t) * std::max(numElements, numNodes);
+      orderBytes += (numSetGroups > 0.0 ? sizeof(int32_t) * numElements : 0.0) + ((exodus && m_WriteFeatureSets) ? sizeof(size_t) * numElements : 0.0);
+      orderSeconds = k_SortSecondsPerEntity * (numElements + numNodes);
+      blockBytes = std::max(blockBytes, layers * mesher.getElementsPerLayer() * tagBytes);
+    }
+    estimate.fileBytes = (native || exodus) ? meshFileBytes : meshFileBytes + (sizeof(int64_t) + 1.0) * numElements;
+    estimate.peakBytes = gatherBytes + setBytes + orderBytes + (MeshExporter::WriteQueueDepth + (exodus ? 2 : 1)) * blockBytes;
+    estimate.seconds = orderSeconds + estimate.fileBytes / writeRate;
+  }
+  else
+  {
+    // SMTK imports the whole mesh into MOAB and the VTK writers build another copy of it
+    double meshBytes = 3.0 * sizeof(double) * numNodes + (nodesPerElement + 2.0) * sizeof(int64_t) * numElements + tagBytes * numElements;
+    estimate.fileBytes = meshFileBytes + (sizeof(int64_t) + 1.0) * numElements;
+    estimate.peakBytes = (m_CropToRegion ? tagBytes * numElements : 0.0) + 2.0 * meshBytes;
+    estimate.seconds = k_SmtkSecondsPerElement * numElements + estimate.fileBytes / k_WriteBytesPerSecond;
+  }
+
+  // The rates are nominal rather than measured on this machine, so the time is labelled as such
+  m_EstimatedCost = QObject::tr("%1Peak memory %2, output file %3, time %4 (order of magnitude at nominal write rates)")
+                        .arg(worstCase ? QObject::tr("At most: ") : QString())
+                        .arg(MeshExporter::FormatBytes(estimate.peakBytes))
+                        .arg(MeshExporter::FormatBytes(estimate.fileBytes))
+                        .arg(FormatSeconds(estimate.seconds));
+
+  if(m_PeakMemoryLimit > 0 && estimate.peakBytes > m_PeakMemoryLimit * 1024.0 * 1024.0)
+  {
+    QString ss = QObject::tr("The export is estimated to need %1 of memory, which exceeds the peak memory limit of %2 MB. Use the streaming mode, a region of interest or a higher limit.")
+                     .arg(MeshExporter::FormatBytes(estimate.peakBytes))
+                     .arg(m_PeakMemoryLimit);
+    setErrorCondition(-101044, ss);
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void ExportMoabMesh::dataCheckRegion(const ImageGeom::Pointer& image)
+{
+  size_t dims[3] = {0, 0, 0};
+  std::tie(dims[0], dims[1], dims[2]) = image->getDimensions();
+  if(m_CropToRegion)
+  {
+    const int minIndex[3] = {m_XMin, m_YMin, m_ZMin};
+    const int maxIndex[3] = {m_XMax, m_YMax, m_ZMax};
+    const char axes[3] = {'X', 'Y', 'Z'};
+    for(size_t i = 0; i < 3; i++)
+    {
+      if(minIndex[i] < 0 || minIndex[i] > maxIndex[i] || static_cast<size_t>(maxIndex[i]) >= dims[i])
+      {
+        QString ss = QObject::tr("The %1 bounds of the region of interest (%2 to %3) must satisfy 0 <= Min <= Max < %4.").arg(axes[i]).arg(minIndex[i]).arg(maxIndex[i]).arg(dims[i]);
+        setErrorCondition(-101025, ss);
+        return;
+      }
+      dims[i] = static_cast<size_t>(maxIndex[i] - minIndex[i] + 1);
+    }
+  }
+
+  if(m_ExportMode != static_cast<int>(ExportModeType::StructuredBox))
+  {
+    return;
+  }
+
+  // MOAB addresses the box and counts its vertices with int, so larger boxes would be truncated
+  const size_t intMax = static_cast<size_t>(std::numeric_limits<int>::max());
+  size_t numVertices = 1;
+  bool fits = true;
+  for(size_t i = 0; i < 3 && fits; i++)
+  {
+    fits = (dims[i] < intMax && numVertices <= intMax / (dims[i] + 1));
+    numVertices *= (dims[i] + 1);
+  }
+  if(!fits)
+  {
+    QString ss = QObject::tr("The structured box of %1 x %2 x %3 cells has more vertices along an axis or in total than MOAB can index (%4). Crop the region or use the explicit or streaming export mode.")
+                     .arg(dims[0])
+                     .arg(dims[1])
+                     .arg(dims[2])
+                     .arg(intMax);
+    setErrorCondition(-101054, ss);
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void ExportMoabMesh::dataCheckGeometry(const IGeometry::Pointer& geom)
+{
+  QString geomType = geom->getGeometryTypeAsString();
+  if(m_ExportMode != static_cast<int>(ExportModeType::ExplicitHex) || MeshExporter::IsExodusFile(getOutputFile()))
+  {
+    QString ss = QObject::tr("A %1 geometry is written with its own elements in the explicit export mode to h5m, mhdf, vtk and vtu files only; the other export modes and Exodus files need an Image geometry.").arg(geomType);
+    setErrorCondition(-101048, ss);
+    return;
+  }
+
+  // The region, the batch steps and the orderings all index the cells of a grid
+  if(m_CropToRegion || m_ExportBatch || m_MeshOrdering != static_cast<int>(MeshReorderer::Ordering::Natural))
+  {
+    QString ss = QObject::tr("Cropping to a region of interest, batch export and mesh ordering need an Image geometry.");
+    setErrorCondition(-101049, ss);
+    return;
+  }
+
+  // The meshsets list the element ids of the native writer, which only knows the geometries
+  // with an element list. A rectilinear grid goes through SMTK.
+  GeometryElements elements;
+  bool elementList = MeshExporter::GetGeometryElements(geom, elements);
+  if(!elementList && (m_WriteFeatureSets || m_WritePartitionSets))
+  {
+    QString ss = QObject::tr("Feature and partition meshsets cannot be written for a %1 geometry.").arg(geomType);
+    setErrorCondition(-101050, ss);
+    return;
+  }
+
+  AttributeMatrix::Type matrixType = elementList ? elements.matrixType : AttributeMatrix::Type::Cell;
+  AttributeMatrix::Pointer attrMat = getDataContainerArray()->getPrereqAttributeMatrixFromPath<AbstractFilter>(this, m_SelectedArrayPaths[0], -101051);
+  if(getErrorCondition() < 0)
+  {
+    return;
+  }
+  if(attrMat->getType() != matrixType)
+  {
+    QString ss = QObject::tr("The selected Attribute Arrays must belong to the Attribute Matrix that holds one tuple per element of the %1 geometry.").arg(geomType);
+    setErrorCondition(-101051, ss);
+    return;
+  }
+  if(attrMat->getNumberOfTuples() != geom->getNumberOfElements())
   {
+    QString ss = QObject::tr("The Attribute Matrix '%1' holds %2 tuples, but the %3 geometry has %4 elements.")
+                     .arg(attrMat->getName())
+                     .arg(attrMat->getNumberOfTuples())
+                     .arg(geomType)
+                     .arg(geom->getNumberOfElements());
+    setErrorCondition(-101053, ss);
     return;
   }
 
-  if(nullptr != m_SelectedArrayPtr.lock()) /* Validate the Weak Pointer wraps a non-nullptr pointer to a DataArray<T> object */
+  if(m_ReuseUnchangedMesh)
   {
-    m_SelectedArray = m_SelectedArrayPtr.lock()->getPointer(0);
-  } /* Now assign the raw pointer to data from the DataArray<T> object */
-
-
+    QString ss = QObject::tr("Only the meshes of Image geometries are reused; the %1 geometry is written in full.").arg(geomType);
+    setWarningCondition(-101052, ss);
+  }
 }
 
 // -----------------------------------------------------------------------------
@@ -163,6 +1006,10 @@ void ExportMoabMesh::preflight()
   emit preflightAboutToExecute(); // Emit this signal so that other widgets can do one file update
   emit updateFilterParameters(this); // Emit this signal to have the widgets push their values down to the filter
   dataCheck(); // Run our DataCheck to make sure everthing is setup correctly
+  if(getErrorCondition() >= 0)
+  {
+    dataCheckEstimate();
+  }
   emit preflightExecuted(); // We are done preflighting this filter
   setInPreflight(false); // Inform the system this filter is NOT in preflight mode anymore.
 }
@@ -176,6 +1023,13 @@ void ExportMoabMesh::execute()
   dataCheck();
   if(getErrorCondition() < 0) { return; }
 
+  dataCheckEstimate();
+  if(getErrorCondition() < 0)
+  {
+    return;
+  }
+  notifyStatusMessage(m_EstimatedCost);
+
   // Make sure any directory path is also available as the user may have just typed
   // in a path without actually creating the full path
   QFileInfo fi(getOutputFile());
@@ -189,53 +1043,71 @@ void ExportMoabMesh::execute()
     return;
   }
 
-  DataContainer::Pointer dc = getDataContainerArray()->getDataContainer(getSelectedArrayPath());
-
-  VTK_PTR(vtkDataSet) imageDataPtr = SIMPLVtkBridge::WrapDataContainerAsVtkDataset(dc);
-  vtkDataSet* dataSet = imageDataPtr.Get();
+  bool boundaries = (m_ExportMode == static_cast<int>(ExportModeType::FeatureBoundaries));
+  DataContainer::Pointer dc = getDataContainerArray()->getDataContainer(boundaries ? m_FeatureIdsArrayPath : m_SelectedArrayPaths[0]);
 
-  if (!dataSet)
+  // Each export mode and format has its own exporter in Utilities; the filter only picks it
+  MeshExportSettings settings = getExportSettings();
+  ImageGeom::Pointer image = dc->getGeometryAs<ImageGeom>();
+  bool stoppedEarly = false;
+  GeometryElements elements;
+  if(boundaries)
   {
-    QString ss = QObject::tr("Could not encapsulate the selected data array inside a VTK dataset.");
-    setErrorCondition(-20002, ss);
-    return;
+    stoppedEarly = RunExporter<FeatureBoundaryExporter>(this, settings, image);
   }
-
-  // Construct a mesh manager.
-  smtk::mesh::ManagerPtr manager = smtk::mesh::Manager::create();
-
-  // Import the vtkImageData into smtk::mesh.
-  smtk::extension::vtk::io::mesh::ImportVTKData imprt;
-  smtk::mesh::CollectionPtr collection = imprt(dataSet, manager, getSelectedArrayPath().getDataArrayName().toStdString());
-
-  if (!collection)
+  else if(!image)
   {
-    QString ss = QObject::tr("Unable to import the selected data array into an SMTK collection.");
-    setErrorCondition(-101003, ss);
-    return;
+    if((fi.completeSuffix() == "h5m" || fi.completeSuffix() == "mhdf") && MeshExporter::GetGeometryElements(dc->getGeometry(), elements))
+    {
+      stoppedEarly = RunExporter<ElementListH5mExporter>(this, settings, dc->getGeometry());
+    }
+    else
+    {
+      stoppedEarly = RunExporter<SmtkMeshExporter>(this, settings, dc);
+    }
   }
-
-  bool didWrite = false;
-  QFileInfo outFi(m_OutputFile);
-  if (outFi.completeSuffix() == "vtk" || outFi.completeSuffix() == "vtu")
+  else if(m_ExportMode == static_cast<int>(ExportModeType::StructuredBox))
+  {
+    stoppedEarly = RunExporter<StructuredBoxExporter>(this, settings, image);
+  }
+  else if(m_ExportMode == static_cast<int>(ExportModeType::CoarsenedOctree))
+  {
+    stoppedEarly = RunExporter<OctreeExporter>(this, settings, image);
+  }
+  else if(MeshExporter::IsExodusFile(m_OutputFile))
+  {
+    stoppedEarly = RunExporter<ExodusExporter>(this, settings, image, m_ExportMode == static_cast<int>(ExportModeType::StreamingSlabs));
+  }
+  else if(m_ExportMode == static_cast<int>(ExportModeType::StreamingSlabs))
   {
-    smtk::io::ExportMesh exporter;
-    smtk::model::ManagerPtr manager = smtk::model::Manager::create();
-    didWrite = exporter(m_OutputFile.toStdString(), collection);
+    if(fi.completeSuffix() == "vtu")
+    {
+      stoppedEarly = RunExporter<StreamingVtuExporter>(this, settings, image);
+    }
+    else
+    {
+      stoppedEarly = RunExporter<NativeH5mExporter>(this, settings, image, true);
+    }
+  }
+  else if(fi.completeSuffix() == "h5m" || fi.completeSuffix() == "mhdf")
+  {
+    stoppedEarly = RunExporter<NativeH5mExporter>(this, settings, image, false);
   }
   else
   {
-    smtk::io::WriteMesh writer;
-    didWrite = writer(m_OutputFile.toStdString(), collection);
+    stoppedEarly = RunExporter<SmtkMeshExporter>(this, settings, dc);
   }
 
-  if (didWrite == false)
+  // The writers stop between chunks once the export is cancelled and close their files. Only
+  // the files of a writer that stopped part way are removed; a finished file, or a reused one
+  // that was not touched yet, is kept.
+  if(stoppedEarly)
   {
-    QString ss = QObject::tr("Unable to write MOAB mesh to the specified file.");
-    setErrorCondition(-101004, ss);
-    return;
+    for(const QString& outputFile : MeshExporter::GetOutputFiles(settings))
+    {
+      QFile::remove(outputFile);
+    }
   }
-
 }
 
 // -----------------------------------------------------------------------------
@@ -340,15 +1212,15 @@ QString ExportMoabMesh::ClassName()
 }
 
 // -----------------------------------------------------------------------------
-void ExportMoabMesh::setSelectedArrayPath(const DataArrayPath& value)
+void ExportMoabMesh::setSelectedArrayPaths(const QVector<DataArrayPath>& value)
 {
-  m_SelectedArrayPath = value;
+  m_SelectedArrayPaths = value;
 }
 
 // -----------------------------------------------------------------------------
-DataArrayPath ExportMoabMesh::getSelectedArrayPath() const
+QVector<DataArrayPath> ExportMoabMesh::getSelectedArrayPaths() const
 {
-  return m_SelectedArrayPath;
+  return m_SelectedArrayPaths;
 }
 
 // -----------------------------------------------------------------------------
@@ -362,3 +1234,345 @@ QString ExportMoabMesh::getOutputFile() const
 {
   return m_OutputFile;
 }
+
+// -----------------------------------------------------------------------------
+void ExportMoabMesh::setExportMode(int value)
+{
+  m_ExportMode = value;
+}
+
+// -----------------------------------------------------------------------------
+int ExportMoabMesh::getExportMode() const
+{
+  return m_ExportMode;
+}
+
+// -----------------------------------------------------------------------------
+void ExportMoabMesh::setMemoryBudget(int value)
+{
+  m_MemoryBudget = value;
+}
+
+// -----------------------------------------------------------------------------
+int ExportMoabMesh::getMemoryBudget() const
+{
+  return m_MemoryBudget;
+}
+
+// -----------------------------------------------------------------------------
+void ExportMoabMesh::setWriteFeatureSets(bool value)
+{
+  m_WriteFeatureSets = value;
+}
+
+// -----------------------------------------------------------------------------
+bool ExportMoabMesh::getWriteFeatureSets() const
+{
+  return m_WriteFeatureSets;
+}
+
+// -----------------------------------------------------------------------------
+void ExportMoabMesh::setFeatureIdsArrayPath(const DataArrayPath& value)
+{
+  m_FeatureIdsArrayPath = value;
+}
+
+// -----------------------------------------------------------------------------
+DataArrayPath ExportMoabMesh::getFeatureIdsArrayPath() const
+{
+  return m_FeatureIdsArrayPath;
+}
+
+// -----------------------------------------------------------------------------
+void ExportMoabMesh::setCropToRegion(bool value)
+{
+  m_CropToRegion = value;
+}
+
+// -----------------------------------------------------------------------------
+bool ExportMoabMesh::getCropToRegion() const
+{
+  return m_CropToRegion;
+}
+
+// -----------------------------------------------------------------------------
+void ExportMoabMesh::setXMin(int value)
+{
+  m_XMin = value;
+}
+
+// -----------------------------------------------------------------------------
+int ExportMoabMesh::getXMin() const
+{
+  return m_XMin;
+}
+
+// -----------------------------------------------------------------------------
+void ExportMoabMesh::setYMin(int value)
+{
+  m_YMin = value;
+}
+
+// -----------------------------------------------------------------------------
+int ExportMoabMesh::getYMin() const
+{
+  return m_YMin;
+}
+
+// -----------------------------------------------------------------------------
+void ExportMoabMesh::setZMin(int value)
+{
+  m_ZMin = value;
+}
+
+// -----------------------------------------------------------------------------
+int ExportMoabMesh::getZMin() const
+{
+  return m_ZMin;
+}
+
+// -----------------------------------------------------------------------------
+void ExportMoabMesh::setXMax(int value)
+{
+  m_XMax = value;
+}
+
+// -----------------------------------------------------------------------------
+int ExportMoabMesh::getXMax() const
+{
+  return m_XMax;
+}
+
+// -----------------------------------------------------------------------------
+void ExportMoabMesh::setYMax(int value)
+{
+  m_YMax = value;
+}
+
+// -----------------------------------------------------------------------------
+int ExportMoabMesh::getYMax() const
+{
+  return m_YMax;
+}
+
+// -----------------------------------------------------------------------------
+void ExportMoabMesh::setZMax(int value)
+{
+  m_ZMax = value;
+}
+
+// -----------------------------------------------------------------------------
+int ExportMoabMesh::getZMax() const
+{
+  return m_ZMax;
+}
+
+// -----------------------------------------------------------------------------
+void ExportMoabMesh::setMaxOctreeLevel(int value)
+{
+  m_MaxOctreeLevel = value;
+}
+
+// -----------------------------------------------------------------------------
+int ExportMoabMesh::getMaxOctreeLevel() const
+{
+  return m_MaxOctreeLevel;
+}
+
+// -----------------------------------------------------------------------------
+void ExportMoabMesh::setWriteHangingNodes(bool value)
+{
+  m_WriteHangingNodes = value;
+}
+
+// -----------------------------------------------------------------------------
+bool ExportMoabMesh::getWriteHangingNodes() const
+{
+  return m_WriteHangingNodes;
+}
+
+// -----------------------------------------------------------------------------
+void ExportMoabMesh::setCompressOutput(bool value)
+{
+  m_CompressOutput = value;
+}
+
+// -----------------------------------------------------------------------------
+bool ExportMoabMesh::getCompressOutput() const
+{
+  return m_CompressOutput;
+}
+
+// -----------------------------------------------------------------------------
+void ExportMoabMesh::setChunkSize(int value)
+{
+  m_ChunkSize = value;
+}
+
+// -----------------------------------------------------------------------------
+int ExportMoabMesh::getChunkSize() const
+{
+  return m_ChunkSize;
+}
+
+// -----------------------------------------------------------------------------
+void ExportMoabMesh::setShuffle(bool value)
+{
+  m_Shuffle = value;
+}
+
+// -----------------------------------------------------------------------------
+bool ExportMoabMesh::getShuffle() const
+{
+  return m_Shuffle;
+}
+
+// -----------------------------------------------------------------------------
+void ExportMoabMesh::setDeflateLevel(int value)
+{
+  m_DeflateLevel = value;
+}
+
+// -----------------------------------------------------------------------------
+int ExportMoabMesh::getDeflateLevel() const
+{
+  return m_DeflateLevel;
+}
+
+// -----------------------------------------------------------------------------
+void ExportMoabMesh::setHdf5FilterId(int value)
+{
+  m_Hdf5FilterId = value;
+}
+
+// -----------------------------------------------------------------------------
+int ExportMoabMesh::getHdf5FilterId() const
+{
+  return m_Hdf5FilterId;
+}
+
+// -----------------------------------------------------------------------------
+void ExportMoabMesh::setWritePartitionSets(bool value)
+{
+  m_WritePartitionSets = value;
+}
+
+// -----------------------------------------------------------------------------
+bool ExportMoabMesh::getWritePartitionSets() const
+{
+  return m_WritePartitionSets;
+}
+
+// -----------------------------------------------------------------------------
+void ExportMoabMesh::setPartitionCount(int value)
+{
+  m_PartitionCount = value;
+}
+
+// -----------------------------------------------------------------------------
+int ExportMoabMesh::getPartitionCount() const
+{
+  return m_PartitionCount;
+}
+
+// -----------------------------------------------------------------------------
+void ExportMoabMesh::setPartitionStrategy(int value)
+{
+  m_PartitionStrategy = value;
+}
+
+// -----------------------------------------------------------------------------
+int ExportMoabMesh::getPartitionStrategy() const
+{
+  return m_PartitionStrategy;
+}
+
+// -----------------------------------------------------------------------------
+void ExportMoabMesh::setMeshOrdering(int value)
+{
+  m_MeshOrdering = value;
+}
+
+// -----------------------------------------------------------------------------
+int ExportMoabMesh::getMeshOrdering() const
+{
+  return m_MeshOrdering;
+}
+
+// -----------------------------------------------------------------------------
+void ExportMoabMesh::setExportBatch(bool value)
+{
+  m_ExportBatch = value;
+}
+
+// -----------------------------------------------------------------------------
+bool ExportMoabMesh::getExportBatch() const
+{
+  return m_ExportBatch;
+}
+
+// -----------------------------------------------------------------------------
+void ExportMoabMesh::setBatchDataContainerNames(const QStringList& value)
+{
+  m_BatchDataContainerNames = value;
+}
+
+// -----------------------------------------------------------------------------
+QStringList ExportMoabMesh::getBatchDataContainerNames() const
+{
+  return m_BatchDataContainerNames;
+}
+
+// -----------------------------------------------------------------------------
+void ExportMoabMesh::setBatchLayout(int value)
+{
+  m_BatchLayout = value;
+}
+
+// -----------------------------------------------------------------------------
+int ExportMoabMesh::getBatchLayout() const
+{
+  return m_BatchLayout;
+}
+
+// -----------------------------------------------------------------------------
+void ExportMoabMesh::setBatchThreadLimit(int value)
+{
+  m_BatchThreadLimit = value;
+}
+
+// -----------------------------------------------------------------------------
+int ExportMoabMesh::getBatchThreadLimit() const
+{
+  return m_BatchThreadLimit;
+}
+
+// -----------------------------------------------------------------------------
+void ExportMoabMesh::setReuseUnchangedMesh(bool value)
+{
+  m_ReuseUnchangedMesh = value;
+}
+
+// -----------------------------------------------------------------------------
+bool ExportMoabMesh::getReuseUnchangedMesh() const
+{
+  return m_ReuseUnchangedMesh;
+}
+
+// -----------------------------------------------------------------------------
+QString ExportMoabMesh::getEstimatedCost() const
+{
+  return m_EstimatedCost;
+}
+
+// -----------------------------------------------------------------------------
+void ExportMoabMesh::setPeakMemoryLimit(int value)
+{
+  m_PeakMemoryLimit = value;
+}
+
+// -----------------------------------------------------------------------------
+int ExportMoabMesh::getPeakMemoryLimit() const
+{
+  return m_PeakMemoryLimit;
+}
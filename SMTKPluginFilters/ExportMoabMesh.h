@@ -32,11 +32,16 @@
 
 #include <memory>
 
+#include "SIMPLib/Common/Constants.h"
 #include "SIMPLib/Filtering/AbstractFilter.h"
 #include "SIMPLib/DataArrays/DataArray.hpp"
+#include "SIMPLib/DataContainers/DataContainer.h"
+#include "SIMPLib/Geometry/ImageGeom.h"
 
 #include "SMTKPlugin/SMTKPluginDLLExport.h"
 
+struct MeshExportSettings;
+
 /**
  * @brief The ExportMoabMesh class. See [Filter documentation](@ref ExportMoabMesh) for details.
  */
@@ -48,8 +53,37 @@ class SMTKPlugin_EXPORT ExportMoabMesh : public AbstractFilter
   PYB11_BEGIN_BINDINGS(ExportMoabMesh SUPERCLASS AbstractFilter)
   PYB11_SHARED_POINTERS(ExportMoabMesh)
   PYB11_FILTER_NEW_MACRO(ExportMoabMesh)
-  PYB11_PROPERTY(DataArrayPath SelectedArrayPath READ getSelectedArrayPath WRITE setSelectedArrayPath)
+  PYB11_PROPERTY(QVector<DataArrayPath> SelectedArrayPaths READ getSelectedArrayPaths WRITE setSelectedArrayPaths)
   PYB11_PROPERTY(QString OutputFile READ getOutputFile WRITE setOutputFile)
+  PYB11_PROPERTY(int ExportMode READ getExportMode WRITE setExportMode)
+  PYB11_PROPERTY(int MemoryBudget READ getMemoryBudget WRITE setMemoryBudget)
+  PYB11_PROPERTY(bool WriteFeatureSets READ getWriteFeatureSets WRITE setWriteFeatureSets)
+  PYB11_PROPERTY(DataArrayPath FeatureIdsArrayPath READ getFeatureIdsArrayPath WRITE setFeatureIdsArrayPath)
+  PYB11_PROPERTY(bool CropToRegion READ getCropToRegion WRITE setCropToRegion)
+  PYB11_PROPERTY(int XMin READ getXMin WRITE setXMin)
+  PYB11_PROPERTY(int YMin READ getYMin WRITE setYMin)
+  PYB11_PROPERTY(int ZMin READ getZMin WRITE setZMin)
+  PYB11_PROPERTY(int XMax READ getXMax WRITE setXMax)
+  PYB11_PROPERTY(int YMax READ getYMax WRITE setYMax)
+  PYB11_PROPERTY(int ZMax READ getZMax WRITE setZMax)
+  PYB11_PROPERTY(int MaxOctreeLevel READ getMaxOctreeLevel WRITE setMaxOctreeLevel)
+  PYB11_PROPERTY(bool WriteHangingNodes READ getWriteHangingNodes WRITE setWriteHangingNodes)
+  PYB11_PROPERTY(bool CompressOutput READ getCompressOutput WRITE setCompressOutput)
+  PYB11_PROPERTY(int ChunkSize READ getChunkSize WRITE setChunkSize)
+  PYB11_PROPERTY(bool Shuffle READ getShuffle WRITE setShuffle)
+  PYB11_PROPERTY(int DeflateLevel READ getDeflateLevel WRITE setDeflateLevel)
+  PYB11_PROPERTY(int Hdf5FilterId READ getHdf5FilterId WRITE setHdf5FilterId)
+  PYB11_PROPERTY(bool WritePartitionSets READ getWritePartitionSets WRITE setWritePartitionSets)
+  PYB11_PROPERTY(int PartitionCount READ getPartitionCount WRITE setPartitionCount)
+  PYB11_PROPERTY(int PartitionStrategy READ getPartitionStrategy WRITE setPartitionStrategy)
+  PYB11_PROPERTY(int MeshOrdering READ getMeshOrdering WRITE setMeshOrdering)
+  PYB11_PROPERTY(bool ExportBatch READ getExportBatch WRITE setExportBatch)
+  PYB11_PROPERTY(QStringList BatchDataContainerNames READ getBatchDataContainerNames WRITE setBatchDataContainerNames)
+  PYB11_PROPERTY(int BatchLayout READ getBatchLayout WRITE setBatchLayout)
+  PYB11_PROPERTY(int BatchThreadLimit READ getBatchThreadLimit WRITE setBatchThreadLimit)
+  PYB11_PROPERTY(bool ReuseUnchangedMesh READ getReuseUnchangedMesh WRITE setReuseUnchangedMesh)
+  PYB11_PROPERTY(QString EstimatedCost READ getEstimatedCost)
+  PYB11_PROPERTY(int PeakMemoryLimit READ getPeakMemoryLimit WRITE setPeakMemoryLimit)
   PYB11_END_BINDINGS()
   // End Python bindings declarations
 
@@ -72,18 +106,39 @@ public:
    */
   static QString ClassName();
 
+  /**
+   * @brief The ExportModeType enum lists the ways the mesh can be generated and written
+   */
+  enum class ExportModeType : int
+  {
+    ExplicitHex = 0,   //!< Write explicit Hex8 elements, natively for h5m/mhdf and through SMTK for vtk/vtu
+    StructuredBox = 1, //!< Write the ImageGeom as a MOAB structured box with implicit connectivity
+    StreamingSlabs = 2,    //!< Generate and write explicit Hex8 elements one Z slab at a time within a memory budget
+    FeatureBoundaries = 3, //!< Write only the quad faces between Features and on the outside of the volume
+    CoarsenedOctree = 4    //!< Merge blocks of cells with one Feature Id into larger Hex8 elements with 2:1 balanced refinement
+  };
+
+  /**
+   * @brief The BatchLayoutType enum lists where the steps of a batch export are written
+   */
+  enum class BatchLayoutType : int
+  {
+    SingleFile = 0, //!< Write every step to the output file, with the Data Container name appended to each tag name
+    FilePerStep = 1 //!< Write each step to its own file, named after the output file and the Data Container
+  };
+
   ~ExportMoabMesh() override;
 
   /**
-   * @brief Setter property for SelectedArrayPath
+   * @brief Setter property for SelectedArrayPaths
    */
-  void setSelectedArrayPath(const DataArrayPath& value);
+  void setSelectedArrayPaths(const QVector<DataArrayPath>& value);
   /**
-   * @brief Getter property for SelectedArrayPath
-   * @return Value of SelectedArrayPath
+   * @brief Getter property for SelectedArrayPaths
+   * @return Value of SelectedArrayPaths
    */
-  DataArrayPath getSelectedArrayPath() const;
-  Q_PROPERTY(DataArrayPath SelectedArrayPath READ getSelectedArrayPath WRITE setSelectedArrayPath)
+  QVector<DataArrayPath> getSelectedArrayPaths() const;
+  Q_PROPERTY(QVector<DataArrayPath> SelectedArrayPaths READ getSelectedArrayPaths WRITE setSelectedArrayPaths)
 
   /**
    * @brief Setter property for OutputFile
@@ -96,6 +151,322 @@ public:
   QString getOutputFile() const;
   Q_PROPERTY(QString OutputFile READ getOutputFile WRITE setOutputFile)
 
+  /**
+   * @brief Setter property for ExportMode
+   */
+  void setExportMode(int value);
+  /**
+   * @brief Getter property for ExportMode
+   * @return Value of ExportMode
+   */
+  int getExportMode() const;
+  Q_PROPERTY(int ExportMode READ getExportMode WRITE setExportMode)
+
+  /**
+   * @brief Setter property for MemoryBudget
+   */
+  void setMemoryBudget(int value);
+  /**
+   * @brief Getter property for MemoryBudget
+   * @return Value of MemoryBudget
+   */
+  int getMemoryBudget() const;
+  Q_PROPERTY(int MemoryBudget READ getMemoryBudget WRITE setMemoryBudget)
+
+  /**
+   * @brief Setter property for WriteFeatureSets
+   */
+  void setWriteFeatureSets(bool value);
+  /**
+   * @brief Getter property for WriteFeatureSets
+   * @return Value of WriteFeatureSets
+   */
+  bool getWriteFeatureSets() const;
+  Q_PROPERTY(bool WriteFeatureSets READ getWriteFeatureSets WRITE setWriteFeatureSets)
+
+  /**
+   * @brief Setter property for FeatureIdsArrayPath
+   */
+  void setFeatureIdsArrayPath(const DataArrayPath& value);
+  /**
+   * @brief Getter property for FeatureIdsArrayPath
+   * @return Value of FeatureIdsArrayPath
+   */
+  DataArrayPath getFeatureIdsArrayPath() const;
+  Q_PROPERTY(DataArrayPath FeatureIdsArrayPath READ getFeatureIdsArrayPath WRITE setFeatureIdsArrayPath)
+
+  /**
+   * @brief Setter property for CropToRegion
+   */
+  void setCropToRegion(bool value);
+  /**
+   * @brief Getter property for CropToRegion
+   * @return Value of CropToRegion
+   */
+  bool getCropToRegion() const;
+  Q_PROPERTY(bool CropToRegion READ getCropToRegion WRITE setCropToRegion)
+
+  /**
+   * @brief Setter property for XMin
+   */
+  void setXMin(int value);
+  /**
+   * @brief Getter property for XMin
+   * @return Value of XMin
+   */
+  int getXMin() const;
+  Q_PROPERTY(int XMin READ getXMin WRITE setXMin)
+
+  /**
+   * @brief Setter property for YMin
+   */
+  void setYMin(int value);
+  /**
+   * @brief Getter property for YMin
+   * @return Value of YMin
+   */
+  int getYMin() const;
+  Q_PROPERTY(int YMin READ getYMin WRITE setYMin)
+
+  /**
+   * @brief Setter property for ZMin
+   */
+  void setZMin(int value);
+  /**
+   * @brief Getter property for ZMin
+   * @return Value of ZMin
+   */
+  int getZMin() const;
+  Q_PROPERTY(int ZMin READ getZMin WRITE setZMin)
+
+  /**
+   * @brief Setter property for XMax
+   */
+  void setXMax(int value);
+  /**
+   * @brief Getter property for XMax
+   * @return Value of XMax
+   */
+  int getXMax() const;
+  Q_PROPERTY(int XMax READ getXMax WRITE setXMax)
+
+  /**
+   * @brief Setter property for YMax
+   */
+  void setYMax(int value);
+  /**
+   * @brief Getter property for YMax
+   * @return Value of YMax
+   */
+  int getYMax() const;
+  Q_PROPERTY(int YMax READ getYMax WRITE setYMax)
+
+  /**
+   * @brief Setter property for ZMax
+   */
+  void setZMax(int value);
+  /**
+   * @brief Getter property for ZMax
+   * @return Value of ZMax
+   */
+  int getZMax() const;
+  Q_PROPERTY(int ZMax READ getZMax WRITE setZMax)
+
+  /**
+   * @brief Setter property for MaxOctreeLevel
+   */
+  void setMaxOctreeLevel(int value);
+  /**
+   * @brief Getter property for MaxOctreeLevel
+   * @return Value of MaxOctreeLevel
+   */
+  int getMaxOctreeLevel() const;
+  Q_PROPERTY(int MaxOctreeLevel READ getMaxOctreeLevel WRITE setMaxOctreeLevel)
+
+  /**
+   * @brief Setter property for WriteHangingNodes
+   */
+  void setWriteHangingNodes(bool value);
+  /**
+   * @brief Getter property for WriteHangingNodes
+   * @return Value of WriteHangingNodes
+   */
+  bool getWriteHangingNodes() const;
+  Q_PROPERTY(bool WriteHangingNodes READ getWriteHangingNodes WRITE setWriteHangingNodes)
+
+  /**
+   * @brief Setter property for CompressOutput
+   */
+  void setCompressOutput(bool value);
+  /**
+   * @brief Getter property for CompressOutput
+   * @return Value of CompressOutput
+   */
+  bool getCompressOutput() const;
+  Q_PROPERTY(bool CompressOutput READ getCompressOutput WRITE setCompressOutput)
+
+  /**
+   * @brief Setter property for ChunkSize
+   */
+  void setChunkSize(int value);
+  /**
+   * @brief Getter property for ChunkSize
+   * @return Value of ChunkSize
+   */
+  int getChunkSize() const;
+  Q_PROPERTY(int ChunkSize READ getChunkSize WRITE setChunkSize)
+
+  /**
+   * @brief Setter property for Shuffle
+   */
+  void setShuffle(bool value);
+  /**
+   * @brief Getter property for Shuffle
+   * @return Value of Shuffle
+   */
+  bool getShuffle() const;
+  Q_PROPERTY(bool Shuffle READ getShuffle WRITE setShuffle)
+
+  /**
+   * @brief Setter property for DeflateLevel
+   */
+  void setDeflateLevel(int value);
+  /**
+   * @brief Getter property for DeflateLevel
+   * @return Value of DeflateLevel
+   */
+  int getDeflateLevel() const;
+  Q_PROPERTY(int DeflateLevel READ getDeflateLevel WRITE setDeflateLevel)
+
+  /**
+   * @brief Setter property for Hdf5FilterId
+   */
+  void setHdf5FilterId(int value);
+  /**
+   * @brief Getter property for Hdf5FilterId
+   * @return Value of Hdf5FilterId
+   */
+  int getHdf5FilterId() const;
+  Q_PROPERTY(int Hdf5FilterId READ getHdf5FilterId WRITE setHdf5FilterId)
+
+  /**
+   * @brief Setter property for WritePartitionSets
+   */
+  void setWritePartitionSets(bool value);
+  /**
+   * @brief Getter property for WritePartitionSets
+   * @return Value of WritePartitionSets
+   */
+  bool getWritePartitionSets() const;
+  Q_PROPERTY(bool WritePartitionSets READ getWritePartitionSets WRITE setWritePartitionSets)
+
+  /**
+   * @brief Setter property for PartitionCount
+   */
+  void setPartitionCount(int value);
+  /**
+   * @brief Getter property for PartitionCount
+   * @return Value of PartitionCount
+   */
+  int getPartitionCount() const;
+  Q_PROPERTY(int PartitionCount READ getPartitionCount WRITE setPartitionCount)
+
+  /**
+   * @brief Setter property for PartitionStrategy
+   */
+  void setPartitionStrategy(int value);
+  /**
+   * @brief Getter property for PartitionStrategy
+   * @return Value of PartitionStrategy
+   */
+  int getPartitionStrategy() const;
+  Q_PROPERTY(int PartitionStrategy READ getPartitionStrategy WRITE setPartitionStrategy)
+
+  /**
+   * @brief Setter property for MeshOrdering
+   */
+  void setMeshOrdering(int value);
+  /**
+   * @brief Getter property for MeshOrdering
+   * @return Value of MeshOrdering
+   */
+  int getMeshOrdering() const;
+  Q_PROPERTY(int MeshOrdering READ getMeshOrdering WRITE setMeshOrdering)
+
+  /**
+   * @brief Setter property for ExportBatch
+   */
+  void setExportBatch(bool value);
+  /**
+   * @brief Getter property for ExportBatch
+   * @return Value of ExportBatch
+   */
+  bool getExportBatch() const;
+  Q_PROPERTY(bool ExportBatch READ getExportBatch WRITE setExportBatch)
+
+  /**
+   * @brief Setter property for BatchDataContainerNames
+   */
+  void setBatchDataContainerNames(const QStringList& value);
+  /**
+   * @brief Getter property for BatchDataContainerNames
+   * @return Value of BatchDataContainerNames
+   */
+  QStringList getBatchDataContainerNames() const;
+  Q_PROPERTY(QStringList BatchDataContainerNames READ getBatchDataContainerNames WRITE setBatchDataContainerNames)
+
+  /**
+   * @brief Setter property for BatchLayout
+   */
+  void setBatchLayout(int value);
+  /**
+   * @brief Getter property for BatchLayout
+   * @return Value of BatchLayout
+   */
+  int getBatchLayout() const;
+  Q_PROPERTY(int BatchLayout READ getBatchLayout WRITE setBatchLayout)
+
+  /**
+   * @brief Setter property for BatchThreadLimit
+   */
+  void setBatchThreadLimit(int value);
+  /**
+   * @brief Getter property for BatchThreadLimit
+   * @return Value of BatchThreadLimit
+   */
+  int getBatchThreadLimit() const;
+  Q_PROPERTY(int BatchThreadLimit READ getBatchThreadLimit WRITE setBatchThreadLimit)
+
+  /**
+   * @brief Setter property for ReuseUnchangedMesh
+   */
+  void setReuseUnchangedMesh(bool value);
+  /**
+   * @brief Getter property for ReuseUnchangedMesh
+   * @return Value of ReuseUnchangedMesh
+   */
+  bool getReuseUnchangedMesh() const;
+  Q_PROPERTY(bool ReuseUnchangedMesh READ getReuseUnchangedMesh WRITE setReuseUnchangedMesh)
+
+  /**
+   * @brief Getter property for EstimatedCost, the peak memory, file size and duration the
+   * last preflight expects for the export
+   * @return Value of EstimatedCost
+   */
+  QString getEstimatedCost() const;
+  Q_PROPERTY(QString EstimatedCost READ getEstimatedCost)
+
+  /**
+   * @brief Setter property for PeakMemoryLimit
+   */
+  void setPeakMemoryLimit(int value);
+  /**
+   * @brief Getter property for PeakMemoryLimit
+   * @return Value of PeakMemoryLimit
+   */
+  int getPeakMemoryLimit() const;
+  Q_PROPERTY(int PeakMemoryLimit READ getPeakMemoryLimit WRITE setPeakMemoryLimit)
+
   /**
    * @brief getCompiledLibraryName Reimplemented from @see AbstractFilter class
    */
@@ -146,6 +517,11 @@ public:
    */
   void setupFilterParameters() override;
 
+  /**
+   * @brief readFilterParameters Reimplemented from @see AbstractFilter class
+   */
+  void readFilterParameters(QJsonObject& obj) override;
+
   /**
    * @brief execute Reimplemented from @see AbstractFilter class
    */
@@ -192,12 +568,88 @@ protected:
    */
   void initialize();
 
+  /**
+   * @brief dataCheckCompression Checks the chunking and filter settings
+   */
+  void dataCheckCompression();
+
+  /**
+   * @brief dataCheckPartitions Checks the partition settings against the export mode and format
+   */
+  void dataCheckPartitions();
+
+  /**
+   * @brief dataCheckBatch Checks that every Data Container of the batch holds the selected
+   * arrays on the same ImageGeom as the first selected array
+   * @param image ImageGeom that the mesh is generated from
+   */
+  void dataCheckBatch(const ImageGeom::Pointer& image);
+
+  /**
+   * @brief dataCheckEstimate Estimates the peak memory, output file size and duration of the
+   * export from the numbers of elements and nodes, the tag widths and the settings, and checks
+   * the peak memory against the limit. Call it after a successful dataCheck().
+   */
+  void dataCheckEstimate();
+
+  /**
+   * @brief dataCheckRegion Checks that the region of interest lies inside the ImageGeom and,
+   * for a structured box, that MOAB can index every vertex of the exported region with an int
+   * @param image
+   */
+  void dataCheckRegion(const ImageGeom::Pointer& image);
+
+  /**
+   * @brief dataCheckGeometry Checks the settings against a geometry other than an ImageGeom,
+   * which is written with its own vertices and elements, and checks that the selected arrays
+   * belong to the Attribute Matrix of its elements
+   * @param geom
+   */
+  void dataCheckGeometry(const IGeometry::Pointer& geom);
+
+  /**
+   * @brief getExportSettings Returns the settings and arrays the exporter of the export mode
+   * writes with. Call it after a successful dataCheck().
+   * @return
+   */
+  MeshExportSettings getExportSettings() const;
+
 private:
-  std::weak_ptr<DataArray<double>> m_SelectedArrayPtr;
-  double* m_SelectedArray = nullptr;
+  QVector<IDataArray::WeakPointer> m_SelectedWeakPtrVector;
+  QVector<QVector<IDataArray::WeakPointer>> m_BatchWeakPtrVectors;
+  std::weak_ptr<Int32ArrayType> m_FeatureIdsPtr;
 
-  DataArrayPath m_SelectedArrayPath = {};
+  QVector<DataArrayPath> m_SelectedArrayPaths = {};
   QString m_OutputFile = {};
+  int m_ExportMode = static_cast<int>(ExportModeType::ExplicitHex);
+  int m_MemoryBudget = 1024;
+  bool m_WriteFeatureSets = false;
+  DataArrayPath m_FeatureIdsArrayPath = {SIMPL::Defaults::ImageDataContainerName, SIMPL::Defaults::CellAttributeMatrixName, SIMPL::CellData::FeatureIds};
+  bool m_CropToRegion = false;
+  int m_XMin = 0;
+  int m_YMin = 0;
+  int m_ZMin = 0;
+  int m_XMax = 0;
+  int m_YMax = 0;
+  int m_ZMax = 0;
+  int m_MaxOctreeLevel = 4;
+  bool m_WriteHangingNodes = true;
+  bool m_CompressOutput = false;
+  int m_ChunkSize = 65536;
+  bool m_Shuffle = true;
+  int m_DeflateLevel = 4;
+  int m_Hdf5FilterId = 0;
+  bool m_WritePartitionSets = false;
+  int m_PartitionCount = 4;
+  int m_PartitionStrategy = 1;
+  int m_MeshOrdering = 0;
+  bool m_ExportBatch = false;
+  QStringList m_BatchDataContainerNames = {};
+  int m_BatchLayout = static_cast<int>(BatchLayoutType::SingleFile);
+  int m_BatchThreadLimit = 0;
+  bool m_ReuseUnchangedMesh = false;
+  QString m_EstimatedCost = {};
+  int m_PeakMemoryLimit = 0;
 
   QStringList m_AllowedExtensions;
   QString m_ExtensionsString;
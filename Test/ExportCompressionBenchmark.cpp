@@ -0,0 +1,195 @@
+/* ============================================================================
+* Copyright (c) 2018 BlueQuartz Software, LLC
+*
+* Redistribution and use in source and binary forms, with or without modification,
+* are permitted provided that the following conditions are met:
+*
+* Redistributions of source code must retain the above copyright notice, this
+* list of conditions and the following disclaimer.
+*
+* Redistributions in binary form must reproduce the above copyright notice, this
+* list of conditions and the following disclaimer in the documentation and/or
+* other materials provided with the distribution.
+*
+* Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+* contributors may be used to endorse or promote products derived from this software
+* without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+* DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+* FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+* DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+* OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+* USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*
+* ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <vector>
+
+#include <QtCore/QDir>
+#include <QtCore/QElapsedTimer>
+#include <QtCore/QFile>
+#include <QtCore/QFileInfo>
+
+#include "SIMPLib/DataArrays/DataArray.hpp"
+#include "SIMPLib/DataContainers/AttributeMatrix.h"
+#include "SIMPLib/DataContainers/DataContainerArray.h"
+#include "SIMPLib/Geometry/ImageGeom.h"
+
+#include "SMTKPluginFilters/ExportMoabMesh.h"
+
+// -----------------------------------------------------------------------------
+// Measures the export throughput and the compression ratio of the h5m writer for
+// a range of chunk and filter settings. Throughput is the size of the uncompressed
+// file divided by the export time, so settings that compress well can exceed the
+// raw write speed of the disk.
+//
+// Usage: ExportCompressionBenchmark [cellsPerSide] [grainSize ...]
+// The defaults are a 64^3 volume with grains of 4^3 and 16^3 cells. The output is
+// written to the temporary directory and removed at the end.
+// -----------------------------------------------------------------------------
+
+namespace
+{
+const QString k_DataContainerName("BenchmarkDataContainer");
+const QString k_AttributeMatrixName("CellData");
+const QString k_FeatureIdsName("FeatureIds");
+const QString k_NoiseName("Confidence");
+
+struct Setting
+{
+  const char* name;
+  bool compress;
+  int chunkSize;
+  bool shuffle;
+  int deflateLevel;
+};
+
+// -----------------------------------------------------------------------------
+// Cubic grains with scattered ids, and a noise array that barely compresses
+// -----------------------------------------------------------------------------
+DataContainerArray::Pointer CreateSyntheticVolume(size_t dim, size_t grainSize)
+{
+  DataContainerArray::Pointer dca = DataContainerArray::New();
+  DataContainer::Pointer dc = DataContainer::New(k_DataContainerName);
+  ImageGeom::Pointer image = ImageGeom::CreateGeometry(SIMPL::Geometry::ImageGeometry);
+  image->setDimensions(dim, dim, dim);
+  dc->setGeometry(image);
+  dca->addDataContainer(dc);
+
+  QVector<size_t> tDims(3, dim);
+  AttributeMatrix::Pointer am = AttributeMatrix::New(tDims, k_AttributeMatrixName, AttributeMatrix::Type::Cell);
+  dc->addAttributeMatrix(k_AttributeMatrixName, am);
+
+  size_t numCells = dim * dim * dim;
+  Int32ArrayType::Pointer featureIds = Int32ArrayType::CreateArray(numCells, k_FeatureIdsName);
+  FloatArrayType::Pointer noise = FloatArrayType::CreateArray(numCells, k_NoiseName);
+  size_t grainsPerSide = (dim + grainSize - 1) / grainSize;
+  uint32_t state = 12345;
+  for(size_t z = 0; z < dim; z++)
+  {
+    for(size_t y = 0; y < dim; y++)
+    {
+      for(size_t x = 0; x < dim; x++)
+      {
+        size_t index = (z * dim + y) * dim + x;
+        size_t grain = ((z / grainSize) * grainsPerSide + y / grainSize) * grainsPerSide + x / grainSize;
+        featureIds->setValue(index, static_cast<int32_t>((grain * 2654435761u) % 100000));
+        state = state * 1664525u + 1013904223u;
+        noise->setValue(index, static_cast<float>(state >> 8) / 16777216.0f);
+      }
+    }
+  }
+  am->addAttributeArray(k_FeatureIdsName, featureIds);
+  am->addAttributeArray(k_NoiseName, noise);
+
+  return dca;
+}
+} // namespace
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int main(int argc, char* argv[])
+{
+  long long dim = (argc > 1) ? std::atoll(argv[1]) : 64;
+  std::vector<long long> grainSizes;
+  for(int i = 2; i < argc; i++)
+  {
+    grainSizes.push_back(std::atoll(argv[i]));
+  }
+  if(grainSizes.empty())
+  {
+    grainSizes = {4, 16};
+  }
+  if(dim <= 0 || std::any_of(grainSizes.begin(), grainSizes.end(), [](long long grainSize) { return grainSize <= 0; }))
+  {
+    std::cout << "Usage: " << argv[0] << " [cellsPerSide] [grainSize ...]" << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  const std::vector<Setting> settings = {{"contiguous", false, 0, false, 0},
+                                         {"chunk 64K", true, 65536, false, 0},
+                                         {"deflate 1", true, 65536, false, 1},
+                                         {"shuffle + deflate 1", true, 65536, true, 1},
+                                         {"shuffle + deflate 4", true, 65536, true, 4},
+                                         {"shuffle + deflate 9", true, 65536, true, 9},
+                                         {"shuffle + deflate 4, chunk 4K", true, 4096, true, 4},
+                                         {"shuffle + deflate 4, chunk 1M", true, 1048576, true, 4}};
+  const QString outputFile = QDir::tempPath() + "/ExportCompressionBenchmark.h5m";
+
+  for(long long grainSize : grainSizes)
+  {
+    DataContainerArray::Pointer dca = CreateSyntheticVolume(static_cast<size_t>(dim), static_cast<size_t>(grainSize));
+    for(const QString& arrayName : {k_FeatureIdsName, k_NoiseName})
+    {
+      std::cout << "Synthetic volume of " << dim << "^3 cells with grains of " << grainSize << "^3 cells, exporting " << arrayName.toStdString() << std::endl;
+
+      qint64 rawBytes = 0;
+      for(const Setting& setting : settings)
+      {
+        ExportMoabMesh::Pointer filter = ExportMoabMesh::New();
+        filter->setDataContainerArray(dca);
+        filter->setSelectedArrayPaths({DataArrayPath(k_DataContainerName, k_AttributeMatrixName, arrayName)});
+        filter->setOutputFile(outputFile);
+        filter->setCompressOutput(setting.compress);
+        filter->setChunkSize(setting.chunkSize);
+        filter->setShuffle(setting.shuffle);
+        filter->setDeflateLevel(setting.deflateLevel);
+
+        QElapsedTimer timer;
+        timer.start();
+        filter->execute();
+        qint64 elapsed = std::max<qint64>(timer.elapsed(), 1);
+        if(filter->getErrorCondition() < 0)
+        {
+          std::cout << "  " << setting.name << ": export failed with error " << filter->getErrorCondition() << std::endl;
+          QFile::remove(outputFile);
+          return EXIT_FAILURE;
+        }
+
+        qint64 fileBytes = QFileInfo(outputFile).size();
+        if(!setting.compress)
+        {
+          rawBytes = fileBytes;
+        }
+        double megabytesPerSecond = (rawBytes / (1024.0 * 1024.0)) / (elapsed / 1000.0);
+        double ratio = static_cast<double>(rawBytes) / static_cast<double>(fileBytes);
+        std::cout << "  " << std::left << std::setw(32) << setting.name << std::right << std::fixed << std::setprecision(1) << std::setw(9) << megabytesPerSecond << " MB/s" << std::setw(8) << ratio
+                  << " : 1" << std::endl;
+      }
+    }
+  }
+
+  QFile::remove(outputFile);
+  return EXIT_SUCCESS;
+}
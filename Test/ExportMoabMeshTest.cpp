@@ -28,20 +28,43 @@
 *
 * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
 
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <map>
+
 #include <QtCore/QCoreApplication>
 #include <QtCore/QFile>
+#include <QtCore/QFileInfo>
+#include <QtCore/QJsonObject>
 
 #include "SIMPLib/SIMPLib.h"
 #include "SIMPLib/Common/SIMPLibSetGetMacros.h"
 #include "SIMPLib/DataArrays/DataArray.hpp"
+#include "SIMPLib/DataContainers/AttributeMatrix.h"
+#include "SIMPLib/DataContainers/DataContainerArray.h"
 #include "SIMPLib/Filtering/FilterPipeline.h"
 #include "SIMPLib/Filtering/FilterManager.h"
 #include "SIMPLib/Filtering/FilterFactory.hpp"
 #include "SIMPLib/Plugin/ISIMPLibPlugin.h"
 #include "SIMPLib/Plugin/SIMPLibPluginLoader.h"
 #include "SIMPLib/Geometry/ImageGeom.h"
+#include "SIMPLib/Geometry/HexahedralGeom.h"
+#include "SIMPLib/Geometry/QuadGeom.h"
+#include "SIMPLib/Geometry/TriangleGeom.h"
 #include "SIMPLib/Filtering/QMetaObjectUtilities.h"
 #include "SIMPLib/CoreFilters/DataContainerReader.h"
+#include "SIMPLib/Messages/FilterProgressMessage.h"
+
+#include <vtkIdList.h>
+#include <vtkSmartPointer.h>
+#include <vtkUnstructuredGrid.h>
+#include <vtkXMLUnstructuredGridReader.h>
+#include <vtk_exodusII.h>
+
+#include "moab/Core.hpp"
 
 #include "H5Support/QH5Lite.h"
 #include "H5Support/QH5Utilities.h"
@@ -57,6 +80,39 @@ const QString DataContainerName = "SyntheticVolumeDataContainer";
 const QString AttributeMatrixName = "CellData";
 const QString DataArrayName = "FeatureIdsDoubles";
 const QString ErrorDataArrayName = "FeatureIds";
+const QString NoiseDataArrayName = "Confidence";
+
+/**
+ * @brief Cancels a filter from its own progress messages, the way the user does from the GUI,
+ * once the export has reached the given percentage
+ */
+class CancelObserver : public Observer
+{
+public:
+  CancelObserver(AbstractFilter* filter, int cancelPercent)
+  : m_Filter(filter)
+  , m_CancelPercent(cancelPercent)
+  {
+  }
+
+  void processPipelineMessage(const AbstractMessage::Pointer& msg) override
+  {
+    FilterProgressMessage::Pointer progressMsg = std::dynamic_pointer_cast<FilterProgressMessage>(msg);
+    if(nullptr == progressMsg)
+    {
+      return;
+    }
+    m_LastPercent = progressMsg->getProgressValue();
+    if(m_LastPercent >= m_CancelPercent)
+    {
+      m_Filter->setCancel(true);
+    }
+  }
+
+  AbstractFilter* m_Filter = nullptr;
+  int m_CancelPercent = 100;
+  int m_LastPercent = -1;
+};
 
 class ExportMoabMeshTest
 {
@@ -74,9 +130,113 @@ class ExportMoabMeshTest
   #if REMOVE_TEST_FILES
     QFile::remove(UnitTest::ExportMoabMeshTest::VTKOutputFile);
     QFile::remove(UnitTest::ExportMoabMeshTest::HDF5OutputFile);
+    QFile::remove(UnitTest::ExportMoabMeshTest::StructuredOutputFile);
+    QFile::remove(UnitTest::ExportMoabMeshTest::StreamingOutputFile);
+    QFile::remove(UnitTest::ExportMoabMeshTest::StreamingVtuOutputFile);
+    QFile::remove(UnitTest::ExportMoabMeshTest::TypesOutputFile);
+    QFile::remove(UnitTest::ExportMoabMeshTest::StructuredTypesOutputFile);
+    QFile::remove(UnitTest::ExportMoabMeshTest::NativeTypesOutputFile);
+    QFile::remove(UnitTest::ExportMoabMeshTest::FeatureSetsOutputFile);
+    QFile::remove(UnitTest::ExportMoabMeshTest::BoundaryOutputFile);
+    QFile::remove(UnitTest::ExportMoabMeshTest::BoundaryVtuOutputFile);
+    QFile::remove(UnitTest::ExportMoabMeshTest::CropOutputFile);
+    QFile::remove(UnitTest::ExportMoabMeshTest::CropVTKOutputFile);
+    QFile::remove(UnitTest::ExportMoabMeshTest::OctreeOutputFile);
+    QFile::remove(UnitTest::ExportMoabMeshTest::CompressedOutputFile);
+    QFile::remove(UnitTest::ExportMoabMeshTest::PartitionOutputFile);
+    QFile::remove(UnitTest::ExportMoabMeshTest::BatchOutputFile);
+    QFile::remove(UnitTest::ExportMoabMeshTest::ReuseOutputFile);
+    QFile::remove(UnitTest::ExportMoabMeshTest::CancelOutputFile);
+    QFile::remove(UnitTest::ExportMoabMeshTest::CancelVtuOutputFile);
+    QFile::remove(UnitTest::ExportMoabMeshTest::ExodusOutputFile);
+    QFile::remove(UnitTest::ExportMoabMeshTest::OrderedOutputFile);
+    QFile::remove(UnitTest::ExportMoabMeshTest::ElementListOutputFile);
+    QFile::remove(UnitTest::ExportMoabMeshTest::HexahedralOutputFile);
+    QFile::remove(UnitTest::ExportMoabMeshTest::MoabHexOutputFile);
+    QFile::remove(UnitTest::ExportMoabMeshTest::MoabTriOutputFile);
+    QFile::remove(UnitTest::ExportMoabMeshTest::MoabQuadOutputFile);
+    for(const QString& stepName : BatchStepNames())
+    {
+      QFile::remove(BatchStepFile(stepName));
+    }
   #endif
   }
 
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  int CheckHex8Tag(const QString& filePath, const QString& tagName, H5T_class_t expectedClass = H5T_NO_CLASS, size_t expectedSize = 0)
+  {
+    hid_t fileId = QH5Utilities::openFile(filePath, true);
+    DREAM3D_REQUIRE(fileId >= 0);
+    H5ScopedFileSentinel sentinel(&fileId, true);
+
+    hid_t tsttId = QH5Utilities::openHDF5Object(fileId, "tstt");
+    DREAM3D_REQUIRE(tsttId >= 0);
+    sentinel.addGroupId(&tsttId);
+
+    hid_t elementsId = QH5Utilities::openHDF5Object(tsttId, "elements");
+    DREAM3D_REQUIRE(elementsId >= 0);
+    sentinel.addGroupId(&elementsId);
+
+    hid_t hex8Id = QH5Utilities::openHDF5Object(elementsId, "Hex8");
+    DREAM3D_REQUIRE(hex8Id >= 0);
+    sentinel.addGroupId(&hex8Id);
+
+    QVector<hsize_t> dims;
+    H5T_class_t classType;
+    size_t sizeType;
+    herr_t infoId = QH5Lite::getDatasetInfo(hex8Id, "connectivity", dims, classType, sizeType);
+    DREAM3D_REQUIRE(infoId >= 0);
+    DREAM3D_REQUIRE_EQUAL(dims.size(), 2);
+    DREAM3D_REQUIRE_EQUAL(dims[1], 8);
+
+    hid_t tagsId = QH5Utilities::openHDF5Object(hex8Id, "tags");
+    DREAM3D_REQUIRE(tagsId >= 0);
+    sentinel.addGroupId(&tagsId);
+
+    bool exists = QH5Lite::datasetExists(tagsId, tagName);
+    DREAM3D_REQUIRE_EQUAL(exists, true);
+
+    infoId = QH5Lite::getDatasetInfo(tagsId, tagName, dims, classType, sizeType);
+    DREAM3D_REQUIRE(infoId >= 0);
+    DREAM3D_REQUIRE_EQUAL(dims.size(), 1);
+
+    if(expectedClass != H5T_NO_CLASS)
+    {
+      DREAM3D_REQUIRE_EQUAL(classType, expectedClass);
+      DREAM3D_REQUIRE_EQUAL(sizeType, expectedSize);
+    }
+
+    return EXIT_SUCCESS;
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  DataContainerReader::Pointer CreateReader()
+  {
+    DataContainerReader::Pointer dcReaderFilter = DataContainerReader::New();
+    dcReaderFilter->setInputFile(UnitTest::ExportMoabMeshTest::InputFile);
+    DataContainerArrayProxy proxy = dcReaderFilter->readDataContainerArrayStructure(UnitTest::ExportMoabMeshTest::InputFile);
+    dcReaderFilter->setInputFileDataContainerArrayProxy(proxy);
+    return dcReaderFilter;
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  AbstractFilter::Pointer CreateExportFilter()
+  {
+    FilterManager* fm = FilterManager::Instance();
+    IFilterFactory::Pointer filterFactory = fm->getFactoryFromClassName("ExportMoabMesh");
+    if(nullptr == filterFactory.get())
+    {
+      return AbstractFilter::NullPointer();
+    }
+    return filterFactory->create();
+  }
+
   // -----------------------------------------------------------------------------
   //
   // -----------------------------------------------------------------------------
@@ -106,11 +266,7 @@ class ExportMoabMeshTest
     Observer obs;
     pipeline->addMessageReceiver(&obs);
 
-    DataContainerReader::Pointer dcReaderFilter = DataContainerReader::New();
-    dcReaderFilter->setInputFile(UnitTest::ExportMoabMeshTest::InputFile);
-    DataContainerArrayProxy proxy = dcReaderFilter->readDataContainerArrayStructure(UnitTest::ExportMoabMeshTest::InputFile);
-    dcReaderFilter->setInputFileDataContainerArrayProxy(proxy);
-    pipeline->pushBack(dcReaderFilter);
+    pipeline->pushBack(CreateReader());
 
     QString filtName = "ExportMoabMesh";
     FilterManager* fm = FilterManager::Instance();
@@ -124,11 +280,12 @@ class ExportMoabMeshTest
       pipeline->pushBack(filter);
 
       pipeline->preflightPipeline();
-      DREAM3D_REQUIRE_EQUAL(filter->getErrorCondition(), -80000);
+      DREAM3D_REQUIRE_EQUAL(filter->getErrorCondition(), -101015);
       filter->clearErrorCode();
 
-      var.setValue(DataArrayPath(DataContainerName, AttributeMatrixName, DataArrayName));
-      propWasSet = filter->setProperty("SelectedArrayPath", var);
+      QVector<DataArrayPath> paths = {DataArrayPath(DataContainerName, AttributeMatrixName, DataArrayName)};
+      var.setValue(paths);
+      propWasSet = filter->setProperty("SelectedArrayPaths", var);
       DREAM3D_REQUIRE_EQUAL(propWasSet, true);
 
       pipeline->preflightPipeline();
@@ -158,41 +315,127 @@ class ExportMoabMeshTest
       pipeline->execute();
       DREAM3D_REQUIRE_EQUAL(filter->getErrorCondition(), 0);
 
-      hid_t fileId = QH5Utilities::openFile(UnitTest::ExportMoabMeshTest::HDF5OutputFile, true);
-      DREAM3D_REQUIRE(fileId >= 0);
-      H5ScopedFileSentinel sentinel(&fileId, true);
+      int err = CheckHex8Tag(UnitTest::ExportMoabMeshTest::HDF5OutputFile, DataArrayName + "_");
+      DREAM3D_REQUIRE_EQUAL(err, EXIT_SUCCESS);
+    }
+    else
+    {
+      std::stringstream ss;
+      ss << QObject::tr("ExportMoabMeshTest Error creating filter '%1'. Filter was not created/executed. Please notify the developers.").arg(filtName).toStdString();
+      DREAM3D_REQUIRE_EQUAL(0, 1)
+    }
+
+    return EXIT_SUCCESS;
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  int TestExportStructuredBox()
+  {
+    FilterPipeline::Pointer pipeline = FilterPipeline::New();
+    Observer obs;
+    pipeline->addMessageReceiver(&obs);
+    pipeline->pushBack(CreateReader());
+
+    AbstractFilter::Pointer filter = CreateExportFilter();
+    DREAM3D_REQUIRE_VALID_POINTER(filter.get());
+    pipeline->pushBack(filter);
 
-      hid_t tsttId = QH5Utilities::openHDF5Object(fileId, "tstt");
-      DREAM3D_REQUIRE(tsttId >= 0);
-      sentinel.addGroupId(&tsttId);
+    QVariant var;
+    QVector<DataArrayPath> paths = {DataArrayPath(DataContainerName, AttributeMatrixName, DataArrayName)};
+    var.setValue(paths);
+    bool propWasSet = filter->setProperty("SelectedArrayPaths", var);
+    DREAM3D_REQUIRE_EQUAL(propWasSet, true);
 
-      hid_t elementsId = QH5Utilities::openHDF5Object(tsttId, "elements");
-      DREAM3D_REQUIRE(elementsId >= 0);
-      sentinel.addGroupId(&elementsId);
+    var.setValue(static_cast<int>(ExportMoabMesh::ExportModeType::StructuredBox));
+    propWasSet = filter->setProperty("ExportMode", var);
+    DREAM3D_REQUIRE_EQUAL(propWasSet, true);
 
-      hid_t hex8Id = QH5Utilities::openHDF5Object(elementsId, "Hex8");
-      DREAM3D_REQUIRE(hex8Id >= 0);
-      sentinel.addGroupId(&hex8Id);
+    // MOAB cannot write structured meshes to the XML VTK format
+    var.setValue(UnitTest::TestTempDir + "/ExportMoabMeshStructuredOutput.vtu");
+    propWasSet = filter->setProperty("OutputFile", var);
+    DREAM3D_REQUIRE_EQUAL(propWasSet, true);
 
-      hid_t tagsId = QH5Utilities::openHDF5Object(hex8Id, "tags");
-      DREAM3D_REQUIRE(tagsId >= 0);
-      sentinel.addGroupId(&tagsId);
+    pipeline->preflightPipeline();
+    DREAM3D_REQUIRE_EQUAL(filter->getErrorCondition(), -101006);
+    filter->clearErrorCode();
 
-      bool exists = QH5Lite::datasetExists(tagsId, DataArrayName + "_");
-      DREAM3D_REQUIRE_EQUAL(exists, true);
+    var.setValue(UnitTest::ExportMoabMeshTest::StructuredOutputFile);
+    propWasSet = filter->setProperty("OutputFile", var);
+    DREAM3D_REQUIRE_EQUAL(propWasSet, true);
 
-      QVector<hsize_t> dims;
-      H5T_class_t classType;
-      size_t sizeType;
-      herr_t infoId = QH5Lite::getDatasetInfo(tagsId, DataArrayName + "_", dims, classType, sizeType);
-      DREAM3D_REQUIRE(infoId >= 0);
-      DREAM3D_REQUIRE_EQUAL(dims.size(), 1);
+    pipeline->preflightPipeline();
+    DREAM3D_REQUIRE_EQUAL(filter->getErrorCondition(), 0);
+    pipeline->execute();
+    DREAM3D_REQUIRE_EQUAL(filter->getErrorCondition(), 0);
+
+    int err = CheckHex8Tag(UnitTest::ExportMoabMeshTest::StructuredOutputFile, DataArrayName + "_");
+    DREAM3D_REQUIRE_EQUAL(err, EXIT_SUCCESS);
+
+    // MOAB orders the box with X varying fastest, which must line up with the SIMPL cell order
+    const size_t k_Dims[3] = {5, 4, 3};
+    const float k_Res[3] = {0.5f, 1.0f, 2.0f};
+    const float k_Origin[3] = {1.5f, -2.0f, 0.25f};
+    const size_t k_NumCells = k_Dims[0] * k_Dims[1] * k_Dims[2];
+    const size_t k_NumNodes = (k_Dims[0] + 1) * (k_Dims[1] + 1) * (k_Dims[2] + 1);
+    DoubleArrayType::Pointer cellValues = DoubleArrayType::CreateArray(k_NumCells, DataArrayName);
+    for(size_t i = 0; i < k_NumCells; i++)
+    {
+      cellValues->setValue(i, 1.5 * static_cast<double>(i) + 0.25);
     }
-    else
+    DataContainerArray::Pointer dca = CreateSyntheticVolume({k_Dims[0], k_Dims[1], k_Dims[2]}, {cellValues});
+    ImageGeom::Pointer image = dca->getDataContainer(DataContainerName)->getGeometryAs<ImageGeom>();
+    image->setResolution(k_Res[0], k_Res[1], k_Res[2]);
+    image->setOrigin(k_Origin[0], k_Origin[1], k_Origin[2]);
+
+    filter->setDataContainerArray(dca);
+    filter->execute();
+    DREAM3D_REQUIRE_EQUAL(filter->getErrorCondition(), 0);
+
+    std::vector<uint8_t> coordBytes;
+    std::vector<uint8_t> connectivityBytes;
+    std::vector<uint8_t> tagBytes;
+    const QString path = UnitTest::ExportMoabMeshTest::StructuredOutputFile;
+    DREAM3D_REQUIRE_EQUAL(ReadDataset(path, "/tstt/nodes/coordinates", coordBytes), true);
+    DREAM3D_REQUIRE_EQUAL(ReadDataset(path, "/tstt/elements/Hex8/connectivity", connectivityBytes), true);
+    DREAM3D_REQUIRE_EQUAL(ReadDataset(path, "/tstt/elements/Hex8/tags/" + DataArrayName + "_", tagBytes), true);
+    DREAM3D_REQUIRE_EQUAL(coordBytes.size(), k_NumNodes * 3 * sizeof(double));
+    DREAM3D_REQUIRE_EQUAL(connectivityBytes.size(), k_NumCells * 8 * sizeof(int64_t));
+    DREAM3D_REQUIRE_EQUAL(tagBytes.size(), k_NumCells * sizeof(double));
+    const double* coords = reinterpret_cast<const double*>(coordBytes.data());
+    const int64_t* connectivity = reinterpret_cast<const int64_t*>(connectivityBytes.data());
+    const double* tagValues = reinterpret_cast<const double*>(tagBytes.data());
+
+    for(size_t node : {size_t(0), size_t(1), k_Dims[0] + 1, k_NumNodes / 2, k_NumNodes - 1})
     {
-      std::stringstream ss;
-      ss << QObject::tr("ExportMoabMeshTest Error creating filter '%1'. Filter was not created/executed. Please notify the developers.").arg(filtName).toStdString();
-      DREAM3D_REQUIRE_EQUAL(0, 1)
+      size_t index[3] = {node % (k_Dims[0] + 1), (node / (k_Dims[0] + 1)) % (k_Dims[1] + 1), node / ((k_Dims[0] + 1) * (k_Dims[1] + 1))};
+      for(size_t axis = 0; axis < 3; axis++)
+      {
+        DREAM3D_REQUIRE(std::abs(coords[3 * node + axis] - (k_Origin[axis] + k_Res[axis] * index[axis])) < 1.0e-6);
+      }
+    }
+
+    // Every element carries the value of its SIMPL cell and starts on the lower corner of that cell
+    for(size_t cell = 0; cell < k_NumCells; cell++)
+    {
+      DREAM3D_REQUIRE_EQUAL(tagValues[cell], cellValues->getValue(cell));
+      const double* corner = coords + 3 * (connectivity[8 * cell] - 1);
+      size_t index[3] = {cell % k_Dims[0], (cell / k_Dims[0]) % k_Dims[1], cell / (k_Dims[0] * k_Dims[1])};
+      for(size_t axis = 0; axis < 3; axis++)
+      {
+        DREAM3D_REQUIRE(std::abs(corner[axis] - (k_Origin[axis] + k_Res[axis] * index[axis])) < 1.0e-6);
+      }
+    }
+
+    // MOAB indexes the box vertices with int, so a box of 1300^3 cells must be rejected. The
+    // arrays are not allocated since only the preflight looks at them.
+    for(size_t dim : {size_t(1200), size_t(1300)})
+    {
+      DoubleArrayType::Pointer largeValues = DoubleArrayType::CreateArray(dim * dim * dim, DataArrayName, false);
+      filter->setDataContainerArray(CreateSyntheticVolume(QVector<size_t>(3, dim), {largeValues}));
+      filter->preflight();
+      DREAM3D_REQUIRE_EQUAL(filter->getErrorCondition(), dim < 1290 ? 0 : -101054);
     }
 
     return EXIT_SUCCESS;
@@ -201,13 +444,2109 @@ class ExportMoabMeshTest
   // -----------------------------------------------------------------------------
   //
   // -----------------------------------------------------------------------------
-  void operator()()
+  vtkSmartPointer<vtkUnstructuredGrid> ReadVtuFile(const QString& filePath)
   {
-    int err = EXIT_SUCCESS;
+    vtkSmartPointer<vtkXMLUnstructuredGridReader> reader = vtkSmartPointer<vtkXMLUnstructuredGridReader>::New();
+    reader->SetFileName(filePath.toLatin1().constData());
+    reader->Update();
+    return reader->GetOutput();
+  }
 
-    DREAM3D_REGISTER_TEST( TestFilterAvailability() );
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  int TestExportStreamingSlabs()
+  {
+    FilterPipeline::Pointer pipeline = FilterPipeline::New();
+    Observer obs;
+    pipeline->addMessageReceiver(&obs);
+    pipeline->pushBack(CreateReader());
 
-    DREAM3D_REGISTER_TEST( TestExportMoabMesh() )
+    AbstractFilter::Pointer filter = CreateExportFilter();
+    DREAM3D_REQUIRE_VALID_POINTER(filter.get());
+    pipeline->pushBack(filter);
+
+    QVariant var;
+    QVector<DataArrayPath> paths = {DataArrayPath(DataContainerName, AttributeMatrixName, DataArrayName)};
+    var.setValue(paths);
+    bool propWasSet = filter->setProperty("SelectedArrayPaths", var);
+    DREAM3D_REQUIRE_EQUAL(propWasSet, true);
+
+    var.setValue(static_cast<int>(ExportMoabMesh::ExportModeType::StreamingSlabs));
+    propWasSet = filter->setProperty("ExportMode", var);
+    DREAM3D_REQUIRE_EQUAL(propWasSet, true);
+
+    // The legacy VTK format cannot be appended to slab by slab
+    var.setValue(UnitTest::ExportMoabMeshTest::VTKOutputFile);
+    propWasSet = filter->setProperty("OutputFile", var);
+    DREAM3D_REQUIRE_EQUAL(propWasSet, true);
+
+    pipeline->preflightPipeline();
+    DREAM3D_REQUIRE_EQUAL(filter->getErrorCondition(), -101011);
+    filter->clearErrorCode();
+
+    var.setValue(UnitTest::ExportMoabMeshTest::StreamingOutputFile);
+    propWasSet = filter->setProperty("OutputFile", var);
+    DREAM3D_REQUIRE_EQUAL(propWasSet, true);
+
+    propWasSet = filter->setProperty("MemoryBudget", 0);
+    DREAM3D_REQUIRE_EQUAL(propWasSet, true);
+
+    pipeline->preflightPipeline();
+    DREAM3D_REQUIRE_EQUAL(filter->getErrorCondition(), -101012);
+    filter->clearErrorCode();
+
+    // A small budget forces the mesh to be written in several slabs
+    propWasSet = filter->setProperty("MemoryBudget", 1);
+    DREAM3D_REQUIRE_EQUAL(propWasSet, true);
+
+    pipeline->preflightPipeline();
+    DREAM3D_REQUIRE_EQUAL(filter->getErrorCondition(), 0);
+    pipeline->execute();
+    DREAM3D_REQUIRE_EQUAL(filter->getErrorCondition(), 0);
+
+    int err = CheckHex8Tag(UnitTest::ExportMoabMeshTest::StreamingOutputFile, DataArrayName + "_");
+    DREAM3D_REQUIRE_EQUAL(err, EXIT_SUCCESS);
+
+    var.setValue(UnitTest::ExportMoabMeshTest::StreamingVtuOutputFile);
+    propWasSet = filter->setProperty("OutputFile", var);
+    DREAM3D_REQUIRE_EQUAL(propWasSet, true);
+
+    pipeline->execute();
+    DREAM3D_REQUIRE_EQUAL(filter->getErrorCondition(), 0);
+    DREAM3D_REQUIRE_EQUAL(QFile::exists(UnitTest::ExportMoabMeshTest::StreamingVtuOutputFile), true);
+
+    // The slabs appended one after the other must read back as the input volume
+    DataContainer::Pointer dc = filter->getDataContainerArray()->getDataContainer(DataContainerName);
+    ImageGeom::Pointer image = dc->getGeometryAs<ImageGeom>();
+    size_t dims[3] = {0, 0, 0};
+    float res[3] = {0.0f, 0.0f, 0.0f};
+    float origin[3] = {0.0f, 0.0f, 0.0f};
+    std::tie(dims[0], dims[1], dims[2]) = image->getDimensions();
+    image->getResolution(res);
+    image->getOrigin(origin);
+    DoubleArrayType::Pointer cellValues = std::dynamic_pointer_cast<DoubleArrayType>(dc->getAttributeMatrix(AttributeMatrixName)->getAttributeArray(DataArrayName));
+    DREAM3D_REQUIRE_VALID_POINTER(cellValues.get());
+
+    vtkSmartPointer<vtkUnstructuredGrid> grid = ReadVtuFile(UnitTest::ExportMoabMeshTest::StreamingVtuOutputFile);
+    const vtkIdType numCells = static_cast<vtkIdType>(dims[0] * dims[1] * dims[2]);
+    DREAM3D_REQUIRE_EQUAL(grid->GetNumberOfPoints(), static_cast<vtkIdType>((dims[0] + 1) * (dims[1] + 1) * (dims[2] + 1)));
+    DREAM3D_REQUIRE_EQUAL(grid->GetNumberOfCells(), numCells);
+    vtkDataArray* vtuValues = grid->GetCellData()->GetArray(DataArrayName.toLatin1().constData());
+    DREAM3D_REQUIRE_VALID_POINTER(vtuValues);
+    DREAM3D_REQUIRE_EQUAL(vtuValues->GetNumberOfTuples(), numCells);
+
+    // The first node of every hexahedron sits on the lower corner of its cell
+    vtkSmartPointer<vtkIdList> pointIds = vtkSmartPointer<vtkIdList>::New();
+    for(vtkIdType cell : {vtkIdType(0), numCells / 3, numCells / 2, numCells - 1})
+    {
+      DREAM3D_REQUIRE_EQUAL(grid->GetCellType(cell), VTK_HEXAHEDRON);
+      DREAM3D_REQUIRE_EQUAL(vtuValues->GetComponent(cell, 0), cellValues->getValue(static_cast<size_t>(cell)));
+
+      grid->GetCellPoints(cell, pointIds);
+      DREAM3D_REQUIRE_EQUAL(pointIds->GetNumberOfIds(), 8);
+      double corner[3] = {0.0, 0.0, 0.0};
+      grid->GetPoint(pointIds->GetId(0), corner);
+      size_t index[3] = {static_cast<size_t>(cell) % dims[0], (static_cast<size_t>(cell) / dims[0]) % dims[1], static_cast<size_t>(cell) / (dims[0] * dims[1])};
+      for(size_t axis = 0; axis < 3; axis++)
+      {
+        DREAM3D_REQUIRE(std::abs(corner[axis] - (origin[axis] + res[axis] * index[axis])) < 1.0e-4);
+      }
+    }
+
+    return EXIT_SUCCESS;
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  int TestExportNativeTypes()
+  {
+    FilterPipeline::Pointer pipeline = FilterPipeline::New();
+    Observer obs;
+    pipeline->addMessageReceiver(&obs);
+    pipeline->pushBack(CreateReader());
+
+    AbstractFilter::Pointer filter = CreateExportFilter();
+    DREAM3D_REQUIRE_VALID_POINTER(filter.get());
+    pipeline->pushBack(filter);
+
+    // The int32 FeatureIds are exported as they are, next to the converted double copy
+    QVector<DataArrayPath> paths = {DataArrayPath(DataContainerName, AttributeMatrixName, DataArrayName), DataArrayPath(DataContainerName, AttributeMatrixName, ErrorDataArrayName)};
+    QVariant var;
+    var.setValue(paths);
+    bool propWasSet = filter->setProperty("SelectedArrayPaths", var);
+    DREAM3D_REQUIRE_EQUAL(propWasSet, true);
+
+    var.setValue(UnitTest::ExportMoabMeshTest::TypesOutputFile);
+    propWasSet = filter->setProperty("OutputFile", var);
+    DREAM3D_REQUIRE_EQUAL(propWasSet, true);
+
+    pipeline->preflightPipeline();
+    DREAM3D_REQUIRE_EQUAL(filter->getErrorCondition(), 0);
+    pipeline->execute();
+    DREAM3D_REQUIRE_EQUAL(filter->getErrorCondition(), 0);
+
+    int err = CheckHex8Tag(UnitTest::ExportMoabMeshTest::TypesOutputFile, DataArrayName + "_", H5T_FLOAT, sizeof(double));
+    DREAM3D_REQUIRE_EQUAL(err, EXIT_SUCCESS);
+    err = CheckHex8Tag(UnitTest::ExportMoabMeshTest::TypesOutputFile, ErrorDataArrayName + "_", H5T_INTEGER, sizeof(int32_t));
+    DREAM3D_REQUIRE_EQUAL(err, EXIT_SUCCESS);
+
+    // Every other type is an opaque tag for MOAB, which the structured box writes with the
+    // __hdf5_tag_type_ hint and the native writer with its own HDF5 type. Both must keep the
+    // type, the width, the components and the values.
+    const size_t k_Dims[3] = {4, 3, 2};
+    const size_t k_NumCells = k_Dims[0] * k_Dims[1] * k_Dims[2];
+    Int8ArrayType::Pointer int8s = Int8ArrayType::CreateArray(k_NumCells, "Int8Values");
+    UInt8ArrayType::Pointer uint8s = UInt8ArrayType::CreateArray(k_NumCells, "UInt8Values");
+    Int64ArrayType::Pointer int64s = Int64ArrayType::CreateArray(k_NumCells, "Int64Values");
+    UInt64ArrayType::Pointer uint64s = UInt64ArrayType::CreateArray(k_NumCells, "UInt64Values");
+    FloatArrayType::Pointer floats = FloatArrayType::CreateArray(k_NumCells, "FloatValues");
+    UInt16ArrayType::Pointer vectors = UInt16ArrayType::CreateArray(k_NumCells, std::vector<size_t>(1, 3), "UInt16Vectors", true);
+    for(size_t i = 0; i < k_NumCells; i++)
+    {
+      int8s->setValue(i, static_cast<int8_t>(static_cast<int>(i) - 12));
+      uint8s->setValue(i, static_cast<uint8_t>(200 + i));
+      int64s->setValue(i, -(int64_t(1) << 40) + static_cast<int64_t>(i));
+      uint64s->setValue(i, (uint64_t(1) << 63) + static_cast<uint64_t>(i));
+      floats->setValue(i, 0.25f * static_cast<float>(i) - 1.0f);
+      for(size_t c = 0; c < 3; c++)
+      {
+        vectors->setValue(3 * i + c, static_cast<uint16_t>(60000 + 1000 * c + i));
+      }
+    }
+    struct ExpectedTag
+    {
+      IDataArray::Pointer array;
+      hid_t type;
+      size_t size;
+    };
+    const std::vector<ExpectedTag> expectedTags = {{int8s, H5T_NATIVE_INT8, sizeof(int8_t)},       {uint8s, H5T_NATIVE_UINT8, sizeof(uint8_t)},
+                                                   {int64s, H5T_NATIVE_INT64, sizeof(int64_t)},    {uint64s, H5T_NATIVE_UINT64, sizeof(uint64_t)},
+                                                   {floats, H5T_NATIVE_FLOAT, sizeof(float)},      {vectors, H5T_NATIVE_UINT16, sizeof(uint16_t)}};
+    QVector<IDataArray::Pointer> arrays;
+    paths.clear();
+    for(const ExpectedTag& expected : expectedTags)
+    {
+      arrays.push_back(expected.array);
+      paths.push_back(DataArrayPath(DataContainerName, AttributeMatrixName, expected.array->getName()));
+    }
+    filter->setDataContainerArray(CreateSyntheticVolume({k_Dims[0], k_Dims[1], k_Dims[2]}, arrays));
+    var.setValue(paths);
+    filter->setProperty("SelectedArrayPaths", var);
+
+    const std::vector<std::pair<ExportMoabMesh::ExportModeType, QString>> outputs = {
+        {ExportMoabMesh::ExportModeType::StructuredBox, UnitTest::ExportMoabMeshTest::StructuredTypesOutputFile},
+        {ExportMoabMesh::ExportModeType::ExplicitHex, UnitTest::ExportMoabMeshTest::NativeTypesOutputFile}};
+    for(const std::pair<ExportMoabMesh::ExportModeType, QString>& output : outputs)
+    {
+      filter->setProperty("ExportMode", static_cast<int>(output.first));
+      var.setValue(output.second);
+      filter->setProperty("OutputFile", var);
+      filter->execute();
+      DREAM3D_REQUIRE_EQUAL(filter->getErrorCondition(), 0);
+
+      for(const ExpectedTag& expected : expectedTags)
+      {
+        err = CheckTagDataset(output.second, "/tstt/elements/Hex8/tags/" + expected.array->getName() + "_", expected.array, expected.type, expected.size);
+        DREAM3D_REQUIRE_EQUAL(err, EXIT_SUCCESS);
+      }
+    }
+
+    return EXIT_SUCCESS;
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  int CheckTagDataset(const QString& filePath, const QString& datasetPath, const IDataArray::Pointer& array, hid_t componentType, size_t componentSize)
+  {
+    hid_t fileId = QH5Utilities::openFile(filePath, true);
+    DREAM3D_REQUIRE(fileId >= 0);
+    H5ScopedFileSentinel sentinel(&fileId, true);
+
+    // One row per element, with the components of a tuple held in an HDF5 array type
+    hid_t dataId = H5Dopen2(fileId, datasetPath.toLatin1().constData(), H5P_DEFAULT);
+    DREAM3D_REQUIRE(dataId >= 0);
+    hid_t spaceId = H5Dget_space(dataId);
+    hsize_t dims[2] = {0, 0};
+    int rank = H5Sget_simple_extent_dims(spaceId, dims, nullptr);
+    H5Sclose(spaceId);
+    hid_t typeId = H5Dget_type(dataId);
+    H5Dclose(dataId);
+    DREAM3D_REQUIRE_EQUAL(rank, 1);
+    DREAM3D_REQUIRE_EQUAL(dims[0], array->getNumberOfTuples());
+
+    const int numComponents = array->getNumberOfComponents();
+    hid_t baseTypeId = typeId;
+    if(numComponents > 1)
+    {
+      DREAM3D_REQUIRE_EQUAL(H5Tget_class(typeId), H5T_ARRAY);
+      DREAM3D_REQUIRE_EQUAL(H5Tget_array_ndims(typeId), 1);
+      hsize_t arrayDims[1] = {0};
+      H5Tget_array_dims2(typeId, arrayDims);
+      DREAM3D_REQUIRE_EQUAL(arrayDims[0], static_cast<hsize_t>(numComponents));
+      baseTypeId = H5Tget_super(typeId);
+    }
+    H5T_class_t baseClass = H5Tget_class(baseTypeId);
+    size_t baseSize = H5Tget_size(baseTypeId);
+    bool sameType = H5Tequal(baseTypeId, componentType) > 0;
+    if(baseTypeId != typeId)
+    {
+      H5Tclose(baseTypeId);
+    }
+    H5Tclose(typeId);
+    DREAM3D_REQUIRE_EQUAL(baseClass, H5Tget_class(componentType));
+    DREAM3D_REQUIRE_EQUAL(baseSize, componentSize);
+    DREAM3D_REQUIRE_EQUAL(sameType, true);
+
+    std::vector<uint8_t> values;
+    DREAM3D_REQUIRE_EQUAL(ReadDataset(filePath, datasetPath, values), true);
+    DREAM3D_REQUIRE_EQUAL(values.size(), array->getSize() * componentSize);
+    DREAM3D_REQUIRE(std::memcmp(values.data(), array->getVoidPointer(0), values.size()) == 0);
+
+    return EXIT_SUCCESS;
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  int TestExportFeatureSets()
+  {
+    FilterPipeline::Pointer pipeline = FilterPipeline::New();
+    Observer obs;
+    pipeline->addMessageReceiver(&obs);
+    pipeline->pushBack(CreateReader());
+
+    AbstractFilter::Pointer filter = CreateExportFilter();
+    DREAM3D_REQUIRE_VALID_POINTER(filter.get());
+    pipeline->pushBack(filter);
+
+    QVector<DataArrayPath> paths = {DataArrayPath(DataContainerName, AttributeMatrixName, DataArrayName)};
+    QVariant var;
+    var.setValue(paths);
+    bool propWasSet = filter->setProperty("SelectedArrayPaths", var);
+    DREAM3D_REQUIRE_EQUAL(propWasSet, true);
+
+    propWasSet = filter->setProperty("WriteFeatureSets", true);
+    DREAM3D_REQUIRE_EQUAL(propWasSet, true);
+
+    var.setValue(DataArrayPath(DataContainerName, AttributeMatrixName, ErrorDataArrayName));
+    propWasSet = filter->setProperty("FeatureIdsArrayPath", var);
+    DREAM3D_REQUIRE_EQUAL(propWasSet, true);
+
+    // Meshsets have no counterpart in the VTK formats
+    var.setValue(UnitTest::ExportMoabMeshTest::VTKOutputFile);
+    propWasSet = filter->setProperty("OutputFile", var);
+    DREAM3D_REQUIRE_EQUAL(propWasSet, true);
+
+    pipeline->preflightPipeline();
+    DREAM3D_REQUIRE_EQUAL(filter->getErrorCondition(), -101018);
+    filter->clearErrorCode();
+
+    var.setValue(UnitTest::ExportMoabMeshTest::FeatureSetsOutputFile);
+    propWasSet = filter->setProperty("OutputFile", var);
+    DREAM3D_REQUIRE_EQUAL(propWasSet, true);
+
+    pipeline->preflightPipeline();
+    DREAM3D_REQUIRE_EQUAL(filter->getErrorCondition(), 0);
+    pipeline->execute();
+    DREAM3D_REQUIRE_EQUAL(filter->getErrorCondition(), 0);
+
+    int err = CheckHex8Tag(UnitTest::ExportMoabMeshTest::FeatureSetsOutputFile, DataArrayName + "_");
+    DREAM3D_REQUIRE_EQUAL(err, EXIT_SUCCESS);
+
+    // Every set is tagged with its Feature Id
+    hid_t fileId = QH5Utilities::openFile(UnitTest::ExportMoabMeshTest::FeatureSetsOutputFile, true);
+    DREAM3D_REQUIRE(fileId >= 0);
+    H5ScopedFileSentinel sentinel(&fileId, true);
+
+    QVector<hsize_t> setDims;
+    H5T_class_t classType;
+    size_t sizeType;
+    herr_t infoId = QH5Lite::getDatasetInfo(fileId, "/tstt/sets/list", setDims, classType, sizeType);
+    DREAM3D_REQUIRE(infoId >= 0);
+    DREAM3D_REQUIRE_EQUAL(setDims.size(), 2);
+    DREAM3D_REQUIRE_EQUAL(setDims[1], 4);
+    DREAM3D_REQUIRE(setDims[0] > 0);
+
+    QVector<hsize_t> tagDims;
+    infoId = QH5Lite::getDatasetInfo(fileId, "/tstt/tags/MATERIAL_SET/values", tagDims, classType, sizeType);
+    DREAM3D_REQUIRE(infoId >= 0);
+    DREAM3D_REQUIRE_EQUAL(tagDims[0], setDims[0]);
+
+    return EXIT_SUCCESS;
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  int TestExportFeatureBoundaries()
+  {
+    // Feature 1 fills the cells with X < 2 and Feature 2 the others, so the surface is the
+    // outside of the 4 x 3 x 2 volume plus one 3 x 2 wall between the Features
+    const size_t k_Dims[3] = {4, 3, 2};
+    const size_t k_NumCells = k_Dims[0] * k_Dims[1] * k_Dims[2];
+    Int32ArrayType::Pointer featureIds = Int32ArrayType::CreateArray(k_NumCells, ErrorDataArrayName);
+    for(size_t i = 0; i < k_NumCells; i++)
+    {
+      featureIds->setValue(i, (i % k_Dims[0]) < 2 ? 1 : 2);
+    }
+    DataContainerArray::Pointer dca = CreateSyntheticVolume({k_Dims[0], k_Dims[1], k_Dims[2]}, {featureIds});
+
+    AbstractFilter::Pointer filter = CreateExportFilter();
+    DREAM3D_REQUIRE_VALID_POINTER(filter.get());
+    filter->setDataContainerArray(dca);
+
+    // The surface is built from the Feature Ids alone, so no arrays need to be selected
+    QVariant var;
+    var.setValue(static_cast<int>(ExportMoabMesh::ExportModeType::FeatureBoundaries));
+    bool propWasSet = filter->setProperty("ExportMode", var);
+    DREAM3D_REQUIRE_EQUAL(propWasSet, true);
+
+    var.setValue(DataArrayPath(DataContainerName, AttributeMatrixName, ErrorDataArrayName));
+    propWasSet = filter->setProperty("FeatureIdsArrayPath", var);
+    DREAM3D_REQUIRE_EQUAL(propWasSet, true);
+
+    var.setValue(UnitTest::ExportMoabMeshTest::VTKOutputFile);
+    propWasSet = filter->setProperty("OutputFile", var);
+    DREAM3D_REQUIRE_EQUAL(propWasSet, true);
+
+    filter->preflight();
+    DREAM3D_REQUIRE_EQUAL(filter->getErrorCondition(), -101022);
+
+    var.setValue(UnitTest::ExportMoabMeshTest::BoundaryOutputFile);
+    propWasSet = filter->setProperty("OutputFile", var);
+    DREAM3D_REQUIRE_EQUAL(propWasSet, true);
+
+    filter->execute();
+    DREAM3D_REQUIRE_EQUAL(filter->getErrorCondition(), 0);
+
+    // 52 faces on the outside and 6 in the wall. Every node of the 5 x 4 x 3 grid is used
+    // except the 6 inside the volume, of which the 2 in the wall come back.
+    const size_t k_NumQuads = 58;
+    const size_t k_NumNodes = 56;
+    std::vector<uint8_t> coordBytes;
+    std::vector<uint8_t> connectivityBytes;
+    std::vector<uint8_t> leftBytes;
+    std::vector<uint8_t> rightBytes;
+    const QString path = UnitTest::ExportMoabMeshTest::BoundaryOutputFile;
+    DREAM3D_REQUIRE_EQUAL(ReadDataset(path, "/tstt/nodes/coordinates", coordBytes), true);
+    DREAM3D_REQUIRE_EQUAL(ReadDataset(path, "/tstt/elements/Quad4/connectivity", connectivityBytes), true);
+    DREAM3D_REQUIRE_EQUAL(ReadDataset(path, "/tstt/elements/Quad4/tags/LeftFeatureId", leftBytes), true);
+    DREAM3D_REQUIRE_EQUAL(ReadDataset(path, "/tstt/elements/Quad4/tags/RightFeatureId", rightBytes), true);
+    DREAM3D_REQUIRE_EQUAL(coordBytes.size(), k_NumNodes * 3 * sizeof(double));
+    DREAM3D_REQUIRE_EQUAL(connectivityBytes.size(), k_NumQuads * 4 * sizeof(int64_t));
+    DREAM3D_REQUIRE_EQUAL(leftBytes.size(), k_NumQuads * sizeof(int32_t));
+    DREAM3D_REQUIRE_EQUAL(rightBytes.size(), k_NumQuads * sizeof(int32_t));
+    const double* coords = reinterpret_cast<const double*>(coordBytes.data());
+    const int64_t* connectivity = reinterpret_cast<const int64_t*>(connectivityBytes.data());
+    const int32_t* leftIds = reinterpret_cast<const int32_t*>(leftBytes.data());
+    const int32_t* rightIds = reinterpret_cast<const int32_t*>(rightBytes.data());
+
+    // Faces are found by their centers. The left side of a face is the one towards lower
+    // coordinates, and the outside of the volume is -1.
+    struct ExpectedFace
+    {
+      double center[3];
+      int32_t left;
+      int32_t right;
+    };
+    const std::vector<ExpectedFace> expectedFaces = {{{2.0, 0.5, 0.5}, 1, 2}, {{2.0, 2.5, 1.5}, 1, 2}, {{0.0, 1.5, 0.5}, -1, 1}, {{4.0, 0.5, 1.5}, 2, -1},
+                                                     {{1.5, 0.0, 0.5}, -1, 1}, {{3.5, 3.0, 1.5}, 2, -1}, {{0.5, 2.5, 2.0}, 1, -1}, {{2.5, 1.5, 0.0}, -1, 2}};
+    for(const ExpectedFace& expected : expectedFaces)
+    {
+      size_t numFound = 0;
+      for(size_t q = 0; q < k_NumQuads; q++)
+      {
+        double center[3] = {0.0, 0.0, 0.0};
+        for(size_t n = 0; n < 4; n++)
+        {
+          const double* node = coords + 3 * (connectivity[4 * q + n] - 1);
+          for(size_t axis = 0; axis < 3; axis++)
+          {
+            center[axis] += 0.25 * node[axis];
+          }
+        }
+        if(center[0] == expected.center[0] && center[1] == expected.center[1] && center[2] == expected.center[2])
+        {
+          DREAM3D_REQUIRE_EQUAL(leftIds[q], expected.left);
+          DREAM3D_REQUIRE_EQUAL(rightIds[q], expected.right);
+          numFound++;
+        }
+      }
+      DREAM3D_REQUIRE_EQUAL(numFound, 1);
+    }
+
+    // The vtu file holds the same quads and Feature Ids
+    var.setValue(UnitTest::ExportMoabMeshTest::BoundaryVtuOutputFile);
+    propWasSet = filter->setProperty("OutputFile", var);
+    DREAM3D_REQUIRE_EQUAL(propWasSet, true);
+
+    filter->execute();
+    DREAM3D_REQUIRE_EQUAL(filter->getErrorCondition(), 0);
+
+    vtkSmartPointer<vtkUnstructuredGrid> grid = ReadVtuFile(UnitTest::ExportMoabMeshTest::BoundaryVtuOutputFile);
+    DREAM3D_REQUIRE_EQUAL(grid->GetNumberOfPoints(), static_cast<vtkIdType>(k_NumNodes));
+    DREAM3D_REQUIRE_EQUAL(grid->GetNumberOfCells(), static_cast<vtkIdType>(k_NumQuads));
+    vtkDataArray* vtuLeftIds = grid->GetCellData()->GetArray("LeftFeatureId");
+    vtkDataArray* vtuRightIds = grid->GetCellData()->GetArray("RightFeatureId");
+    DREAM3D_REQUIRE_VALID_POINTER(vtuLeftIds);
+    DREAM3D_REQUIRE_VALID_POINTER(vtuRightIds);
+    vtkSmartPointer<vtkIdList> pointIds = vtkSmartPointer<vtkIdList>::New();
+    for(size_t q = 0; q < k_NumQuads; q++)
+    {
+      vtkIdType cell = static_cast<vtkIdType>(q);
+      DREAM3D_REQUIRE_EQUAL(grid->GetCellType(cell), VTK_QUAD);
+      DREAM3D_REQUIRE_EQUAL(static_cast<int32_t>(vtuLeftIds->GetComponent(cell, 0)), leftIds[q]);
+      DREAM3D_REQUIRE_EQUAL(static_cast<int32_t>(vtuRightIds->GetComponent(cell, 0)), rightIds[q]);
+      grid->GetCellPoints(cell, pointIds);
+      DREAM3D_REQUIRE_EQUAL(pointIds->GetNumberOfIds(), 4);
+      for(vtkIdType n = 0; n < 4; n++)
+      {
+        double point[3] = {0.0, 0.0, 0.0};
+        grid->GetPoint(pointIds->GetId(n), point);
+        const double* node = coords + 3 * (connectivity[4 * q + n] - 1);
+        DREAM3D_REQUIRE(point[0] == node[0] && point[1] == node[1] && point[2] == node[2]);
+      }
+    }
+
+    return EXIT_SUCCESS;
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  int TestExportRegionOfInterest()
+  {
+    FilterPipeline::Pointer pipeline = FilterPipeline::New();
+    Observer obs;
+    pipeline->addMessageReceiver(&obs);
+    pipeline->pushBack(CreateReader());
+
+    AbstractFilter::Pointer filter = CreateExportFilter();
+    DREAM3D_REQUIRE_VALID_POINTER(filter.get());
+    pipeline->pushBack(filter);
+
+    QVector<DataArrayPath> paths = {DataArrayPath(DataContainerName, AttributeMatrixName, DataArrayName)};
+    QVariant var;
+    var.setValue(paths);
+    bool propWasSet = filter->setProperty("SelectedArrayPaths", var);
+    DREAM3D_REQUIRE_EQUAL(propWasSet, true);
+
+    var.setValue(UnitTest::ExportMoabMeshTest::CropOutputFile);
+    propWasSet = filter->setProperty("OutputFile", var);
+    DREAM3D_REQUIRE_EQUAL(propWasSet, true);
+
+    propWasSet = filter->setProperty("CropToRegion", true);
+    DREAM3D_REQUIRE_EQUAL(propWasSet, true);
+
+    // Min above Max
+    filter->setProperty("XMin", 4);
+    filter->setProperty("XMax", 1);
+    pipeline->preflightPipeline();
+    DREAM3D_REQUIRE_EQUAL(filter->getErrorCondition(), -101025);
+    filter->clearErrorCode();
+
+    // A 4 x 3 x 2 block away from every side of the volume
+    filter->setProperty("XMin", 1);
+    filter->setProperty("XMax", 4);
+    filter->setProperty("YMin", 1);
+    filter->setProperty("YMax", 3);
+    filter->setProperty("ZMin", 2);
+    filter->setProperty("ZMax", 3);
+    pipeline->preflightPipeline();
+    DREAM3D_REQUIRE_EQUAL(filter->getErrorCondition(), 0);
+    pipeline->execute();
+    DREAM3D_REQUIRE_EQUAL(filter->getErrorCondition(), 0);
+
+    int err = CheckHex8Tag(UnitTest::ExportMoabMeshTest::CropOutputFile, DataArrayName + "_");
+    DREAM3D_REQUIRE_EQUAL(err, EXIT_SUCCESS);
+
+    hid_t fileId = QH5Utilities::openFile(UnitTest::ExportMoabMeshTest::CropOutputFile, true);
+    DREAM3D_REQUIRE(fileId >= 0);
+    H5ScopedFileSentinel sentinel(&fileId, true);
+
+    QVector<hsize_t> dims;
+    H5T_class_t classType;
+    size_t sizeType;
+    herr_t infoId = QH5Lite::getDatasetInfo(fileId, "/tstt/elements/Hex8/connectivity", dims, classType, sizeType);
+    DREAM3D_REQUIRE(infoId >= 0);
+    DREAM3D_REQUIRE_EQUAL(dims[0], 24);
+    infoId = QH5Lite::getDatasetInfo(fileId, "/tstt/nodes/coordinates", dims, classType, sizeType);
+    DREAM3D_REQUIRE(infoId >= 0);
+    DREAM3D_REQUIRE_EQUAL(dims[0], 60);
+
+    // The SMTK path wraps the region through the VTK bridge
+    var.setValue(UnitTest::ExportMoabMeshTest::CropVTKOutputFile);
+    propWasSet = filter->setProperty("OutputFile", var);
+    DREAM3D_REQUIRE_EQUAL(propWasSet, true);
+
+    pipeline->execute();
+    DREAM3D_REQUIRE_EQUAL(filter->getErrorCondition(), 0);
+    DREAM3D_REQUIRE_EQUAL(QFile::exists(UnitTest::ExportMoabMeshTest::CropVTKOutputFile), true);
+
+    return EXIT_SUCCESS;
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  int TestExportCoarsenedOctree()
+  {
+    // Feature 1 fills the 4^3 cells with X < 4, and Features 2 and 3 share the other half in
+    // slices two cells thick. With leaves of up to 4 cells the left half is one leaf and the
+    // right half eight leaves of 2 cells.
+    const size_t k_Dims[3] = {8, 4, 4};
+    const size_t k_NumCells = k_Dims[0] * k_Dims[1] * k_Dims[2];
+    Int32ArrayType::Pointer featureIds = Int32ArrayType::CreateArray(k_NumCells, ErrorDataArrayName);
+    for(size_t i = 0; i < k_NumCells; i++)
+    {
+      size_t x = i % k_Dims[0];
+      featureIds->setValue(i, x < 4 ? 1 : (x < 6 ? 2 : 3));
+    }
+    DataContainerArray::Pointer dca = CreateSyntheticVolume({k_Dims[0], k_Dims[1], k_Dims[2]}, {featureIds});
+
+    AbstractFilter::Pointer filter = CreateExportFilter();
+    DREAM3D_REQUIRE_VALID_POINTER(filter.get());
+    filter->setDataContainerArray(dca);
+
+    QVector<DataArrayPath> paths = {DataArrayPath(DataContainerName, AttributeMatrixName, ErrorDataArrayName)};
+    QVariant var;
+    var.setValue(paths);
+    bool propWasSet = filter->setProperty("SelectedArrayPaths", var);
+    DREAM3D_REQUIRE_EQUAL(propWasSet, true);
+
+    var.setValue(DataArrayPath(DataContainerName, AttributeMatrixName, ErrorDataArrayName));
+    propWasSet = filter->setProperty("FeatureIdsArrayPath", var);
+    DREAM3D_REQUIRE_EQUAL(propWasSet, true);
+
+    propWasSet = filter->setProperty("ExportMode", static_cast<int>(ExportMoabMesh::ExportModeType::CoarsenedOctree));
+    DREAM3D_REQUIRE_EQUAL(propWasSet, true);
+
+    // Hanging node constraints have no counterpart in the VTK formats
+    var.setValue(UnitTest::ExportMoabMeshTest::VTKOutputFile);
+    propWasSet = filter->setProperty("OutputFile", var);
+    DREAM3D_REQUIRE_EQUAL(propWasSet, true);
+
+    filter->preflight();
+    DREAM3D_REQUIRE_EQUAL(filter->getErrorCondition(), -101026);
+
+    var.setValue(UnitTest::ExportMoabMeshTest::OctreeOutputFile);
+    propWasSet = filter->setProperty("OutputFile", var);
+    DREAM3D_REQUIRE_EQUAL(propWasSet, true);
+
+    filter->setProperty("MaxOctreeLevel", 0);
+    filter->preflight();
+    DREAM3D_REQUIRE_EQUAL(filter->getErrorCondition(), -101027);
+
+    filter->setProperty("MaxOctreeLevel", 2);
+    filter->execute();
+    DREAM3D_REQUIRE_EQUAL(filter->getErrorCondition(), 0);
+
+    int err = CheckHex8Tag(UnitTest::ExportMoabMeshTest::OctreeOutputFile, ErrorDataArrayName + "_", H5T_INTEGER, sizeof(int32_t));
+    DREAM3D_REQUIRE_EQUAL(err, EXIT_SUCCESS);
+
+    // The large leaf has 8 corners and the small leaves a 3 x 3 x 3 grid of nodes, 4 of which
+    // are corners of the large leaf too
+    std::vector<uint8_t> coordBytes;
+    std::vector<uint8_t> connectivityBytes;
+    std::vector<uint8_t> hangingIdBytes;
+    std::vector<uint8_t> parentBytes;
+    const QString path = UnitTest::ExportMoabMeshTest::OctreeOutputFile;
+    DREAM3D_REQUIRE_EQUAL(ReadDataset(path, "/tstt/nodes/coordinates", coordBytes), true);
+    DREAM3D_REQUIRE_EQUAL(ReadDataset(path, "/tstt/elements/Hex8/connectivity", connectivityBytes), true);
+    DREAM3D_REQUIRE_EQUAL(ReadDataset(path, "/tstt/tags/HangingNodeParents/id_list", hangingIdBytes), true);
+    DREAM3D_REQUIRE_EQUAL(ReadDataset(path, "/tstt/tags/HangingNodeParents/values", parentBytes), true);
+    DREAM3D_REQUIRE_EQUAL(connectivityBytes.size(), 9 * 8 * sizeof(int64_t));
+    DREAM3D_REQUIRE_EQUAL(coordBytes.size(), 31 * 3 * sizeof(double));
+
+    // The small leaves meet the large one at X = 4. The middle of its face and the middles
+    // of its four edges hang.
+    const size_t k_NumHangingNodes = 5;
+    DREAM3D_REQUIRE_EQUAL(hangingIdBytes.size(), k_NumHangingNodes * sizeof(int64_t));
+    DREAM3D_REQUIRE_EQUAL(parentBytes.size(), k_NumHangingNodes * 4 * sizeof(int64_t));
+    const double* coords = reinterpret_cast<const double*>(coordBytes.data());
+    const int64_t* hangingIds = reinterpret_cast<const int64_t*>(hangingIdBytes.data());
+    const int64_t* parents = reinterpret_cast<const int64_t*>(parentBytes.data());
+    auto isNodeAt = [coords](int64_t fileId, double x, double y, double z) {
+      const double* node = coords + 3 * (fileId - 1);
+      return node[0] == x && node[1] == y && node[2] == z;
+    };
+
+    // The face center is tied to the four corners of the face, an edge middle to the two
+    // ends of the edge with the unused parents left 0
+    size_t numChecked = 0;
+    for(size_t h = 0; h < k_NumHangingNodes; h++)
+    {
+      const int64_t* nodeParents = parents + 4 * h;
+      if(isNodeAt(hangingIds[h], 4.0, 2.0, 2.0))
+      {
+        DREAM3D_REQUIRE(isNodeAt(nodeParents[0], 4.0, 0.0, 0.0));
+        DREAM3D_REQUIRE(isNodeAt(nodeParents[1], 4.0, 4.0, 0.0));
+        DREAM3D_REQUIRE(isNodeAt(nodeParents[2], 4.0, 4.0, 4.0));
+        DREAM3D_REQUIRE(isNodeAt(nodeParents[3], 4.0, 0.0, 4.0));
+        numChecked++;
+      }
+      else if(isNodeAt(hangingIds[h], 4.0, 2.0, 0.0))
+      {
+        DREAM3D_REQUIRE(isNodeAt(nodeParents[0], 4.0, 0.0, 0.0));
+        DREAM3D_REQUIRE(isNodeAt(nodeParents[1], 4.0, 4.0, 0.0));
+        DREAM3D_REQUIRE_EQUAL(nodeParents[2], 0);
+        DREAM3D_REQUIRE_EQUAL(nodeParents[3], 0);
+        numChecked++;
+      }
+    }
+    DREAM3D_REQUIRE_EQUAL(numChecked, 2);
+
+    return EXIT_SUCCESS;
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  bool IsChunked(const QString& filePath, const QString& datasetPath)
+  {
+    hid_t fileId = QH5Utilities::openFile(filePath, true);
+    if(fileId < 0)
+    {
+      return false;
+    }
+    H5ScopedFileSentinel sentinel(&fileId, true);
+
+    hid_t dataId = H5Dopen2(fileId, datasetPath.toLatin1().constData(), H5P_DEFAULT);
+    if(dataId < 0)
+    {
+      return false;
+    }
+    hid_t propsId = H5Dget_create_plist(dataId);
+    bool chunked = (H5Pget_layout(propsId) == H5D_CHUNKED);
+    H5Pclose(propsId);
+    H5Dclose(dataId);
+    return chunked;
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  int TestExportCompressed()
+  {
+    FilterPipeline::Pointer pipeline = FilterPipeline::New();
+    Observer obs;
+    pipeline->addMessageReceiver(&obs);
+    pipeline->pushBack(CreateReader());
+
+    AbstractFilter::Pointer filter = CreateExportFilter();
+    DREAM3D_REQUIRE_VALID_POINTER(filter.get());
+    pipeline->pushBack(filter);
+
+    QVector<DataArrayPath> paths = {DataArrayPath(DataContainerName, AttributeMatrixName, DataArrayName)};
+    QVariant var;
+    var.setValue(paths);
+    bool propWasSet = filter->setProperty("SelectedArrayPaths", var);
+    DREAM3D_REQUIRE_EQUAL(propWasSet, true);
+
+    var.setValue(UnitTest::ExportMoabMeshTest::CompressedOutputFile);
+    propWasSet = filter->setProperty("OutputFile", var);
+    DREAM3D_REQUIRE_EQUAL(propWasSet, true);
+
+    propWasSet = filter->setProperty("CompressOutput", true);
+    DREAM3D_REQUIRE_EQUAL(propWasSet, true);
+
+    filter->setProperty("ChunkSize", 0);
+    pipeline->preflightPipeline();
+    DREAM3D_REQUIRE_EQUAL(filter->getErrorCondition(), -101028);
+    filter->clearErrorCode();
+    filter->setProperty("ChunkSize", 4096);
+
+    filter->setProperty("DeflateLevel", 10);
+    pipeline->preflightPipeline();
+    DREAM3D_REQUIRE_EQUAL(filter->getErrorCondition(), -101029);
+    filter->clearErrorCode();
+    filter->setProperty("DeflateLevel", 6);
+
+    // Ids from 32768 up are reserved for third party filters, so this one is never registered
+    filter->setProperty("Hdf5FilterId", 65535);
+    pipeline->preflightPipeline();
+    DREAM3D_REQUIRE_EQUAL(filter->getErrorCondition(), -101030);
+    filter->clearErrorCode();
+    filter->setProperty("Hdf5FilterId", 0);
+
+    pipeline->preflightPipeline();
+    DREAM3D_REQUIRE_EQUAL(filter->getErrorCondition(), 0);
+    pipeline->execute();
+    DREAM3D_REQUIRE_EQUAL(filter->getErrorCondition(), 0);
+
+    int err = CheckHex8Tag(UnitTest::ExportMoabMeshTest::CompressedOutputFile, DataArrayName + "_");
+    DREAM3D_REQUIRE_EQUAL(err, EXIT_SUCCESS);
+    DREAM3D_REQUIRE_EQUAL(IsChunked(UnitTest::ExportMoabMeshTest::CompressedOutputFile, "/tstt/elements/Hex8/connectivity"), true);
+    DREAM3D_REQUIRE_EQUAL(IsChunked(UnitTest::ExportMoabMeshTest::CompressedOutputFile, "/tstt/elements/Hex8/tags/" + DataArrayName + "_"), true);
+
+    // MOAB and SMTK write their own datasets, so the settings are ignored with a warning
+    var.setValue(UnitTest::ExportMoabMeshTest::VTKOutputFile);
+    propWasSet = filter->setProperty("OutputFile", var);
+    DREAM3D_REQUIRE_EQUAL(propWasSet, true);
+    pipeline->preflightPipeline();
+    DREAM3D_REQUIRE_EQUAL(filter->getErrorCondition(), 0);
+    DREAM3D_REQUIRE_EQUAL(filter->getWarningCondition(), -101031);
+
+    return EXIT_SUCCESS;
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  DataContainerArray::Pointer CreateSyntheticVolume(const QVector<size_t>& dims, const QVector<IDataArray::Pointer>& arrays)
+  {
+    DataContainerArray::Pointer dca = DataContainerArray::New();
+    DataContainer::Pointer dc = DataContainer::New(DataContainerName);
+    ImageGeom::Pointer image = ImageGeom::CreateGeometry(SIMPL::Geometry::ImageGeometry);
+    image->setDimensions(dims[0], dims[1], dims[2]);
+    dc->setGeometry(image);
+    dca->addDataContainer(dc);
+
+    AttributeMatrix::Pointer am = AttributeMatrix::New(dims, AttributeMatrixName, AttributeMatrix::Type::Cell);
+    dc->addAttributeMatrix(AttributeMatrixName, am);
+    for(const IDataArray::Pointer& array : arrays)
+    {
+      am->addAttributeArray(array->getName(), array);
+    }
+
+    return dca;
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  DataContainerArray::Pointer CreateSyntheticVolume(size_t dim, size_t grainSize)
+  {
+    // Cubic grains with scattered ids, and a noise array that barely compresses
+    size_t numCells = dim * dim * dim;
+    Int32ArrayType::Pointer featureIds = Int32ArrayType::CreateArray(numCells, ErrorDataArrayName);
+    FloatArrayType::Pointer noise = FloatArrayType::CreateArray(numCells, NoiseDataArrayName);
+    size_t grainsPerSide = (dim + grainSize - 1) / grainSize;
+    uint32_t state = 12345;
+    for(size_t z = 0; z < dim; z++)
+    {
+      for(size_t y = 0; y < dim; y++)
+      {
+        for(size_t x = 0; x < dim; x++)
+        {
+          size_t index = (z * dim + y) * dim + x;
+          size_t grain = ((z / grainSize) * grainsPerSide + y / grainSize) * grainsPerSide + x / grainSize;
+          featureIds->setValue(index, static_cast<int32_t>((grain * 2654435761u) % 100000));
+          state = state * 1664525u + 1013904223u;
+          noise->setValue(index, static_cast<float>(state >> 8) / 16777216.0f);
+        }
+      }
+    }
+
+    return CreateSyntheticVolume(QVector<size_t>(3, dim), {featureIds, noise});
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  bool ReadDataset(const QString& filePath, const QString& datasetPath, std::vector<uint8_t>& values)
+  {
+    hid_t fileId = QH5Utilities::openFile(filePath, true);
+    if(fileId < 0)
+    {
+      return false;
+    }
+    H5ScopedFileSentinel sentinel(&fileId, true);
+
+    hid_t dataId = H5Dopen2(fileId, datasetPath.toLatin1().constData(), H5P_DEFAULT);
+    if(dataId < 0)
+    {
+      return false;
+    }
+    hid_t fileTypeId = H5Dget_type(dataId);
+    hid_t memTypeId = H5Tget_native_type(fileTypeId, H5T_DIR_ASCEND);
+    hid_t spaceId = H5Dget_space(dataId);
+    values.resize(static_cast<size_t>(H5Sget_simple_extent_npoints(spaceId)) * H5Tget_size(memTypeId));
+    herr_t err = H5Dread(dataId, memTypeId, H5S_ALL, H5S_ALL, H5P_DEFAULT, values.data());
+    H5Sclose(spaceId);
+    H5Tclose(memTypeId);
+    H5Tclose(fileTypeId);
+    H5Dclose(dataId);
+    return err >= 0;
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  int TestExportPipelinedBlocks()
+  {
+    DataContainerArray::Pointer dca = CreateSyntheticVolume(96, 8);
+    const QStringList datasets = {"/tstt/nodes/coordinates", "/tstt/elements/Hex8/connectivity", "/tstt/elements/Hex8/tags/" + ErrorDataArrayName + "_",
+                                  "/tstt/elements/Hex8/tags/" + NoiseDataArrayName + "_"};
+
+    // The explicit mode hands large blocks to the writer thread and the streaming mode one Z
+    // layer at a time. Both files must hold the same data, with and without gathering the rows
+    // of a cropped region.
+    for(bool crop : {false, true})
+    {
+      const QVector<QString> outputFiles = {UnitTest::ExportMoabMeshTest::HDF5OutputFile, UnitTest::ExportMoabMeshTest::StreamingOutputFile};
+      for(int i = 0; i < outputFiles.size(); i++)
+      {
+        AbstractFilter::Pointer filter = CreateExportFilter();
+        DREAM3D_REQUIRE_VALID_POINTER(filter.get());
+        filter->setDataContainerArray(dca);
+
+        QVector<DataArrayPath> paths = {DataArrayPath(DataContainerName, AttributeMatrixName, ErrorDataArrayName), DataArrayPath(DataContainerName, AttributeMatrixName, NoiseDataArrayName)};
+        QVariant var;
+        var.setValue(paths);
+        filter->setProperty("SelectedArrayPaths", var);
+        var.setValue(outputFiles[i]);
+        filter->setProperty("OutputFile", var);
+        filter->setProperty("ExportMode", static_cast<int>(i == 0 ? ExportMoabMesh::ExportModeType::ExplicitHex : ExportMoabMesh::ExportModeType::StreamingSlabs));
+        filter->setProperty("MemoryBudget", 4);
+        filter->setProperty("CropToRegion", crop);
+        filter->setProperty("XMin", 3);
+        filter->setProperty("YMin", 0);
+        filter->setProperty("ZMin", 5);
+        filter->setProperty("XMax", 90);
+        filter->setProperty("YMax", 95);
+        filter->setProperty("ZMax", 80);
+
+        filter->execute();
+        DREAM3D_REQUIRE_EQUAL(filter->getErrorCondition(), 0);
+      }
+
+      for(const QString& dataset : datasets)
+      {
+        std::vector<uint8_t> explicitValues;
+        std::vector<uint8_t> streamingValues;
+        DREAM3D_REQUIRE_EQUAL(ReadDataset(outputFiles[0], dataset, explicitValues), true);
+        DREAM3D_REQUIRE_EQUAL(ReadDataset(outputFiles[1], dataset, streamingValues), true);
+        DREAM3D_REQUIRE_EQUAL(explicitValues.size(), streamingValues.size());
+        DREAM3D_REQUIRE(explicitValues == streamingValues);
+      }
+    }
+
+    return EXIT_SUCCESS;
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  int TestExportPartitionSets()
+  {
+    const size_t k_Dim = 32;
+    DataContainerArray::Pointer dca = CreateSyntheticVolume(k_Dim, 8);
+
+    AbstractFilter::Pointer filter = CreateExportFilter();
+    DREAM3D_REQUIRE_VALID_POINTER(filter.get());
+    filter->setDataContainerArray(dca);
+
+    QVector<DataArrayPath> paths = {DataArrayPath(DataContainerName, AttributeMatrixName, NoiseDataArrayName)};
+    QVariant var;
+    var.setValue(paths);
+    bool propWasSet = filter->setProperty("SelectedArrayPaths", var);
+    DREAM3D_REQUIRE_EQUAL(propWasSet, true);
+    var.setValue(DataArrayPath(DataContainerName, AttributeMatrixName, ErrorDataArrayName));
+    propWasSet = filter->setProperty("FeatureIdsArrayPath", var);
+    DREAM3D_REQUIRE_EQUAL(propWasSet, true);
+    propWasSet = filter->setProperty("WritePartitionSets", true);
+    DREAM3D_REQUIRE_EQUAL(propWasSet, true);
+
+    var.setValue(UnitTest::ExportMoabMeshTest::VTKOutputFile);
+    filter->setProperty("OutputFile", var);
+    filter->preflight();
+    DREAM3D_REQUIRE_EQUAL(filter->getErrorCondition(), -101034);
+
+    var.setValue(UnitTest::ExportMoabMeshTest::PartitionOutputFile);
+    filter->setProperty("OutputFile", var);
+    filter->setProperty("PartitionCount", 0);
+    filter->preflight();
+    DREAM3D_REQUIRE_EQUAL(filter->getErrorCondition(), -101032);
+
+    filter->setProperty("PartitionCount", 6);
+    filter->setProperty("PartitionStrategy", 3);
+    filter->preflight();
+    DREAM3D_REQUIRE_EQUAL(filter->getErrorCondition(), -101033);
+
+    // Each strategy must put every element in exactly one part, next to the Feature sets which
+    // also cover every element once
+    filter->setProperty("WriteFeatureSets", true);
+    const std::vector<ExportMoabMesh::ExportModeType> modes = {ExportMoabMesh::ExportModeType::ExplicitHex, ExportMoabMesh::ExportModeType::StreamingSlabs,
+                                                               ExportMoabMesh::ExportModeType::CoarsenedOctree};
+    for(ExportMoabMesh::ExportModeType mode : modes)
+    {
+      filter->setProperty("ExportMode", static_cast<int>(mode));
+      for(int strategy = 0; strategy < 3; strategy++)
+      {
+        filter->setProperty("PartitionStrategy", strategy);
+        filter->execute();
+        DREAM3D_REQUIRE_EQUAL(filter->getErrorCondition(), 0);
+        DREAM3D_REQUIRE_EQUAL(filter->getWarningCondition(), 0);
+
+        std::vector<uint8_t> values;
+        DREAM3D_REQUIRE_EQUAL(ReadDataset(UnitTest::ExportMoabMeshTest::PartitionOutputFile, "/tstt/tags/PARALLEL_PARTITION/values", values), true);
+        DREAM3D_REQUIRE_EQUAL(values.size(), 6 * sizeof(int32_t));
+
+        std::vector<uint8_t> connectivity;
+        DREAM3D_REQUIRE_EQUAL(ReadDataset(UnitTest::ExportMoabMeshTest::PartitionOutputFile, "/tstt/elements/Hex8/connectivity", connectivity), true);
+        size_t numElements = connectivity.size() / (8 * sizeof(int64_t));
+        if(mode != ExportMoabMesh::ExportModeType::CoarsenedOctree)
+        {
+          DREAM3D_REQUIRE_EQUAL(numElements, k_Dim * k_Dim * k_Dim);
+        }
+
+        std::vector<uint8_t> contents;
+        DREAM3D_REQUIRE_EQUAL(ReadDataset(UnitTest::ExportMoabMeshTest::PartitionOutputFile, "/tstt/sets/contents", contents), true);
+        const int64_t* ranges = reinterpret_cast<const int64_t*>(contents.data());
+        size_t numCovered = 0;
+        for(size_t i = 1; i < contents.size() / sizeof(int64_t); i += 2)
+        {
+          numCovered += static_cast<size_t>(ranges[i]);
+        }
+        DREAM3D_REQUIRE_EQUAL(numCovered, 2 * numElements);
+      }
+    }
+
+    // There are 64 grains, so the Features cannot fill more parts than that
+    filter->setProperty("ExportMode", static_cast<int>(ExportMoabMesh::ExportModeType::ExplicitHex));
+    filter->setProperty("PartitionStrategy", 2);
+    filter->setProperty("PartitionCount", 100);
+    filter->execute();
+    DREAM3D_REQUIRE_EQUAL(filter->getErrorCondition(), 0);
+    DREAM3D_REQUIRE_EQUAL(filter->getWarningCondition(), -101035);
+
+    return EXIT_SUCCESS;
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  QStringList BatchStepNames()
+  {
+    return {"Step0", "Step1", "Step2"};
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  QString BatchStepFile(const QString& stepName)
+  {
+    QFileInfo fi(UnitTest::ExportMoabMeshTest::BatchOutputFile);
+    return fi.path() + "/" + fi.baseName() + "_" + stepName + "." + fi.completeSuffix();
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  int TestExportBatch()
+  {
+    const size_t k_Dim = 24;
+    DataContainerArray::Pointer dca = DataContainerArray::New();
+
+    // Time steps on identical grids whose values differ from step to step
+    std::vector<std::vector<float>> stepValues;
+    QStringList stepNames = BatchStepNames();
+    stepNames.push_back("Coarse");
+    for(int s = 0; s < stepNames.size(); s++)
+    {
+      size_t dim = (stepNames[s] == "Coarse") ? k_Dim / 2 : k_Dim;
+      DataContainer::Pointer dc = DataContainer::New(stepNames[s]);
+      ImageGeom::Pointer image = ImageGeom::CreateGeometry(SIMPL::Geometry::ImageGeometry);
+      image->setDimensions(dim, dim, dim);
+      dc->setGeometry(image);
+      dca->addDataContainer(dc);
+
+      QVector<size_t> tDims(3, dim);
+      AttributeMatrix::Pointer am = AttributeMatrix::New(tDims, AttributeMatrixName, AttributeMatrix::Type::Cell);
+      dc->addAttributeMatrix(AttributeMatrixName, am);
+
+      size_t numCells = dim * dim * dim;
+      FloatArrayType::Pointer values = FloatArrayType::CreateArray(numCells, NoiseDataArrayName);
+      stepValues.emplace_back(numCells);
+      for(size_t i = 0; i < numCells; i++)
+      {
+        stepValues.back()[i] = static_cast<float>(s) * 1000.0f + static_cast<float>(i % 997);
+        values->setValue(i, stepValues.back()[i]);
+      }
+      am->addAttributeArray(NoiseDataArrayName, values);
+    }
+
+    AbstractFilter::Pointer filter = CreateExportFilter();
+    DREAM3D_REQUIRE_VALID_POINTER(filter.get());
+    filter->setDataContainerArray(dca);
+
+    QVector<DataArrayPath> paths = {DataArrayPath("Step0", AttributeMatrixName, NoiseDataArrayName)};
+    QVariant var;
+    var.setValue(paths);
+    bool propWasSet = filter->setProperty("SelectedArrayPaths", var);
+    DREAM3D_REQUIRE_EQUAL(propWasSet, true);
+    var.setValue(UnitTest::ExportMoabMeshTest::BatchOutputFile);
+    filter->setProperty("OutputFile", var);
+    propWasSet = filter->setProperty("ExportBatch", true);
+    DREAM3D_REQUIRE_EQUAL(propWasSet, true);
+    filter->preflight();
+    DREAM3D_REQUIRE_EQUAL(filter->getErrorCondition(), -101036);
+
+    var.setValue(stepNames);
+    propWasSet = filter->setProperty("BatchDataContainerNames", var);
+    DREAM3D_REQUIRE_EQUAL(propWasSet, true);
+    filter->preflight();
+    DREAM3D_REQUIRE_EQUAL(filter->getErrorCondition(), -101041);
+
+    var.setValue(BatchStepNames());
+    filter->setProperty("BatchDataContainerNames", var);
+    filter->setProperty("ExportMode", static_cast<int>(ExportMoabMesh::ExportModeType::StructuredBox));
+    filter->preflight();
+    DREAM3D_REQUIRE_EQUAL(filter->getErrorCondition(), -101039);
+
+    // Every step goes into one file with the step name after the tag name
+    filter->setProperty("ExportMode", static_cast<int>(ExportMoabMesh::ExportModeType::ExplicitHex));
+    filter->setProperty("BatchThreadLimit", 2);
+    filter->execute();
+    DREAM3D_REQUIRE_EQUAL(filter->getErrorCondition(), 0);
+    for(int s = 0; s < BatchStepNames().size(); s++)
+    {
+      std::vector<uint8_t> values;
+      DREAM3D_REQUIRE_EQUAL(ReadDataset(UnitTest::ExportMoabMeshTest::BatchOutputFile, "/tstt/elements/Hex8/tags/" + NoiseDataArrayName + "_" + stepNames[s], values), true);
+      DREAM3D_REQUIRE_EQUAL(values.size(), stepValues[s].size() * sizeof(float));
+      DREAM3D_REQUIRE(std::memcmp(values.data(), stepValues[s].data(), values.size()) == 0);
+    }
+
+    // A cropped region gathers the rows of every step. The file of each step must hold the
+    // same mesh and values as the single file.
+    filter->setProperty("ExportMode", static_cast<int>(ExportMoabMesh::ExportModeType::StreamingSlabs));
+    filter->setProperty("MemoryBudget", 1);
+    filter->setProperty("CropToRegion", true);
+    filter->setProperty("XMin", 2);
+    filter->setProperty("YMin", 3);
+    filter->setProperty("ZMin", 1);
+    filter->setProperty("XMax", 20);
+    filter->setProperty("YMax", 17);
+    filter->setProperty("ZMax", 22);
+    filter->execute();
+    DREAM3D_REQUIRE_EQUAL(filter->getErrorCondition(), 0);
+
+    filter->setProperty("BatchLayout", static_cast<int>(ExportMoabMesh::BatchLayoutType::FilePerStep));
+    filter->execute();
+    DREAM3D_REQUIRE_EQUAL(filter->getErrorCondition(), 0);
+
+    std::vector<uint8_t> singleConnectivity;
+    DREAM3D_REQUIRE_EQUAL(ReadDataset(UnitTest::ExportMoabMeshTest::BatchOutputFile, "/tstt/elements/Hex8/connectivity", singleConnectivity), true);
+    for(const QString& stepName : BatchStepNames())
+    {
+      std::vector<uint8_t> stepConnectivity;
+      DREAM3D_REQUIRE_EQUAL(ReadDataset(BatchStepFile(stepName), "/tstt/elements/Hex8/connectivity", stepConnectivity), true);
+      DREAM3D_REQUIRE(stepConnectivity == singleConnectivity);
+
+      std::vector<uint8_t> singleValues;
+      std::vector<uint8_t> stepFileValues;
+      DREAM3D_REQUIRE_EQUAL(ReadDataset(UnitTest::ExportMoabMeshTest::BatchOutputFile, "/tstt/elements/Hex8/tags/" + NoiseDataArrayName + "_" + stepName, singleValues), true);
+      DREAM3D_REQUIRE_EQUAL(ReadDataset(BatchStepFile(stepName), "/tstt/elements/Hex8/tags/" + NoiseDataArrayName + "_", stepFileValues), true);
+      DREAM3D_REQUIRE_EQUAL(singleValues.size(), 19 * 15 * 22 * sizeof(float));
+      DREAM3D_REQUIRE(stepFileValues == singleValues);
+    }
+
+    return EXIT_SUCCESS;
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  bool HasRootMarker(const QString& filePath)
+  {
+    hid_t fileId = QH5Utilities::openFile(filePath, true);
+    if(fileId < 0)
+    {
+      return false;
+    }
+    H5ScopedFileSentinel sentinel(&fileId, true);
+    return H5Aexists(fileId, "ReuseMarker") > 0;
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  int TestReuseUnchangedMesh()
+  {
+    const size_t k_Dim = 20;
+    const size_t k_NumCells = k_Dim * k_Dim * k_Dim;
+    FloatArrayType::Pointer values = FloatArrayType::CreateArray(k_NumCells, NoiseDataArrayName);
+    for(size_t i = 0; i < k_NumCells; i++)
+    {
+      values->setValue(i, static_cast<float>(i));
+    }
+    DataContainerArray::Pointer dca = CreateSyntheticVolume(QVector<size_t>(3, k_Dim), {values});
+
+    AbstractFilter::Pointer filter = CreateExportFilter();
+    DREAM3D_REQUIRE_VALID_POINTER(filter.get());
+    filter->setDataContainerArray(dca);
+
+    QVector<DataArrayPath> paths = {DataArrayPath(DataContainerName, AttributeMatrixName, NoiseDataArrayName)};
+    QVariant var;
+    var.setValue(paths);
+    filter->setProperty("SelectedArrayPaths", var);
+    var.setValue(UnitTest::ExportMoabMeshTest::ReuseOutputFile);
+    filter->setProperty("OutputFile", var);
+    bool propWasSet = filter->setProperty("ReuseUnchangedMesh", true);
+    DREAM3D_REQUIRE_EQUAL(propWasSet, true);
+
+    filter->setProperty("ExportMode", static_cast<int>(ExportMoabMesh::ExportModeType::StructuredBox));
+    filter->preflight();
+    DREAM3D_REQUIRE_EQUAL(filter->getWarningCondition(), -101043);
+
+    filter->setProperty("ExportMode", static_cast<int>(ExportMoabMesh::ExportModeType::ExplicitHex));
+    filter->execute();
+    DREAM3D_REQUIRE_EQUAL(filter->getErrorCondition(), 0);
+    DREAM3D_REQUIRE_EQUAL(filter->getWarningCondition(), 0);
+
+    std::vector<uint8_t> connectivity;
+    DREAM3D_REQUIRE_EQUAL(ReadDataset(UnitTest::ExportMoabMeshTest::ReuseOutputFile, "/tstt/elements/Hex8/connectivity", connectivity), true);
+
+    // A full export truncates the file, so a marker attribute only survives when the mesh is reused
+    {
+      hid_t fileId = QH5Utilities::openFile(UnitTest::ExportMoabMeshTest::ReuseOutputFile, false);
+      DREAM3D_REQUIRE(fileId >= 0);
+      H5ScopedFileSentinel sentinel(&fileId, true);
+      hid_t spaceId = H5Screate(H5S_SCALAR);
+      hid_t attrId = H5Acreate2(fileId, "ReuseMarker", H5T_NATIVE_INT, spaceId, H5P_DEFAULT, H5P_DEFAULT);
+      DREAM3D_REQUIRE(attrId >= 0);
+      H5Aclose(attrId);
+      H5Sclose(spaceId);
+    }
+
+    // New values on the same geometry, written by the streaming mode, which produces the same mesh
+    for(size_t i = 0; i < k_NumCells; i++)
+    {
+      values->setValue(i, static_cast<float>(2 * i + 1));
+    }
+    filter->setProperty("ExportMode", static_cast<int>(ExportMoabMesh::ExportModeType::StreamingSlabs));
+    filter->setProperty("MemoryBudget", 1);
+    filter->execute();
+    DREAM3D_REQUIRE_EQUAL(filter->getErrorCondition(), 0);
+    DREAM3D_REQUIRE_EQUAL(HasRootMarker(UnitTest::ExportMoabMeshTest::ReuseOutputFile), true);
+
+    std::vector<uint8_t> reusedConnectivity;
+    std::vector<uint8_t> tagValues;
+    DREAM3D_REQUIRE_EQUAL(ReadDataset(UnitTest::ExportMoabMeshTest::ReuseOutputFile, "/tstt/elements/Hex8/connectivity", reusedConnectivity), true);
+    DREAM3D_REQUIRE(reusedConnectivity == connectivity);
+    DREAM3D_REQUIRE_EQUAL(ReadDataset(UnitTest::ExportMoabMeshTest::ReuseOutputFile, "/tstt/elements/Hex8/tags/" + NoiseDataArrayName + "_", tagValues), true);
+    DREAM3D_REQUIRE_EQUAL(tagValues.size(), k_NumCells * sizeof(float));
+    const float* tagFloats = reinterpret_cast<const float*>(tagValues.data());
+    for(size_t i = 0; i < k_NumCells; i++)
+    {
+      DREAM3D_REQUIRE_EQUAL(tagFloats[i], static_cast<float>(2 * i + 1));
+    }
+
+    // Any setting that changes the mesh or its storage writes the file again
+    filter->setProperty("CropToRegion", true);
+    filter->setProperty("XMin", 0);
+    filter->setProperty("YMin", 0);
+    filter->setProperty("ZMin", 0);
+    filter->setProperty("XMax", 9);
+    filter->setProperty("YMax", 19);
+    filter->setProperty("ZMax", 19);
+    filter->execute();
+    DREAM3D_REQUIRE_EQUAL(filter->getErrorCondition(), 0);
+    DREAM3D_REQUIRE_EQUAL(HasRootMarker(UnitTest::ExportMoabMeshTest::ReuseOutputFile), false);
+    DREAM3D_REQUIRE_EQUAL(ReadDataset(UnitTest::ExportMoabMeshTest::ReuseOutputFile, "/tstt/elements/Hex8/connectivity", connectivity), true);
+    DREAM3D_REQUIRE_EQUAL(connectivity.size(), 10 * k_Dim * k_Dim * 8 * sizeof(int64_t));
+
+    return EXIT_SUCCESS;
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  int TestExportEstimate()
+  {
+    const size_t k_Dim = 100;
+    FloatArrayType::Pointer values = FloatArrayType::CreateArray(k_Dim * k_Dim * k_Dim, NoiseDataArrayName);
+    DataContainerArray::Pointer dca = CreateSyntheticVolume(QVector<size_t>(3, k_Dim), {values});
+
+    AbstractFilter::Pointer filter = CreateExportFilter();
+    DREAM3D_REQUIRE_VALID_POINTER(filter.get());
+    filter->setDataContainerArray(dca);
+
+    QVector<DataArrayPath> paths = {DataArrayPath(DataContainerName, AttributeMatrixName, NoiseDataArrayName)};
+    QVariant var;
+    var.setValue(paths);
+    filter->setProperty("SelectedArrayPaths", var);
+    var.setValue(UnitTest::ExportMoabMeshTest::HDF5OutputFile);
+    filter->setProperty("OutputFile", var);
+    filter->setProperty("ExportMode", static_cast<int>(ExportMoabMesh::ExportModeType::StreamingSlabs));
+    filter->setProperty("MemoryBudget", 16);
+    bool propWasSet = filter->setProperty("PeakMemoryLimit", 64);
+    DREAM3D_REQUIRE_EQUAL(propWasSet, true);
+
+    // The streaming writer stays within its budget, so the limit is not reached
+    filter->preflight();
+    DREAM3D_REQUIRE_EQUAL(filter->getErrorCondition(), 0);
+    QString estimate = filter->property("EstimatedCost").toString();
+    DREAM3D_REQUIRE_EQUAL(estimate.isEmpty(), false);
+    DREAM3D_REQUIRE(estimate.contains("order of magnitude"));
+
+    // The blocks in flight alone need more than 1 MB, while a limit of 0 accepts any estimate
+    filter->setProperty("PeakMemoryLimit", 1);
+    filter->preflight();
+    DREAM3D_REQUIRE_EQUAL(filter->getErrorCondition(), -101044);
+    DREAM3D_REQUIRE_EQUAL(filter->property("EstimatedCost").toString(), estimate);
+
+    filter->setProperty("PeakMemoryLimit", 0);
+    filter->preflight();
+    DREAM3D_REQUIRE_EQUAL(filter->getErrorCondition(), 0);
+    DREAM3D_REQUIRE_EQUAL(filter->property("EstimatedCost").toString(), estimate);
+    filter->setProperty("PeakMemoryLimit", 64);
+
+    // SMTK holds two copies of the million element mesh for the VTK writers
+    var.setValue(UnitTest::ExportMoabMeshTest::VTKOutputFile);
+    filter->setProperty("OutputFile", var);
+    filter->setProperty("ExportMode", static_cast<int>(ExportMoabMesh::ExportModeType::ExplicitHex));
+    filter->preflight();
+    DREAM3D_REQUIRE_EQUAL(filter->getErrorCondition(), -101044);
+
+    filter->setProperty("PeakMemoryLimit", 0);
+    filter->preflight();
+    DREAM3D_REQUIRE_EQUAL(filter->getErrorCondition(), 0);
+    DREAM3D_REQUIRE(filter->property("EstimatedCost").toString() != estimate);
+
+    return EXIT_SUCCESS;
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  int TestExportCancelled()
+  {
+    const size_t k_Dim = 40;
+    FloatArrayType::Pointer values = FloatArrayType::CreateArray(k_Dim * k_Dim * k_Dim, NoiseDataArrayName);
+    values->initializeWithZeros();
+    DataContainerArray::Pointer dca = CreateSyntheticVolume(QVector<size_t>(3, k_Dim), {values});
+
+    AbstractFilter::Pointer filter = CreateExportFilter();
+    DREAM3D_REQUIRE_VALID_POINTER(filter.get());
+    filter->setDataContainerArray(dca);
+
+    QVector<DataArrayPath> paths = {DataArrayPath(DataContainerName, AttributeMatrixName, NoiseDataArrayName)};
+    QVariant var;
+    var.setValue(paths);
+    filter->setProperty("SelectedArrayPaths", var);
+    filter->setProperty("ExportMode", static_cast<int>(ExportMoabMesh::ExportModeType::StreamingSlabs));
+    filter->setProperty("MemoryBudget", 1);
+
+    // The 1 MB budget splits the export into many slabs. The observer cancels half way through,
+    // the writers stop after the chunk in progress and the partial files are removed, without
+    // an error.
+    const QStringList outputFiles = {UnitTest::ExportMoabMeshTest::CancelOutputFile, UnitTest::ExportMoabMeshTest::CancelVtuOutputFile};
+    for(const QString& outputFile : outputFiles)
+    {
+      var.setValue(outputFile);
+      filter->setProperty("OutputFile", var);
+      CancelObserver observer(filter.get(), 50);
+      QObject::connect(filter.get(), SIGNAL(messageGenerated(const AbstractMessage::Pointer&)), &observer, SLOT(processPipelineMessage(const AbstractMessage::Pointer&)));
+      filter->execute();
+      DREAM3D_REQUIRE_EQUAL(filter->getErrorCondition(), 0);
+      DREAM3D_REQUIRE(observer.m_LastPercent >= 50);
+      DREAM3D_REQUIRE(observer.m_LastPercent < 100);
+      DREAM3D_REQUIRE_EQUAL(QFile::exists(outputFile), false);
+    }
+
+    // A cancel that comes after the last chunk leaves a finished file, which is kept
+    for(const QString& outputFile : outputFiles)
+    {
+      var.setValue(outputFile);
+      filter->setProperty("OutputFile", var);
+      CancelObserver observer(filter.get(), 100);
+      QObject::connect(filter.get(), SIGNAL(messageGenerated(const AbstractMessage::Pointer&)), &observer, SLOT(processPipelineMessage(const AbstractMessage::Pointer&)));
+      filter->execute();
+      DREAM3D_REQUIRE_EQUAL(filter->getErrorCondition(), 0);
+      DREAM3D_REQUIRE_EQUAL(observer.m_LastPercent, 100);
+      DREAM3D_REQUIRE_EQUAL(QFile::exists(outputFile), true);
+    }
+
+    return EXIT_SUCCESS;
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  int TestExportExodus()
+  {
+    const size_t k_Dims[3] = {10, 8, 6};
+    const size_t k_NumCells = k_Dims[0] * k_Dims[1] * k_Dims[2];
+    // Features 1, 3 and 5 fill two Z layers each, and the unused Feature Ids get no block
+    Int32ArrayType::Pointer featureIds = Int32ArrayType::CreateArray(k_NumCells, ErrorDataArrayName);
+    FloatArrayType::Pointer vectors = FloatArrayType::CreateArray(k_NumCells, std::vector<size_t>(1, 3), NoiseDataArrayName, true);
+    for(size_t i = 0; i < k_NumCells; i++)
+    {
+      featureIds->setValue(i, static_cast<int32_t>(i / (k_Dims[0] * k_Dims[1] * 2)) * 2 + 1);
+      for(size_t c = 0; c < 3; c++)
+      {
+        vectors->setValue(i * 3 + c, static_cast<float>(i * 3 + c));
+      }
+    }
+    DataContainerArray::Pointer dca = CreateSyntheticVolume({k_Dims[0], k_Dims[1], k_Dims[2]}, {featureIds, vectors});
+
+    AbstractFilter::Pointer filter = CreateExportFilter();
+    DREAM3D_REQUIRE_VALID_POINTER(filter.get());
+    filter->setDataContainerArray(dca);
+
+    QVector<DataArrayPath> paths = {DataArrayPath(DataContainerName, AttributeMatrixName, NoiseDataArrayName), DataArrayPath(DataContainerName, AttributeMatrixName, ErrorDataArrayName)};
+    QVariant var;
+    var.setValue(paths);
+    filter->setProperty("SelectedArrayPaths", var);
+    var.setValue(UnitTest::ExportMoabMeshTest::ExodusOutputFile);
+    filter->setProperty("OutputFile", var);
+
+    // Exodus files hold hexahedra written by the native generator only
+    filter->setProperty("ExportMode", static_cast<int>(ExportMoabMesh::ExportModeType::StructuredBox));
+    filter->preflight();
+    DREAM3D_REQUIRE_EQUAL(filter->getErrorCondition(), -101045);
+
+    filter->setProperty("ExportMode", static_cast<int>(ExportMoabMesh::ExportModeType::StreamingSlabs));
+    filter->setProperty("MemoryBudget", 1);
+    filter->setProperty("WriteFeatureSets", true);
+    var.setValue(DataArrayPath(DataContainerName, AttributeMatrixName, ErrorDataArrayName));
+    filter->setProperty("FeatureIdsArrayPath", var);
+    filter->execute();
+    DREAM3D_REQUIRE_EQUAL(filter->getErrorCondition(), 0);
+
+    // A model this small is written in the classic netCDF format
+    std::ifstream in(UnitTest::ExportMoabMeshTest::ExodusOutputFile.toStdString(), std::ios::in | std::ios::binary);
+    DREAM3D_REQUIRE_EQUAL(in.is_open(), true);
+    char magic[3] = {0, 0, 0};
+    in.read(magic, 3);
+    DREAM3D_REQUIRE_EQUAL(std::string(magic, 3), std::string("CDF"));
+    in.close();
+
+    int computeWordSize = sizeof(double);
+    int ioWordSize = 0;
+    float version = 0.0f;
+    int exoId = ex_open(UnitTest::ExportMoabMeshTest::ExodusOutputFile.toStdString().c_str(), EX_READ, &computeWordSize, &ioWordSize, &version);
+    DREAM3D_REQUIRE(exoId >= 0);
+    ex_set_int64_status(exoId, EX_ALL_INT64_API);
+
+    char title[MAX_LINE_LENGTH + 1] = {0};
+    int64_t numDims = 0;
+    int64_t numNodes = 0;
+    int64_t numElements = 0;
+    int64_t numBlocks = 0;
+    int64_t numNodeSets = 0;
+    int64_t numSideSets = 0;
+    DREAM3D_REQUIRE(ex_get_init(exoId, title, &numDims, &numNodes, &numElements, &numBlocks, &numNodeSets, &numSideSets) >= 0);
+    DREAM3D_REQUIRE_EQUAL(numNodes, static_cast<int64_t>((k_Dims[0] + 1) * (k_Dims[1] + 1) * (k_Dims[2] + 1)));
+    DREAM3D_REQUIRE_EQUAL(numElements, static_cast<int64_t>(k_NumCells));
+    DREAM3D_REQUIRE_EQUAL(numBlocks, 3);
+
+    // Each Feature gets a block of its own with the Feature Id plus one as its id, and the
+    // components of the vectors come before the Feature Ids in the variable list
+    std::vector<int64_t> blockIds(3, 0);
+    DREAM3D_REQUIRE(ex_get_ids(exoId, EX_ELEM_BLOCK, blockIds.data()) >= 0);
+    char variableName[MAX_STR_LENGTH + 1] = {0};
+    DREAM3D_REQUIRE(ex_get_variable_name(exoId, EX_ELEM_BLOCK, 2, variableName) >= 0);
+    DREAM3D_REQUIRE_EQUAL(std::string(variableName), std::string("Confidence_1"));
+
+    const size_t k_CellsPerFeature = k_Dims[0] * k_Dims[1] * 2;
+    const size_t k_NodesPerLayer = (k_Dims[0] + 1) * (k_Dims[1] + 1);
+    for(size_t b = 0; b < 3; b++)
+    {
+      DREAM3D_REQUIRE_EQUAL(blockIds[b], static_cast<int64_t>(2 * b + 2));
+      ex_block block;
+      block.id = blockIds[b];
+      block.type = EX_ELEM_BLOCK;
+      DREAM3D_REQUIRE(ex_get_block_param(exoId, &block) >= 0);
+      DREAM3D_REQUIRE_EQUAL(std::string(block.topology), std::string("HEX8"));
+      DREAM3D_REQUIRE_EQUAL(block.num_entry, static_cast<int64_t>(k_CellsPerFeature));
+      DREAM3D_REQUIRE_EQUAL(block.num_nodes_per_entry, 8);
+
+      // The cells of a Feature keep their order inside its block
+      std::vector<double> values(k_CellsPerFeature, 0.0);
+      DREAM3D_REQUIRE(ex_get_var(exoId, 1, EX_ELEM_BLOCK, 2, blockIds[b], static_cast<int64_t>(k_CellsPerFeature), values.data()) >= 0);
+      for(size_t e = 0; e < k_CellsPerFeature; e++)
+      {
+        DREAM3D_REQUIRE_EQUAL(values[e], static_cast<double>((b * k_CellsPerFeature + e) * 3 + 1));
+      }
+    }
+
+    // Element 13 of the block of Feature 3 is the cell (3, 1, 2). Its nodes are the corners of
+    // the cell in the VTK hexahedron order, with node ids starting at 1.
+    std::vector<int64_t> connectivity(k_CellsPerFeature * 8, 0);
+    DREAM3D_REQUIRE(ex_get_conn(exoId, EX_ELEM_BLOCK, blockIds[1], connectivity.data(), nullptr, nullptr) >= 0);
+    const size_t k_Corners[8][3] = {{3, 1, 2}, {4, 1, 2}, {4, 2, 2}, {3, 2, 2}, {3, 1, 3}, {4, 1, 3}, {4, 2, 3}, {3, 2, 3}};
+    for(size_t n = 0; n < 8; n++)
+    {
+      int64_t nodeId = connectivity[13 * 8 + n];
+      DREAM3D_REQUIRE_EQUAL(nodeId, static_cast<int64_t>(k_Corners[n][2] * k_NodesPerLayer + k_Corners[n][1] * (k_Dims[0] + 1) + k_Corners[n][0] + 1));
+      double xyz[3] = {-1.0, -1.0, -1.0};
+      DREAM3D_REQUIRE(ex_get_partial_coord(exoId, nodeId, 1, &xyz[0], &xyz[1], &xyz[2]) >= 0);
+      for(size_t c = 0; c < 3; c++)
+      {
+        DREAM3D_REQUIRE_EQUAL(xyz[c], static_cast<double>(k_Corners[n][c]));
+      }
+    }
+    DREAM3D_REQUIRE(ex_close(exoId) >= 0);
+
+    return EXIT_SUCCESS;
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  int TestExportMeshOrdering()
+  {
+    const size_t k_Dims[3] = {10, 8, 6};
+    const size_t k_NumCells = k_Dims[0] * k_Dims[1] * k_Dims[2];
+    // Each cell holds its own index, so the tag values tell which cell every element came from
+    FloatArrayType::Pointer cellIndices = FloatArrayType::CreateArray(k_NumCells, NoiseDataArrayName);
+    Int32ArrayType::Pointer featureIds = Int32ArrayType::CreateArray(k_NumCells, ErrorDataArrayName);
+    for(size_t i = 0; i < k_NumCells; i++)
+    {
+      cellIndices->setValue(i, static_cast<float>(i));
+      featureIds->setValue(i, static_cast<int32_t>((i % k_Dims[0]) / 3));
+    }
+    DataContainerArray::Pointer dca = CreateSyntheticVolume({k_Dims[0], k_Dims[1], k_Dims[2]}, {cellIndices, featureIds});
+
+    AbstractFilter::Pointer filter = CreateExportFilter();
+    DREAM3D_REQUIRE_VALID_POINTER(filter.get());
+    filter->setDataContainerArray(dca);
+
+    QVector<DataArrayPath> paths = {DataArrayPath(DataContainerName, AttributeMatrixName, NoiseDataArrayName)};
+    QVariant var;
+    var.setValue(paths);
+    filter->setProperty("SelectedArrayPaths", var);
+    var.setValue(DataArrayPath(DataContainerName, AttributeMatrixName, ErrorDataArrayName));
+    filter->setProperty("FeatureIdsArrayPath", var);
+
+    filter->setProperty("MeshOrdering", 4);
+    filter->preflight();
+    DREAM3D_REQUIRE_EQUAL(filter->getErrorCondition(), -101046);
+
+    // SMTK writes the vtk file from the cells in their natural order
+    var.setValue(UnitTest::ExportMoabMeshTest::VTKOutputFile);
+    filter->setProperty("OutputFile", var);
+    filter->setProperty("MeshOrdering", 2);
+    filter->preflight();
+    DREAM3D_REQUIRE_EQUAL(filter->getErrorCondition(), -101047);
+
+    // A cropped region gathers its tag values cell by cell from rows that are not contiguous
+    var.setValue(UnitTest::ExportMoabMeshTest::OrderedOutputFile);
+    filter->setProperty("OutputFile", var);
+    filter->setProperty("WriteFeatureSets", true);
+    filter->setProperty("CropToRegion", true);
+    filter->setProperty("XMin", 1);
+    filter->setProperty("YMin", 0);
+    filter->setProperty("ZMin", 1);
+    filter->setProperty("XMax", 8);
+    filter->setProperty("YMax", 7);
+    filter->setProperty("ZMax", 5);
+    const size_t k_NumElements = 8 * 8 * 5;
+
+    // Morton, Hilbert and reverse Cuthill-McKee
+    for(int ordering = 1; ordering <= 3; ordering++)
+    {
+      filter->setProperty("MeshOrdering", ordering);
+      filter->execute();
+      DREAM3D_REQUIRE_EQUAL(filter->getErrorCondition(), 0);
+
+      std::vector<uint8_t> coordBytes;
+      std::vector<uint8_t> connectivityBytes;
+      std::vector<uint8_t> tagBytes;
+      const QString path = UnitTest::ExportMoabMeshTest::OrderedOutputFile;
+      DREAM3D_REQUIRE_EQUAL(ReadDataset(path, "/tstt/nodes/coordinates", coordBytes), true);
+      DREAM3D_REQUIRE_EQUAL(ReadDataset(path, "/tstt/elements/Hex8/connectivity", connectivityBytes), true);
+      DREAM3D_REQUIRE_EQUAL(ReadDataset(path, "/tstt/elements/Hex8/tags/" + NoiseDataArrayName + "_", tagBytes), true);
+      DREAM3D_REQUIRE_EQUAL(connectivityBytes.size(), k_NumElements * 8 * sizeof(int64_t));
+      DREAM3D_REQUIRE_EQUAL(tagBytes.size(), k_NumElements * sizeof(float));
+      const double* coords = reinterpret_cast<const double*>(coordBytes.data());
+      const int64_t* connectivity = reinterpret_cast<const int64_t*>(connectivityBytes.data());
+      const float* cells = reinterpret_cast<const float*>(tagBytes.data());
+
+      // Every cell of the region appears once, not in its natural order, and the first and
+      // seventh node of its element sit on the corners of the cell
+      std::vector<bool> seen(k_NumCells, false);
+      bool natural = true;
+      for(size_t e = 0; e < k_NumElements; e++)
+      {
+        size_t cell = static_cast<size_t>(cells[e]);
+        DREAM3D_REQUIRE(cell < k_NumCells && !seen[cell]);
+        seen[cell] = true;
+        natural = natural && (e == 0 || cells[e] > cells[e - 1]);
+
+        double corner[3] = {static_cast<double>(cell % k_Dims[0]), static_cast<double>((cell / k_Dims[0]) % k_Dims[1]), static_cast<double>(cell / (k_Dims[0] * k_Dims[1]))};
+        const double* first = coords + 3 * (connectivity[8 * e] - 1);
+        const double* seventh = coords + 3 * (connectivity[8 * e + 6] - 1);
+        for(size_t axis = 0; axis < 3; axis++)
+        {
+          DREAM3D_REQUIRE_EQUAL(first[axis], corner[axis]);
+          DREAM3D_REQUIRE_EQUAL(seventh[axis], corner[axis] + 1.0);
+        }
+      }
+      DREAM3D_REQUIRE_EQUAL(natural, false);
+    }
+
+    return EXIT_SUCCESS;
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  int TestExportElementList()
+  {
+    // A strip of triangles along X, two per unit square
+    const size_t k_NumSquares = 50;
+    const size_t k_NumVertices = 2 * (k_NumSquares + 1);
+    const size_t k_NumTriangles = 2 * k_NumSquares;
+    SharedVertexList::Pointer vertices = TriangleGeom::CreateSharedVertexList(static_cast<int64_t>(k_NumVertices));
+    float* xyz = vertices->getPointer(0);
+    for(size_t i = 0; i < k_NumVertices; i++)
+    {
+      xyz[3 * i] = static_cast<float>(i / 2);
+      xyz[3 * i + 1] = static_cast<float>(i % 2);
+      xyz[3 * i + 2] = 0.0f;
+    }
+    TriangleGeom::Pointer triangleGeom = TriangleGeom::CreateGeometry(static_cast<int64_t>(k_NumTriangles), vertices, SIMPL::Geometry::TriangleGeometry);
+    int64_t* triangles = triangleGeom->getTriangles()->getPointer(0);
+    for(size_t s = 0; s < k_NumSquares; s++)
+    {
+      const int64_t v0 = static_cast<int64_t>(2 * s);
+      const int64_t square[6] = {v0, v0 + 2, v0 + 1, v0 + 1, v0 + 2, v0 + 3};
+      std::copy(square, square + 6, triangles + 6 * s);
+    }
+
+    DataContainerArray::Pointer dca = DataContainerArray::New();
+    DataContainer::Pointer dc = DataContainer::New(DataContainerName);
+    dc->setGeometry(triangleGeom);
+    dca->addDataContainer(dc);
+    QVector<size_t> tDims = {k_NumTriangles};
+    AttributeMatrix::Pointer am = AttributeMatrix::New(tDims, AttributeMatrixName, AttributeMatrix::Type::Face);
+    dc->addAttributeMatrix(AttributeMatrixName, am);
+
+    FloatArrayType::Pointer faceIndices = FloatArrayType::CreateArray(k_NumTriangles, NoiseDataArrayName);
+    Int32ArrayType::Pointer featureIds = Int32ArrayType::CreateArray(k_NumTriangles, ErrorDataArrayName);
+    for(size_t i = 0; i < k_NumTriangles; i++)
+    {
+      faceIndices->setValue(i, static_cast<float>(i));
+      featureIds->setValue(i, static_cast<int32_t>(i / 10));
+    }
+    am->addAttributeArray(NoiseDataArrayName, faceIndices);
+    am->addAttributeArray(ErrorDataArrayName, featureIds);
+
+    AbstractFilter::Pointer filter = CreateExportFilter();
+    DREAM3D_REQUIRE_VALID_POINTER(filter.get());
+    filter->setDataContainerArray(dca);
+
+    QVector<DataArrayPath> paths = {DataArrayPath(DataContainerName, AttributeMatrixName, NoiseDataArrayName)};
+    QVariant var;
+    var.setValue(paths);
+    filter->setProperty("SelectedArrayPaths", var);
+    var.setValue(DataArrayPath(DataContainerName, AttributeMatrixName, ErrorDataArrayName));
+    filter->setProperty("FeatureIdsArrayPath", var);
+    var.setValue(UnitTest::ExportMoabMeshTest::ElementListOutputFile);
+    filter->setProperty("OutputFile", var);
+
+    // The grid modes and options need an Image geometry
+    filter->setProperty("ExportMode", 1);
+    filter->preflight();
+    DREAM3D_REQUIRE_EQUAL(filter->getErrorCondition(), -101048);
+    filter->setProperty("ExportMode", 0);
+    filter->setProperty("CropToRegion", true);
+    filter->preflight();
+    DREAM3D_REQUIRE_EQUAL(filter->getErrorCondition(), -101049);
+    filter->setProperty("CropToRegion", false);
+
+    // The Attribute Matrix must hold one tuple per triangle
+    TriangleGeom::Pointer largerGeom = TriangleGeom::CreateGeometry(static_cast<int64_t>(k_NumTriangles + 1), vertices, SIMPL::Geometry::TriangleGeometry);
+    dc->setGeometry(largerGeom);
+    filter->preflight();
+    DREAM3D_REQUIRE_EQUAL(filter->getErrorCondition(), -101053);
+    dc->setGeometry(triangleGeom);
+
+    filter->setProperty("WriteFeatureSets", true);
+    filter->setProperty("WritePartitionSets", true);
+    filter->setProperty("PartitionCount", 4);
+    filter->setProperty("PartitionStrategy", 1);
+    filter->execute();
+    DREAM3D_REQUIRE_EQUAL(filter->getErrorCondition(), 0);
+
+    std::vector<uint8_t> coordBytes;
+    std::vector<uint8_t> connectivityBytes;
+    std::vector<uint8_t> tagBytes;
+    std::vector<uint8_t> partBytes;
+    const QString path = UnitTest::ExportMoabMeshTest::ElementListOutputFile;
+    DREAM3D_REQUIRE_EQUAL(ReadDataset(path, "/tstt/nodes/coordinates", coordBytes), true);
+    DREAM3D_REQUIRE_EQUAL(ReadDataset(path, "/tstt/elements/Tri3/connectivity", connectivityBytes), true);
+    DREAM3D_REQUIRE_EQUAL(ReadDataset(path, "/tstt/elements/Tri3/tags/" + NoiseDataArrayName + "_", tagBytes), true);
+    DREAM3D_REQUIRE_EQUAL(ReadDataset(path, "/tstt/tags/PARALLEL_PARTITION/values", partBytes), true);
+    DREAM3D_REQUIRE_EQUAL(coordBytes.size(), k_NumVertices * 3 * sizeof(double));
+    DREAM3D_REQUIRE_EQUAL(connectivityBytes.size(), k_NumTriangles * 3 * sizeof(int64_t));
+    DREAM3D_REQUIRE_EQUAL(tagBytes.size(), k_NumTriangles * sizeof(float));
+    DREAM3D_REQUIRE_EQUAL(partBytes.size(), 4 * sizeof(int32_t));
+
+    // The shared lists are written as they are, with the vertex indices shifted to file ids
+    const double* coords = reinterpret_cast<const double*>(coordBytes.data());
+    const int64_t* connectivity = reinterpret_cast<const int64_t*>(connectivityBytes.data());
+    const float* values = reinterpret_cast<const float*>(tagBytes.data());
+    for(size_t i = 0; i < 3 * k_NumVertices; i++)
+    {
+      DREAM3D_REQUIRE_EQUAL(coords[i], static_cast<double>(xyz[i]));
+    }
+    for(size_t i = 0; i < 3 * k_NumTriangles; i++)
+    {
+      DREAM3D_REQUIRE_EQUAL(connectivity[i], triangles[i] + 1);
+    }
+    for(size_t i = 0; i < k_NumTriangles; i++)
+    {
+      DREAM3D_REQUIRE_EQUAL(values[i], static_cast<float>(i));
+    }
+
+    return EXIT_SUCCESS;
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  int TestExportHexahedral()
+  {
+    // A row of unit cubes along X that share their faces
+    const size_t k_NumHexes = 20;
+    const size_t k_NumVertices = 4 * (k_NumHexes + 1);
+    SharedVertexList::Pointer vertices = HexahedralGeom::CreateSharedVertexList(static_cast<int64_t>(k_NumVertices));
+    float* xyz = vertices->getPointer(0);
+    for(size_t i = 0; i < k_NumVertices; i++)
+    {
+      const size_t corner = i % 4;
+      xyz[3 * i] = static_cast<float>(i / 4);
+      xyz[3 * i + 1] = static_cast<float>(corner == 1 || corner == 2);
+      xyz[3 * i + 2] = static_cast<float>(corner >= 2);
+    }
+    HexahedralGeom::Pointer hexGeom = HexahedralGeom::CreateGeometry(static_cast<int64_t>(k_NumHexes), vertices, SIMPL::Geometry::HexahedralGeometry);
+    int64_t* hexes = hexGeom->getHexahedra()->getPointer(0);
+    for(size_t h = 0; h < k_NumHexes; h++)
+    {
+      const int64_t v0 = static_cast<int64_t>(4 * h);
+      const int64_t hex[8] = {v0, v0 + 4, v0 + 5, v0 + 1, v0 + 3, v0 + 7, v0 + 6, v0 + 2};
+      std::copy(hex, hex + 8, hexes + 8 * h);
+    }
+
+    DataContainerArray::Pointer dca = DataContainerArray::New();
+    DataContainer::Pointer dc = DataContainer::New(DataContainerName);
+    dc->setGeometry(hexGeom);
+    dca->addDataContainer(dc);
+    QVector<size_t> tDims = {k_NumHexes};
+    AttributeMatrix::Pointer am = AttributeMatrix::New(tDims, AttributeMatrixName, AttributeMatrix::Type::Cell);
+    dc->addAttributeMatrix(AttributeMatrixName, am);
+
+    Int32ArrayType::Pointer cellIndices = Int32ArrayType::CreateArray(k_NumHexes, DataArrayName);
+    for(size_t i = 0; i < k_NumHexes; i++)
+    {
+      cellIndices->setValue(i, static_cast<int32_t>(i));
+    }
+    am->addAttributeArray(DataArrayName, cellIndices);
+
+    AbstractFilter::Pointer filter = CreateExportFilter();
+    DREAM3D_REQUIRE_VALID_POINTER(filter.get());
+    filter->setDataContainerArray(dca);
+
+    QVector<DataArrayPath> paths = {DataArrayPath(DataContainerName, AttributeMatrixName, DataArrayName)};
+    QVariant var;
+    var.setValue(paths);
+    filter->setProperty("SelectedArrayPaths", var);
+    var.setValue(UnitTest::ExportMoabMeshTest::HexahedralOutputFile);
+    filter->setProperty("OutputFile", var);
+    filter->setProperty("ExportMode", 0);
+    filter->execute();
+    DREAM3D_REQUIRE_EQUAL(filter->getErrorCondition(), 0);
+
+    std::vector<uint8_t> connectivityBytes;
+    std::vector<uint8_t> tagBytes;
+    const QString path = UnitTest::ExportMoabMeshTest::HexahedralOutputFile;
+    DREAM3D_REQUIRE_EQUAL(ReadDataset(path, "/tstt/elements/Hex8/connectivity", connectivityBytes), true);
+    DREAM3D_REQUIRE_EQUAL(ReadDataset(path, "/tstt/elements/Hex8/tags/" + DataArrayName + "_", tagBytes), true);
+    DREAM3D_REQUIRE_EQUAL(connectivityBytes.size(), k_NumHexes * 8 * sizeof(int64_t));
+    DREAM3D_REQUIRE_EQUAL(tagBytes.size(), k_NumHexes * sizeof(int32_t));
+
+    const int64_t* connectivity = reinterpret_cast<const int64_t*>(connectivityBytes.data());
+    const int32_t* values = reinterpret_cast<const int32_t*>(tagBytes.data());
+    for(size_t i = 0; i < 8 * k_NumHexes; i++)
+    {
+      DREAM3D_REQUIRE_EQUAL(connectivity[i], hexes[i] + 1);
+    }
+    for(size_t i = 0; i < k_NumHexes; i++)
+    {
+      DREAM3D_REQUIRE_EQUAL(values[i], static_cast<int32_t>(i));
+    }
+
+    return EXIT_SUCCESS;
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  template <typename T>
+  int CheckMoabTag(moab::Interface& mbCore, const moab::Range& elements, const typename DataArray<T>::Pointer& array)
+  {
+    moab::Tag tag = nullptr;
+    QString tagName = array->getName() + "_";
+    DREAM3D_REQUIRE_EQUAL(mbCore.tag_get_handle(tagName.toLatin1().constData(), tag), moab::MB_SUCCESS);
+    moab::DataType dataType = moab::MB_TYPE_OPAQUE;
+    int numBytes = 0;
+    DREAM3D_REQUIRE_EQUAL(mbCore.tag_get_data_type(tag, dataType), moab::MB_SUCCESS);
+    DREAM3D_REQUIRE_EQUAL(mbCore.tag_get_bytes(tag, numBytes), moab::MB_SUCCESS);
+
+    // MOAB reads the HDF5 float and integer classes into its own double and int tags, and
+    // keeps every other type as opaque bytes
+    const size_t numComponents = static_cast<size_t>(array->getNumberOfComponents());
+    size_t valueBytes = sizeof(T);
+    if(dataType == moab::MB_TYPE_DOUBLE)
+    {
+      valueBytes = sizeof(double);
+    }
+    else if(dataType == moab::MB_TYPE_INTEGER)
+    {
+      valueBytes = sizeof(int);
+    }
+    DREAM3D_REQUIRE_EQUAL(static_cast<size_t>(numBytes), numComponents * valueBytes);
+    DREAM3D_REQUIRE_EQUAL(elements.size(), array->getNumberOfTuples());
+
+    std::vector<uint8_t> bytes(elements.size() * static_cast<size_t>(numBytes));
+    DREAM3D_REQUIRE_EQUAL(mbCore.tag_get_data(tag, elements, bytes.data()), moab::MB_SUCCESS);
+    for(size_t i = 0; i < elements.size() * numComponents; i++)
+    {
+      const T expected = array->getValue(i);
+      if(dataType == moab::MB_TYPE_DOUBLE)
+      {
+        DREAM3D_REQUIRE_EQUAL(reinterpret_cast<const double*>(bytes.data())[i], static_cast<double>(expected));
+      }
+      else if(dataType == moab::MB_TYPE_INTEGER)
+      {
+        DREAM3D_REQUIRE_EQUAL(reinterpret_cast<const int*>(bytes.data())[i], static_cast<int>(expected));
+      }
+      else
+      {
+        DREAM3D_REQUIRE(std::memcmp(bytes.data() + i * sizeof(T), &expected, sizeof(T)) == 0);
+      }
+    }
+
+    return EXIT_SUCCESS;
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  int CheckMoabSets(moab::Interface& mbCore, const moab::Range& elements, const char* tagName, const std::map<int32_t, size_t>& expectedSizes,
+                    const Int32ArrayType::Pointer& labels)
+  {
+    moab::Tag tag = nullptr;
+    DREAM3D_REQUIRE_EQUAL(mbCore.tag_get_handle(tagName, 1, moab::MB_TYPE_INTEGER, tag), moab::MB_SUCCESS);
+    moab::Range sets;
+    DREAM3D_REQUIRE_EQUAL(mbCore.get_entities_by_type_and_tag(0, moab::MBENTITYSET, &tag, nullptr, 1, sets), moab::MB_SUCCESS);
+    DREAM3D_REQUIRE_EQUAL(sets.size(), expectedSizes.size());
+
+    // Every element belongs to exactly one set of the group
+    moab::Range covered;
+    size_t numMembers = 0;
+    for(moab::EntityHandle set : sets)
+    {
+      int label = 0;
+      DREAM3D_REQUIRE_EQUAL(mbCore.tag_get_data(tag, &set, 1, &label), moab::MB_SUCCESS);
+      DREAM3D_REQUIRE_EQUAL(expectedSizes.count(label), 1);
+      moab::Range contents;
+      DREAM3D_REQUIRE_EQUAL(mbCore.get_entities_by_handle(set, contents), moab::MB_SUCCESS);
+      DREAM3D_REQUIRE_EQUAL(contents.size(), expectedSizes.at(label));
+      if(nullptr != labels)
+      {
+        for(moab::EntityHandle element : contents)
+        {
+          int index = elements.index(element);
+          DREAM3D_REQUIRE(index >= 0);
+          DREAM3D_REQUIRE_EQUAL(labels->getValue(static_cast<size_t>(index)), label);
+        }
+      }
+      covered.merge(contents);
+      numMembers += contents.size();
+    }
+    DREAM3D_REQUIRE_EQUAL(numMembers, elements.size());
+    DREAM3D_REQUIRE_EQUAL(covered.size(), elements.size());
+
+    return EXIT_SUCCESS;
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  int CheckMoabFile(const QString& filePath, moab::EntityType elementType, size_t numNodes, const Int32ArrayType::Pointer& featureIds, size_t numParts,
+                    const QVector<IDataArray::Pointer>& arrays)
+  {
+    moab::Core mbCore;
+    DREAM3D_REQUIRE_EQUAL(mbCore.load_file(filePath.toLatin1().constData()), moab::MB_SUCCESS);
+
+    int numVertices = 0;
+    DREAM3D_REQUIRE_EQUAL(mbCore.get_number_entities_by_type(0, moab::MBVERTEX, numVertices), moab::MB_SUCCESS);
+    DREAM3D_REQUIRE_EQUAL(static_cast<size_t>(numVertices), numNodes);
+
+    // The elements are loaded in file order, which is the order of the SIMPL elements
+    moab::Range elements;
+    DREAM3D_REQUIRE_EQUAL(mbCore.get_entities_by_type(0, elementType, elements), moab::MB_SUCCESS);
+    DREAM3D_REQUIRE_EQUAL(elements.size(), featureIds->getNumberOfTuples());
+
+    std::map<int32_t, size_t> featureSizes;
+    for(size_t i = 0; i < featureIds->getNumberOfTuples(); i++)
+    {
+      featureSizes[featureIds->getValue(i)]++;
+    }
+    int err = CheckMoabSets(mbCore, elements, "MATERIAL_SET", featureSizes, featureIds);
+    DREAM3D_REQUIRE_EQUAL(err, EXIT_SUCCESS);
+
+    // The sizes of the parts depend on the strategy, so only the covering is checked
+    moab::Tag partTag = nullptr;
+    DREAM3D_REQUIRE_EQUAL(mbCore.tag_get_handle("PARALLEL_PARTITION", 1, moab::MB_TYPE_INTEGER, partTag), moab::MB_SUCCESS);
+    moab::Range partSets;
+    DREAM3D_REQUIRE_EQUAL(mbCore.get_entities_by_type_and_tag(0, moab::MBENTITYSET, &partTag, nullptr, 1, partSets), moab::MB_SUCCESS);
+    DREAM3D_REQUIRE_EQUAL(partSets.size(), numParts);
+    std::map<int32_t, size_t> partSizes;
+    for(moab::EntityHandle set : partSets)
+    {
+      int part = 0;
+      moab::Range contents;
+      DREAM3D_REQUIRE_EQUAL(mbCore.tag_get_data(partTag, &set, 1, &part), moab::MB_SUCCESS);
+      DREAM3D_REQUIRE_EQUAL(mbCore.get_entities_by_handle(set, contents), moab::MB_SUCCESS);
+      partSizes[part] = contents.size();
+    }
+    err = CheckMoabSets(mbCore, elements, "PARALLEL_PARTITION", partSizes, Int32ArrayType::NullPointer());
+    DREAM3D_REQUIRE_EQUAL(err, EXIT_SUCCESS);
+
+    for(const IDataArray::Pointer& array : arrays)
+    {
+      if(DoubleArrayType::Pointer doubles = std::dynamic_pointer_cast<DoubleArrayType>(array))
+      {
+        err = CheckMoabTag<double>(mbCore, elements, doubles);
+      }
+      else if(FloatArrayType::Pointer floats = std::dynamic_pointer_cast<FloatArrayType>(array))
+      {
+        err = CheckMoabTag<float>(mbCore, elements, floats);
+      }
+      else if(Int32ArrayType::Pointer ints = std::dynamic_pointer_cast<Int32ArrayType>(array))
+      {
+        err = CheckMoabTag<int32_t>(mbCore, elements, ints);
+      }
+      else
+      {
+        err = EXIT_FAILURE;
+      }
+      DREAM3D_REQUIRE_EQUAL(err, EXIT_SUCCESS);
+    }
+
+    return EXIT_SUCCESS;
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  DataContainerArray::Pointer CreateFaceStrip(size_t numSquares, bool quads)
+  {
+    // A strip of unit squares along X, each split in two triangles or kept as one quad
+    const size_t numVertices = 2 * (numSquares + 1);
+    const size_t numFaces = quads ? numSquares : 2 * numSquares;
+    SharedVertexList::Pointer vertices = TriangleGeom::CreateSharedVertexList(static_cast<int64_t>(numVertices));
+    float* xyz = vertices->getPointer(0);
+    for(size_t i = 0; i < numVertices; i++)
+    {
+      xyz[3 * i] = static_cast<float>(i / 2);
+      xyz[3 * i + 1] = static_cast<float>(i % 2);
+      xyz[3 * i + 2] = 0.0f;
+    }
+
+    DataContainerArray::Pointer dca = DataContainerArray::New();
+    DataContainer::Pointer dc = DataContainer::New(DataContainerName);
+    dca->addDataContainer(dc);
+    if(quads)
+    {
+      QuadGeom::Pointer quadGeom = QuadGeom::CreateGeometry(static_cast<int64_t>(numFaces), vertices, SIMPL::Geometry::QuadGeometry);
+      int64_t* faces = quadGeom->getQuads()->getPointer(0);
+      for(size_t s = 0; s < numSquares; s++)
+      {
+        const int64_t v0 = static_cast<int64_t>(2 * s);
+        const int64_t square[4] = {v0, v0 + 2, v0 + 3, v0 + 1};
+        std::copy(square, square + 4, faces + 4 * s);
+      }
+      dc->setGeometry(quadGeom);
+    }
+    else
+    {
+      TriangleGeom::Pointer triangleGeom = TriangleGeom::CreateGeometry(static_cast<int64_t>(numFaces), vertices, SIMPL::Geometry::TriangleGeometry);
+      int64_t* faces = triangleGeom->getTriangles()->getPointer(0);
+      for(size_t s = 0; s < numSquares; s++)
+      {
+        const int64_t v0 = static_cast<int64_t>(2 * s);
+        const int64_t square[6] = {v0, v0 + 2, v0 + 1, v0 + 1, v0 + 2, v0 + 3};
+        std::copy(square, square + 6, faces + 6 * s);
+      }
+      dc->setGeometry(triangleGeom);
+    }
+
+    QVector<size_t> tDims = {numFaces};
+    AttributeMatrix::Pointer am = AttributeMatrix::New(tDims, AttributeMatrixName, AttributeMatrix::Type::Face);
+    dc->addAttributeMatrix(AttributeMatrixName, am);
+    FloatArrayType::Pointer faceValues = FloatArrayType::CreateArray(numFaces, NoiseDataArrayName);
+    Int32ArrayType::Pointer featureIds = Int32ArrayType::CreateArray(numFaces, ErrorDataArrayName);
+    for(size_t i = 0; i < numFaces; i++)
+    {
+      faceValues->setValue(i, 0.5f * static_cast<float>(i));
+      featureIds->setValue(i, static_cast<int32_t>((i / 5) % 4));
+    }
+    am->addAttributeArray(NoiseDataArrayName, faceValues);
+    am->addAttributeArray(ErrorDataArrayName, featureIds);
+    return dca;
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  int TestLoadWithMoab()
+  {
+    // Each Feature is a 2 x 5 x 2 block of the 6 x 5 x 4 volume, which its set must return
+    const size_t k_Dims[3] = {6, 5, 4};
+    const size_t k_NumCells = k_Dims[0] * k_Dims[1] * k_Dims[2];
+    const size_t k_NumParts = 3;
+    DoubleArrayType::Pointer cellValues = DoubleArrayType::CreateArray(k_NumCells, DataArrayName);
+    Int32ArrayType::Pointer featureIds = Int32ArrayType::CreateArray(k_NumCells, ErrorDataArrayName);
+    for(size_t i = 0; i < k_NumCells; i++)
+    {
+      const size_t x = i % k_Dims[0];
+      const size_t z = i / (k_Dims[0] * k_Dims[1]);
+      cellValues->setValue(i, 0.5 * static_cast<double>(i) - 7.0);
+      featureIds->setValue(i, static_cast<int32_t>(1 + x / 2 + 3 * (z / 2)));
+    }
+    DataContainerArray::Pointer dca = CreateSyntheticVolume({k_Dims[0], k_Dims[1], k_Dims[2]}, {cellValues, featureIds});
+
+    AbstractFilter::Pointer filter = CreateExportFilter();
+    DREAM3D_REQUIRE_VALID_POINTER(filter.get());
+    filter->setDataContainerArray(dca);
+
+    QVector<DataArrayPath> paths = {DataArrayPath(DataContainerName, AttributeMatrixName, DataArrayName), DataArrayPath(DataContainerName, AttributeMatrixName, ErrorDataArrayName)};
+    QVariant var;
+    var.setValue(paths);
+    filter->setProperty("SelectedArrayPaths", var);
+    var.setValue(DataArrayPath(DataContainerName, AttributeMatrixName, ErrorDataArrayName));
+    filter->setProperty("FeatureIdsArrayPath", var);
+    filter->setProperty("WriteFeatureSets", true);
+    filter->setProperty("WritePartitionSets", true);
+    filter->setProperty("PartitionCount", static_cast<int>(k_NumParts));
+    filter->setProperty("PartitionStrategy", 1);
+    var.setValue(UnitTest::ExportMoabMeshTest::MoabHexOutputFile);
+    filter->setProperty("OutputFile", var);
+
+    // The explicit and streaming modes share the writer but not the way they feed it
+    const size_t numNodes = (k_Dims[0] + 1) * (k_Dims[1] + 1) * (k_Dims[2] + 1);
+    for(ExportMoabMesh::ExportModeType mode : {ExportMoabMesh::ExportModeType::ExplicitHex, ExportMoabMesh::ExportModeType::StreamingSlabs})
+    {
+      filter->setProperty("ExportMode", static_cast<int>(mode));
+      filter->execute();
+      DREAM3D_REQUIRE_EQUAL(filter->getErrorCondition(), 0);
+
+      int err = CheckMoabFile(UnitTest::ExportMoabMeshTest::MoabHexOutputFile, moab::MBHEX, numNodes, featureIds, k_NumParts, {cellValues, featureIds});
+      DREAM3D_REQUIRE_EQUAL(err, EXIT_SUCCESS);
+    }
+
+    // The element list writer, for triangles and quadrilaterals
+    const size_t k_NumSquares = 30;
+    const std::vector<std::pair<bool, QString>> strips = {{false, UnitTest::ExportMoabMeshTest::MoabTriOutputFile}, {true, UnitTest::ExportMoabMeshTest::MoabQuadOutputFile}};
+    for(const std::pair<bool, QString>& strip : strips)
+    {
+      DataContainerArray::Pointer stripDca = CreateFaceStrip(k_NumSquares, strip.first);
+      filter->setDataContainerArray(stripDca);
+      filter->setProperty("ExportMode", static_cast<int>(ExportMoabMesh::ExportModeType::ExplicitHex));
+      paths = {DataArrayPath(DataContainerName, AttributeMatrixName, NoiseDataArrayName)};
+      var.setValue(paths);
+      filter->setProperty("SelectedArrayPaths", var);
+      var.setValue(strip.second);
+      filter->setProperty("OutputFile", var);
+      filter->execute();
+      DREAM3D_REQUIRE_EQUAL(filter->getErrorCondition(), 0);
+
+      AttributeMatrix::Pointer am = stripDca->getDataContainer(DataContainerName)->getAttributeMatrix(AttributeMatrixName);
+      Int32ArrayType::Pointer faceFeatureIds = std::dynamic_pointer_cast<Int32ArrayType>(am->getAttributeArray(ErrorDataArrayName));
+      IDataArray::Pointer faceValues = am->getAttributeArray(NoiseDataArrayName);
+      moab::EntityType elementType = strip.first ? moab::MBQUAD : moab::MBTRI;
+      int err = CheckMoabFile(strip.second, elementType, 2 * (k_NumSquares + 1), faceFeatureIds, k_NumParts, {faceValues});
+      DREAM3D_REQUIRE_EQUAL(err, EXIT_SUCCESS);
+    }
+
+    return EXIT_SUCCESS;
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  int TestLegacySelectedArrayPath()
+  {
+    AbstractFilter::Pointer filter = CreateExportFilter();
+    DREAM3D_REQUIRE_VALID_POINTER(filter.get());
+
+    // Pipelines saved before multiple arrays were supported store one SelectedArrayPath
+    DataArrayPath legacyPath(DataContainerName, AttributeMatrixName, DataArrayName);
+    QJsonObject pathObj;
+    legacyPath.writeJson(pathObj);
+    QJsonObject filterObj;
+    filterObj["SelectedArrayPath"] = pathObj;
+
+    filter->readFilterParameters(filterObj);
+
+    QVector<DataArrayPath> paths = filter->property("SelectedArrayPaths").value<QVector<DataArrayPath>>();
+    DREAM3D_REQUIRE_EQUAL(paths.size(), 1);
+    DREAM3D_REQUIRE_EQUAL(paths[0].getDataArrayName(), DataArrayName);
+
+    return EXIT_SUCCESS;
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void operator()()
+  {
+    int err = EXIT_SUCCESS;
+
+    DREAM3D_REGISTER_TEST( TestFilterAvailability() );
+
+    DREAM3D_REGISTER_TEST( TestExportMoabMesh() )
+
+    DREAM3D_REGISTER_TEST( TestExportStructuredBox() )
+
+    DREAM3D_REGISTER_TEST( TestExportStreamingSlabs() )
+
+    DREAM3D_REGISTER_TEST( TestExportNativeTypes() )
+
+    DREAM3D_REGISTER_TEST( TestExportFeatureSets() )
+
+    DREAM3D_REGISTER_TEST( TestExportFeatureBoundaries() )
+
+    DREAM3D_REGISTER_TEST( TestExportRegionOfInterest() )
+
+    DREAM3D_REGISTER_TEST( TestExportCoarsenedOctree() )
+
+    DREAM3D_REGISTER_TEST( TestExportCompressed() )
+
+    DREAM3D_REGISTER_TEST( TestExportPipelinedBlocks() )
+
+    DREAM3D_REGISTER_TEST( TestExportPartitionSets() )
+
+    DREAM3D_REGISTER_TEST( TestExportBatch() )
+
+    DREAM3D_REGISTER_TEST( TestReuseUnchangedMesh() )
+
+    DREAM3D_REGISTER_TEST( TestExportEstimate() )
+
+    DREAM3D_REGISTER_TEST( TestExportCancelled() )
+
+    DREAM3D_REGISTER_TEST( TestExportExodus() )
+
+    DREAM3D_REGISTER_TEST( TestExportMeshOrdering() )
+
+    DREAM3D_REGISTER_TEST( TestExportElementList() )
+
+    DREAM3D_REGISTER_TEST( TestExportHexahedral() )
+
+    DREAM3D_REGISTER_TEST( TestLoadWithMoab() )
+
+    DREAM3D_REGISTER_TEST( TestLegacySelectedArrayPath() )
 
     DREAM3D_REGISTER_TEST( RemoveTestFiles() )
   }
@@ -0,0 +1,140 @@
+/* ============================================================================
+* Copyright (c) 2018 BlueQuartz Software, LLC
+*
+* Redistribution and use in source and binary forms, with or without modification,
+* are permitted provided that the following conditions are met:
+*
+* Redistributions of source code must retain the above copyright notice, this
+* list of conditions and the following disclaimer.
+*
+* Redistributions in binary form must reproduce the above copyright notice, this
+* list of conditions and the following disclaimer in the documentation and/or
+* other materials provided with the distribution.
+*
+* Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+* contributors may be used to endorse or promote products derived from this software
+* without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+* DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+* FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+* DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+* OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+* USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*
+* ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+
+#include <QtCore/QElapsedTimer>
+
+#include <vtkIdList.h>
+#include <vtkSmartPointer.h>
+
+#include "SIMPLib/Geometry/TetrahedralGeom.h"
+
+#include "Utilities/VtkTetrahedralGeom.h"
+
+// -----------------------------------------------------------------------------
+// Measures the GetCellPoints throughput of the mapped tetrahedral grid. The
+// reference loop repeats what each wrapper did before VtkFixedCellGeom: a virtual
+// getVertsAt* call into the geometry followed by one vtkIdList::SetId per point.
+//
+// Usage: VtkFixedCellGeomBenchmark [numberOfCells] [numberOfPasses]
+// The default of 10^8 cells needs about 3.2 GB for the connectivity.
+// -----------------------------------------------------------------------------
+
+namespace
+{
+const int64_t k_NumVertices = 1 << 20;
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void ReferenceGetCellPoints(TetrahedralGeom* geom, vtkIdType cellId, vtkIdList* ptIds)
+{
+  const int numVerts = 4;
+
+  int64_t verts[numVerts];
+  geom->getVertsAtTet(cellId, verts);
+
+  ptIds->SetNumberOfIds(numVerts);
+  for(int i = 0; i < numVerts; i++)
+  {
+    ptIds->SetId(i, verts[i]);
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+template <typename Func>
+double MeasureCellsPerSecond(const char* name, int64_t numCells, int passes, Func getCellPoints)
+{
+  vtkSmartPointer<vtkIdList> ptIds = vtkSmartPointer<vtkIdList>::New();
+  vtkIdType checksum = 0;
+  double best = 0.0;
+  for(int pass = 0; pass < passes; pass++)
+  {
+    QElapsedTimer timer;
+    timer.start();
+    for(int64_t cellId = 0; cellId < numCells; cellId++)
+    {
+      getCellPoints(cellId, ptIds);
+      checksum += ptIds->GetId(3);
+    }
+    double seconds = static_cast<double>(timer.nsecsElapsed()) * 1.0e-9;
+    double rate = static_cast<double>(numCells) / seconds;
+    best = rate > best ? rate : best;
+  }
+  std::cout << name << ": " << best * 1.0e-6 << " M cells/s (checksum " << checksum << ")" << std::endl;
+  return best;
+}
+} // namespace
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int main(int argc, char* argv[])
+{
+  int64_t numCells = (argc > 1) ? std::atoll(argv[1]) : 100000000LL;
+  int passes = (argc > 2) ? std::atoi(argv[2]) : 3;
+  if(numCells <= 0 || passes <= 0)
+  {
+    std::cout << "Usage: " << argv[0] << " [numberOfCells] [numberOfPasses]" << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  // The points are never read, so a small vertex list is shared by all the cells
+  SharedVertexList::Pointer vertices = TetrahedralGeom::CreateSharedVertexList(k_NumVertices);
+  vertices->initializeWithZeros();
+  TetrahedralGeom::Pointer geom = TetrahedralGeom::CreateGeometry(numCells, vertices, "Benchmark");
+  int64_t* tets = geom->getTetrahedra()->getPointer(0);
+  for(int64_t i = 0; i < numCells; i++)
+  {
+    for(int64_t j = 0; j < 4; j++)
+    {
+      tets[4 * i + j] = (i + j) % k_NumVertices;
+    }
+  }
+
+  vtkSmartPointer<VtkTetrahedralGrid> grid = vtkSmartPointer<VtkTetrahedralGrid>::New();
+  VtkTetrahedralGeom* impl = grid->GetImplementation();
+  impl->SetGeometry(geom);
+
+  std::cout << numCells << " tetrahedra, best of " << passes << " passes" << std::endl;
+  double reference = MeasureCellsPerSecond("getVertsAtTet + SetId", numCells, passes,
+                                           [&](int64_t cellId, vtkIdList* ptIds) { ReferenceGetCellPoints(geom.get(), cellId, ptIds); });
+  double fixed = MeasureCellsPerSecond("VtkFixedCellGeom::GetCellPoints", numCells, passes,
+                                       [&](int64_t cellId, vtkIdList* ptIds) { impl->GetCellPoints(cellId, ptIds); });
+  MeasureCellsPerSecond("VtkTetrahedralGrid::GetCellPoints", numCells, passes, [&](int64_t cellId, vtkIdList* ptIds) { grid->GetCellPoints(cellId, ptIds); });
+  std::cout << "Speedup: " << fixed / reference << "x" << std::endl;
+
+  return EXIT_SUCCESS;
+}
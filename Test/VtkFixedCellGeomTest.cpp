@@ -0,0 +1,468 @@
+/* ============================================================================
+* Copyright (c) 2018 BlueQuartz Software, LLC
+*
+* Redistribution and use in source and binary forms, with or without modification,
+* are permitted provided that the following conditions are met:
+*
+* Redistributions of source code must retain the above copyright notice, this
+* list of conditions and the following disclaimer.
+*
+* Redistributions in binary form must reproduce the above copyright notice, this
+* list of conditions and the following disclaimer in the documentation and/or
+* other materials provided with the distribution.
+*
+* Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+* contributors may be used to endorse or promote products derived from this software
+* without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+* DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+* FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+* DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+* OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+* USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*
+* ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#include <algorithm>
+#include <atomic>
+#include <thread>
+#include <vector>
+
+#include <vtkCellArray.h>
+#include <vtkCellData.h>
+#include <vtkCellType.h>
+#include <vtkDataArray.h>
+#include <vtkIdList.h>
+#include <vtkIdTypeArray.h>
+#include <vtkSmartPointer.h>
+#include <vtkUnstructuredGrid.h>
+
+#include "SIMPLib/SIMPLib.h"
+#include "SIMPLib/DataArrays/DataArray.hpp"
+#include "SIMPLib/DataContainers/AttributeMatrix.h"
+#include "SIMPLib/DataContainers/DataContainer.h"
+#include "SIMPLib/Geometry/EdgeGeom.h"
+#include "SIMPLib/Geometry/HexahedralGeom.h"
+#include "SIMPLib/Geometry/QuadGeom.h"
+#include "SIMPLib/Geometry/TetrahedralGeom.h"
+#include "SIMPLib/Geometry/TriangleGeom.h"
+#include "SIMPLib/Geometry/VertexGeom.h"
+
+#include "SMTKPlugin/Utilities/SIMPLVtkBridge.h"
+#include "SMTKPlugin/Utilities/VtkEdgeGeom.h"
+#include "SMTKPlugin/Utilities/VtkHexahedralGeom.h"
+#include "SMTKPlugin/Utilities/VtkQuadGeom.h"
+#include "SMTKPlugin/Utilities/VtkTetrahedralGeom.h"
+#include "SMTKPlugin/Utilities/VtkTriangleGeom.h"
+#include "SMTKPlugin/Utilities/VtkVertexGeom.h"
+
+#include "UnitTestSupport.hpp"
+
+class VtkFixedCellGeomTest
+{
+
+  public:
+    VtkFixedCellGeomTest() {}
+    virtual ~VtkFixedCellGeomTest() {}
+
+  // -----------------------------------------------------------------------------
+  // Creates a geometry of numCells cells over numVertices vertices. The vertex IDs
+  // of the cells are spread over the vertex list so that neighbouring cells share
+  // some of their vertices but never list them in the same order.
+  // -----------------------------------------------------------------------------
+  template <typename GeomT>
+  typename GeomT::Pointer CreateCellGeometry(int64_t numCells, int64_t numVertices, int cellSize)
+  {
+    SharedVertexList::Pointer vertices = GeomT::CreateSharedVertexList(numVertices);
+    float* xyz = vertices->getPointer(0);
+    for(int64_t i = 0; i < numVertices; i++)
+    {
+      xyz[3 * i] = static_cast<float>(i);
+      xyz[3 * i + 1] = static_cast<float>(i % 7);
+      xyz[3 * i + 2] = static_cast<float>(i % 3);
+    }
+
+    typename GeomT::Pointer geom = GeomT::CreateGeometry(numCells, vertices, "FixedCellGeometry");
+    if(numCells > 0)
+    {
+      int64_t* cells = VtkFixedCell::GetElementList(*geom)->getPointer(0);
+      for(int64_t i = 0; i < numCells; i++)
+      {
+        for(int j = 0; j < cellSize; j++)
+        {
+          cells[i * cellSize + j] = (i * 5 + j * 11) % numVertices;
+        }
+      }
+    }
+    return geom;
+  }
+
+  // -----------------------------------------------------------------------------
+  // Compares the wrapper of a geometry with the getVertsAt* function of the geometry,
+  // then checks that a geometry without cells reports the empty cell type
+  // -----------------------------------------------------------------------------
+  template <typename VtkGeomT, typename GeomT, typename VertsAtFunc>
+  int CheckCellPoints(typename GeomT::Pointer geom, typename GeomT::Pointer emptyGeom, int cellType, int cellSize, VertsAtFunc getVertsAt)
+  {
+    vtkSmartPointer<VtkGeomT> wrapper = vtkSmartPointer<VtkGeomT>::New();
+    wrapper->SetGeometry(geom);
+
+    const vtkIdType numCells = static_cast<vtkIdType>(geom->getNumberOfElements());
+    DREAM3D_REQUIRE_EQUAL(wrapper->GetNumberOfCells(), numCells)
+    DREAM3D_REQUIRE_EQUAL(wrapper->GetMaxCellSize(), cellSize)
+    DREAM3D_REQUIRE_EQUAL(wrapper->IsHomogeneous(), 1)
+
+    vtkSmartPointer<vtkIdList> ptIds = vtkSmartPointer<vtkIdList>::New();
+    std::vector<int64_t> verts(cellSize);
+    for(vtkIdType cellId = 0; cellId < numCells; cellId++)
+    {
+      DREAM3D_REQUIRE_EQUAL(wrapper->GetCellType(cellId), cellType)
+
+      wrapper->GetCellPoints(cellId, ptIds);
+      getVertsAt(*geom, cellId, verts.data());
+      DREAM3D_REQUIRE_EQUAL(ptIds->GetNumberOfIds(), cellSize)
+      for(int i = 0; i < cellSize; i++)
+      {
+        DREAM3D_REQUIRE_EQUAL(ptIds->GetId(i), verts[i])
+      }
+    }
+
+    wrapper->SetGeometry(emptyGeom);
+    DREAM3D_REQUIRE_EQUAL(wrapper->GetNumberOfCells(), 0)
+    DREAM3D_REQUIRE_EQUAL(wrapper->GetCellType(0), VTK_EMPTY_CELL)
+
+    return EXIT_SUCCESS;
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  int TestCellPoints()
+  {
+    const int64_t k_NumCells = 200;
+    const int64_t k_NumVertices = 97;
+
+    // The cells of a VertexGeom are its vertices, so it has no element list
+    VertexGeom::Pointer vertexGeom = VertexGeom::CreateGeometry(k_NumVertices, "FixedCellGeometry");
+    VertexGeom::Pointer emptyVertexGeom = VertexGeom::CreateGeometry(0, "FixedCellGeometry");
+    DREAM3D_REQUIRE_EQUAL(VtkFixedCell::GetElementList(*vertexGeom).get(), nullptr)
+    CheckCellPoints<VtkVertexGeom, VertexGeom>(vertexGeom, emptyVertexGeom, VTK_VERTEX, 1,
+                                               [](VertexGeom&, int64_t cellId, int64_t* verts) { verts[0] = cellId; });
+
+    CheckCellPoints<VtkEdgeGeom, EdgeGeom>(CreateCellGeometry<EdgeGeom>(k_NumCells, k_NumVertices, 2), CreateCellGeometry<EdgeGeom>(0, k_NumVertices, 2),
+                                           VTK_LINE, 2, [](EdgeGeom& geom, int64_t cellId, int64_t* verts) { geom.getVertsAtEdge(cellId, verts); });
+
+    CheckCellPoints<VtkTriangleGeom, TriangleGeom>(CreateCellGeometry<TriangleGeom>(k_NumCells, k_NumVertices, 3), CreateCellGeometry<TriangleGeom>(0, k_NumVertices, 3),
+                                                   VTK_TRIANGLE, 3, [](TriangleGeom& geom, int64_t cellId, int64_t* verts) { geom.getVertsAtTri(cellId, verts); });
+
+    CheckCellPoints<VtkQuadGeom, QuadGeom>(CreateCellGeometry<QuadGeom>(k_NumCells, k_NumVertices, 4), CreateCellGeometry<QuadGeom>(0, k_NumVertices, 4),
+                                           VTK_QUAD, 4, [](QuadGeom& geom, int64_t cellId, int64_t* verts) { geom.getVertsAtQuad(cellId, verts); });
+
+    CheckCellPoints<VtkTetrahedralGeom, TetrahedralGeom>(CreateCellGeometry<TetrahedralGeom>(k_NumCells, k_NumVertices, 4), CreateCellGeometry<TetrahedralGeom>(0, k_NumVertices, 4),
+                                                         VTK_TETRA, 4, [](TetrahedralGeom& geom, int64_t cellId, int64_t* verts) { geom.getVertsAtTet(cellId, verts); });
+
+    CheckCellPoints<VtkHexahedralGeom, HexahedralGeom>(CreateCellGeometry<HexahedralGeom>(k_NumCells, k_NumVertices, 8), CreateCellGeometry<HexahedralGeom>(0, k_NumVertices, 8),
+                                                       VTK_HEXAHEDRON, 8, [](HexahedralGeom& geom, int64_t cellId, int64_t* verts) { geom.getVertsAtHex(cellId, verts); });
+
+    return EXIT_SUCCESS;
+  }
+
+  // -----------------------------------------------------------------------------
+  // Compares the blocks of cells that exporters read, GetCellPointsRange and
+  // GetCellArray, with GetCellPoints of each cell
+  // -----------------------------------------------------------------------------
+  template <typename VtkGeomT, typename GeomT>
+  int CheckCellBlocks(typename GeomT::Pointer geom)
+  {
+    vtkSmartPointer<VtkGeomT> wrapper = vtkSmartPointer<VtkGeomT>::New();
+    wrapper->SetGeometry(geom);
+
+    const vtkIdType numCells = wrapper->GetNumberOfCells();
+    const int cellSize = wrapper->GetMaxCellSize();
+    vtkSmartPointer<vtkIdList> ptIds = vtkSmartPointer<vtkIdList>::New();
+
+    // The whole geometry, then a range that starts and ends inside it
+    const vtkIdType ranges[2][2] = {{0, numCells}, {numCells / 3, numCells - 7}};
+    for(const auto& range : ranges)
+    {
+      std::vector<vtkIdType> block((range[1] - range[0]) * cellSize, -1);
+      wrapper->GetCellPointsRange(range[0], range[1], block.data());
+      for(vtkIdType cellId = range[0]; cellId < range[1]; cellId++)
+      {
+        wrapper->GetCellPoints(cellId, ptIds);
+        for(int i = 0; i < cellSize; i++)
+        {
+          DREAM3D_REQUIRE_EQUAL(block[(cellId - range[0]) * cellSize + i], ptIds->GetId(i))
+        }
+      }
+    }
+
+    // Each cell of a vtkCellArray is its point count followed by its point IDs
+    vtkSmartPointer<vtkCellArray> cellArray = wrapper->GetCellArray();
+    DREAM3D_REQUIRE_EQUAL(cellArray->GetNumberOfCells(), numCells)
+    vtkIdTypeArray* cells = cellArray->GetData();
+    DREAM3D_REQUIRE_EQUAL(cells->GetNumberOfValues(), numCells * (cellSize + 1))
+    for(vtkIdType cellId = 0; cellId < numCells; cellId++)
+    {
+      wrapper->GetCellPoints(cellId, ptIds);
+      const vtkIdType* cell = cells->GetPointer(cellId * (cellSize + 1));
+      DREAM3D_REQUIRE_EQUAL(cell[0], cellSize)
+      for(int i = 0; i < cellSize; i++)
+      {
+        DREAM3D_REQUIRE_EQUAL(cell[i + 1], ptIds->GetId(i))
+      }
+    }
+
+    return EXIT_SUCCESS;
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  int TestCellBlocks()
+  {
+    const int64_t k_NumCells = 200;
+    const int64_t k_NumVertices = 97;
+
+    CheckCellBlocks<VtkVertexGeom, VertexGeom>(VertexGeom::CreateGeometry(k_NumVertices, "FixedCellGeometry"));
+    CheckCellBlocks<VtkEdgeGeom, EdgeGeom>(CreateCellGeometry<EdgeGeom>(k_NumCells, k_NumVertices, 2));
+    CheckCellBlocks<VtkTriangleGeom, TriangleGeom>(CreateCellGeometry<TriangleGeom>(k_NumCells, k_NumVertices, 3));
+    CheckCellBlocks<VtkQuadGeom, QuadGeom>(CreateCellGeometry<QuadGeom>(k_NumCells, k_NumVertices, 4));
+    CheckCellBlocks<VtkTetrahedralGeom, TetrahedralGeom>(CreateCellGeometry<TetrahedralGeom>(k_NumCells, k_NumVertices, 4));
+    CheckCellBlocks<VtkHexahedralGeom, HexahedralGeom>(CreateCellGeometry<HexahedralGeom>(k_NumCells, k_NumVertices, 8));
+
+    return EXIT_SUCCESS;
+  }
+
+  // -----------------------------------------------------------------------------
+  // The exporters wrap a TriangleGeom as a vtkUnstructuredGrid built from
+  // GetCellArray, so the selected Face arrays must follow the cells into it
+  // -----------------------------------------------------------------------------
+  int TestWrapTrianglesForExport()
+  {
+    const int64_t k_NumTriangles = 120;
+    const int64_t k_NumVertices = 61;
+    const QString k_DataContainerName = "TriangleDataContainer";
+    const QString k_FaceDataName = "FaceData";
+    const QString k_SelectedArrayName = "FaceIndices";
+    const QString k_SkippedArrayName = "FaceLabels";
+
+    TriangleGeom::Pointer triangleGeom = CreateCellGeometry<TriangleGeom>(k_NumTriangles, k_NumVertices, 3);
+    DataContainer::Pointer dc = DataContainer::New(k_DataContainerName);
+    dc->setGeometry(triangleGeom);
+    QVector<size_t> tDims = {static_cast<size_t>(k_NumTriangles)};
+    AttributeMatrix::Pointer am = AttributeMatrix::New(tDims, k_FaceDataName, AttributeMatrix::Type::Face);
+    dc->addAttributeMatrix(k_FaceDataName, am);
+
+    FloatArrayType::Pointer faceIndices = FloatArrayType::CreateArray(k_NumTriangles, k_SelectedArrayName);
+    Int32ArrayType::Pointer faceLabels = Int32ArrayType::CreateArray(k_NumTriangles, k_SkippedArrayName);
+    for(int64_t i = 0; i < k_NumTriangles; i++)
+    {
+      faceIndices->setValue(i, static_cast<float>(i));
+      faceLabels->setValue(i, static_cast<int32_t>(i % 4));
+    }
+    am->addAttributeArray(k_SelectedArrayName, faceIndices);
+    am->addAttributeArray(k_SkippedArrayName, faceLabels);
+
+    QVector<DataArrayPath> arrayPaths = {DataArrayPath(k_DataContainerName, k_FaceDataName, k_SelectedArrayName)};
+    VTK_PTR(vtkDataSet) dataSet = SIMPLVtkBridge::WrapDataContainerForExport(dc, arrayPaths);
+    vtkUnstructuredGrid* grid = vtkUnstructuredGrid::SafeDownCast(dataSet);
+    DREAM3D_REQUIRE(nullptr != grid)
+    DREAM3D_REQUIRE_EQUAL(grid->GetNumberOfPoints(), k_NumVertices)
+    DREAM3D_REQUIRE_EQUAL(grid->GetNumberOfCells(), k_NumTriangles)
+
+    vtkSmartPointer<vtkIdList> ptIds = vtkSmartPointer<vtkIdList>::New();
+    int64_t verts[3] = {0, 0, 0};
+    for(int64_t cellId = 0; cellId < k_NumTriangles; cellId++)
+    {
+      DREAM3D_REQUIRE_EQUAL(grid->GetCellType(cellId), VTK_TRIANGLE)
+      grid->GetCellPoints(cellId, ptIds);
+      triangleGeom->getVertsAtTri(cellId, verts);
+      DREAM3D_REQUIRE_EQUAL(ptIds->GetNumberOfIds(), 3)
+      for(int i = 0; i < 3; i++)
+      {
+        DREAM3D_REQUIRE_EQUAL(ptIds->GetId(i), verts[i])
+      }
+    }
+
+    vtkCellData* cellData = grid->GetCellData();
+    DREAM3D_REQUIRE_EQUAL(cellData->GetNumberOfArrays(), 1)
+    DREAM3D_REQUIRE(nullptr == cellData->GetArray(k_SkippedArrayName.toLatin1().constData()))
+    vtkDataArray* selected = cellData->GetArray(k_SelectedArrayName.toLatin1().constData());
+    DREAM3D_REQUIRE(nullptr != selected)
+    DREAM3D_REQUIRE_EQUAL(selected->GetNumberOfTuples(), k_NumTriangles)
+    DREAM3D_REQUIRE_EQUAL(selected->GetNumberOfComponents(), 1)
+    for(int64_t i = 0; i < k_NumTriangles; i++)
+    {
+      DREAM3D_REQUIRE_EQUAL(selected->GetComponent(i, 0), static_cast<double>(i))
+    }
+
+    return EXIT_SUCCESS;
+  }
+
+  // -----------------------------------------------------------------------------
+  // Several threads ask a fresh wrapper for the cells of every vertex at the same
+  // time, so the first calls race to build the point to cell links. Every thread
+  // must see the same lists as findElementsContainingVert of the geometry.
+  // -----------------------------------------------------------------------------
+  int TestConcurrentPointCells()
+  {
+    const int64_t k_NumTets = 20000;
+    const int64_t k_NumVertices = 1009;
+    const int k_NumThreads = 4;
+
+    TetrahedralGeom::Pointer tetGeom = CreateCellGeometry<TetrahedralGeom>(k_NumTets, k_NumVertices, 4);
+    DREAM3D_REQUIRE(nullptr == tetGeom->getElementsContainingVert())
+
+    vtkSmartPointer<VtkTetrahedralGeom> wrapper = vtkSmartPointer<VtkTetrahedralGeom>::New();
+    wrapper->SetGeometry(tetGeom);
+
+    std::vector<vtkSmartPointer<vtkIdList>> cellIds(k_NumThreads);
+    std::vector<std::vector<std::vector<vtkIdType>>> threadCells(k_NumThreads, std::vector<std::vector<vtkIdType>>(k_NumVertices));
+    for(int t = 0; t < k_NumThreads; t++)
+    {
+      cellIds[t] = vtkSmartPointer<vtkIdList>::New();
+    }
+
+    std::atomic<bool> go(false);
+    std::vector<std::thread> threads;
+    for(int t = 0; t < k_NumThreads; t++)
+    {
+      threads.emplace_back([&, t]() {
+        while(!go.load())
+        {
+          std::this_thread::yield();
+        }
+        // Each thread starts at a different vertex
+        for(int64_t i = 0; i < k_NumVertices; i++)
+        {
+          const int64_t v = (i + t * k_NumVertices / k_NumThreads) % k_NumVertices;
+          wrapper->GetPointCells(v, cellIds[t]);
+          const vtkIdType* ids = cellIds[t]->GetPointer(0);
+          threadCells[t][v].assign(ids, ids + cellIds[t]->GetNumberOfIds());
+        }
+      });
+    }
+    go.store(true);
+    for(std::thread& thread : threads)
+    {
+      thread.join();
+    }
+
+    // A wrapper created after findElementsContainingVert reads the lists of the geometry
+    DREAM3D_REQUIRE(tetGeom->findElementsContainingVert() >= 0)
+    ElementDynamicList::Pointer cellsContainingVert = tetGeom->getElementsContainingVert();
+    DREAM3D_REQUIRE(nullptr != cellsContainingVert)
+    vtkSmartPointer<VtkTetrahedralGeom> linkedWrapper = vtkSmartPointer<VtkTetrahedralGeom>::New();
+    linkedWrapper->SetGeometry(tetGeom);
+    vtkSmartPointer<vtkIdList> linkedIds = vtkSmartPointer<vtkIdList>::New();
+
+    for(int64_t v = 0; v < k_NumVertices; v++)
+    {
+      ElementDynamicList::ElementList& list = cellsContainingVert->getElementList(v);
+      std::vector<vtkIdType> expected(list.cells, list.cells + list.ncells);
+      std::sort(expected.begin(), expected.end());
+
+      for(int t = 0; t < k_NumThreads; t++)
+      {
+        DREAM3D_REQUIRE(threadCells[t][v] == expected)
+      }
+
+      linkedWrapper->GetPointCells(v, linkedIds);
+      std::vector<vtkIdType> linked(linkedIds->GetPointer(0), linkedIds->GetPointer(0) + linkedIds->GetNumberOfIds());
+      std::sort(linked.begin(), linked.end());
+      DREAM3D_REQUIRE(linked == expected)
+    }
+
+    return EXIT_SUCCESS;
+  }
+
+  // -----------------------------------------------------------------------------
+  // Every cell of a wrapper has its cell type, so GetIdsOfCellsOfType returns
+  // either all of the cell IDs or none, resizing the array it is given
+  // -----------------------------------------------------------------------------
+  template <typename VtkGeomT, typename GeomT>
+  int CheckIdsOfCellsOfType(typename GeomT::Pointer geom, int cellType, int otherCellType)
+  {
+    vtkSmartPointer<VtkGeomT> wrapper = vtkSmartPointer<VtkGeomT>::New();
+    wrapper->SetGeometry(geom);
+    const vtkIdType numCells = wrapper->GetNumberOfCells();
+
+    vtkSmartPointer<vtkIdTypeArray> ids = vtkSmartPointer<vtkIdTypeArray>::New();
+    wrapper->GetIdsOfCellsOfType(cellType, ids);
+    DREAM3D_REQUIRE_EQUAL(ids->GetNumberOfComponents(), 1)
+    DREAM3D_REQUIRE_EQUAL(ids->GetNumberOfTuples(), numCells)
+    for(vtkIdType i = 0; i < numCells; i++)
+    {
+      DREAM3D_REQUIRE_EQUAL(ids->GetValue(i), i)
+    }
+
+    wrapper->GetIdsOfCellsOfType(otherCellType, ids);
+    DREAM3D_REQUIRE_EQUAL(ids->GetNumberOfTuples(), 0)
+
+    // A larger array from an earlier call is reused and shrunk to the cell IDs
+    vtkSmartPointer<vtkIdTypeArray> reused = vtkSmartPointer<vtkIdTypeArray>::New();
+    reused->SetNumberOfComponents(2);
+    reused->SetNumberOfTuples(numCells + 50);
+    for(vtkIdType i = 0; i < reused->GetNumberOfValues(); i++)
+    {
+      reused->SetValue(i, -1);
+    }
+    wrapper->GetIdsOfCellsOfType(cellType, reused);
+    DREAM3D_REQUIRE_EQUAL(reused->GetNumberOfComponents(), 1)
+    DREAM3D_REQUIRE_EQUAL(reused->GetNumberOfTuples(), numCells)
+    for(vtkIdType i = 0; i < numCells; i++)
+    {
+      DREAM3D_REQUIRE_EQUAL(reused->GetValue(i), i)
+    }
+    wrapper->GetIdsOfCellsOfType(otherCellType, reused);
+    DREAM3D_REQUIRE_EQUAL(reused->GetNumberOfTuples(), 0)
+
+    return EXIT_SUCCESS;
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  int TestIdsOfCellsOfType()
+  {
+    const int64_t k_NumCells = 200;
+    const int64_t k_NumVertices = 97;
+
+    CheckIdsOfCellsOfType<VtkVertexGeom, VertexGeom>(VertexGeom::CreateGeometry(k_NumVertices, "FixedCellGeometry"), VTK_VERTEX, VTK_LINE);
+    CheckIdsOfCellsOfType<VtkEdgeGeom, EdgeGeom>(CreateCellGeometry<EdgeGeom>(k_NumCells, k_NumVertices, 2), VTK_LINE, VTK_VERTEX);
+    CheckIdsOfCellsOfType<VtkTriangleGeom, TriangleGeom>(CreateCellGeometry<TriangleGeom>(k_NumCells, k_NumVertices, 3), VTK_TRIANGLE, VTK_QUAD);
+    CheckIdsOfCellsOfType<VtkQuadGeom, QuadGeom>(CreateCellGeometry<QuadGeom>(k_NumCells, k_NumVertices, 4), VTK_QUAD, VTK_TETRA);
+    CheckIdsOfCellsOfType<VtkTetrahedralGeom, TetrahedralGeom>(CreateCellGeometry<TetrahedralGeom>(k_NumCells, k_NumVertices, 4), VTK_TETRA, VTK_QUAD);
+    CheckIdsOfCellsOfType<VtkHexahedralGeom, HexahedralGeom>(CreateCellGeometry<HexahedralGeom>(k_NumCells, k_NumVertices, 8), VTK_HEXAHEDRON, VTK_TETRA);
+
+    return EXIT_SUCCESS;
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void operator()()
+  {
+    int err = EXIT_SUCCESS;
+
+    DREAM3D_REGISTER_TEST( TestCellPoints() )
+
+    DREAM3D_REGISTER_TEST( TestCellBlocks() )
+
+    DREAM3D_REGISTER_TEST( TestWrapTrianglesForExport() )
+
+    DREAM3D_REGISTER_TEST( TestConcurrentPointCells() )
+
+    DREAM3D_REGISTER_TEST( TestIdsOfCellsOfType() )
+  }
+
+  private:
+    VtkFixedCellGeomTest(const VtkFixedCellGeomTest&); // Copy Constructor Not Implemented
+    void operator=(const VtkFixedCellGeomTest&);       // Move assignment Not Implemented
+};
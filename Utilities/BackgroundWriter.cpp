@@ -0,0 +1,145 @@
+/* ============================================================================
+* Copyright (c) 2018 BlueQuartz Software, LLC
+*
+* Redistribution and use in source and binary forms, with or without modification,
+* are permitted provided that the following conditions are met:
+*
+* Redistributions of source code must retain the above copyright notice, this
+* list of conditions and the following disclaimer.
+*
+* Redistributions in binary form must reproduce the above copyright notice, this
+* list of conditions and the following disclaimer in the documentation and/or
+* other materials provided with the distribution.
+*
+* Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+* contributors may be used to endorse or promote products derived from this software
+* without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+* DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+* FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+* DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+* OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+* USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*
+* ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+
+#include "BackgroundWriter.h"
+
+#include <algorithm>
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+BackgroundWriter::BackgroundWriter(size_t queueDepth, size_t bufferBytes)
+: m_QueueDepth(std::max<size_t>(queueDepth, 1))
+{
+  if(bufferBytes > 0)
+  {
+    m_Buffers.resize(m_QueueDepth + 1, std::vector<uint8_t>(bufferBytes));
+  }
+  m_Thread = std::thread(&BackgroundWriter::run, this);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+BackgroundWriter::~BackgroundWriter()
+{
+  finish();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+size_t BackgroundWriter::getQueueDepth() const
+{
+  return m_QueueDepth;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void* BackgroundWriter::getBuffer()
+{
+  if(m_Buffers.empty())
+  {
+    return nullptr;
+  }
+  // At most m_QueueDepth tasks are pending once submit() returns, so the task that last used
+  // this buffer, m_QueueDepth + 1 submissions ago, has finished
+  return m_Buffers[m_NumSubmitted % m_Buffers.size()].data();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool BackgroundWriter::submit(Task task)
+{
+  std::unique_lock<std::mutex> lock(m_Mutex);
+  m_TaskDone.wait(lock, [this] { return m_NumPending < m_QueueDepth || m_Error < 0; });
+  m_NumSubmitted++;
+  if(m_Error < 0 || m_Stopping)
+  {
+    return false;
+  }
+  m_Tasks.push_back(std::move(task));
+  m_NumPending++;
+  m_TaskAdded.notify_one();
+  return true;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int BackgroundWriter::finish()
+{
+  {
+    std::lock_guard<std::mutex> lock(m_Mutex);
+    m_Stopping = true;
+  }
+  m_TaskAdded.notify_one();
+  if(m_Thread.joinable())
+  {
+    m_Thread.join();
+  }
+  return m_Error;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void BackgroundWriter::run()
+{
+  std::unique_lock<std::mutex> lock(m_Mutex);
+  while(true)
+  {
+    m_TaskAdded.wait(lock, [this] { return !m_Tasks.empty() || m_Stopping; });
+    if(m_Tasks.empty())
+    {
+      break;
+    }
+
+    Task task = std::move(m_Tasks.front());
+    m_Tasks.pop_front();
+    bool skip = (m_Error < 0);
+
+    // The producer keeps filling the next buffer while this task writes
+    lock.unlock();
+    int err = skip ? 0 : task();
+    task = Task();
+    lock.lock();
+
+    if(err < 0 && m_Error >= 0)
+    {
+      m_Error = err;
+    }
+    m_NumPending--;
+    m_TaskDone.notify_all();
+  }
+}
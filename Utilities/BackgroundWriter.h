@@ -0,0 +1,120 @@
+/* ============================================================================
+* Copyright (c) 2018 BlueQuartz Software, LLC
+*
+* Redistribution and use in source and binary forms, with or without modification,
+* are permitted provided that the following conditions are met:
+*
+* Redistributions of source code must retain the above copyright notice, this
+* list of conditions and the following disclaimer.
+*
+* Redistributions in binary form must reproduce the above copyright notice, this
+* list of conditions and the following disclaimer in the documentation and/or
+* other materials provided with the distribution.
+*
+* Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+* contributors may be used to endorse or promote products derived from this software
+* without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+* DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+* FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+* DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+* OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+* USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*
+* ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+
+#pragma once
+
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+/**
+ * @brief The BackgroundWriter class runs write tasks on a dedicated thread in the order they
+ * were submitted, so the next block of a mesh can be generated while the previous one is
+ * written. The queue is bounded: submit() blocks while getQueueDepth() tasks are waiting or
+ * running, which caps the memory held by blocks in flight.
+ *
+ * The writer owns getQueueDepth() + 1 block buffers that are handed out in turn by getBuffer().
+ * The buffer returned before a submit() belongs to that task until the task has run, and is
+ * not handed out again before then. A task may also write from memory owned by the caller.
+ *
+ * Libraries that are not thread safe, such as HDF5, must only be called from the tasks
+ * between construction and finish().
+ */
+class BackgroundWriter
+{
+public:
+  using Task = std::function<int()>;
+
+  /**
+   * @brief Constructor. Starts the writer thread.
+   * @param queueDepth Maximum number of tasks waiting or running, at least 1
+   * @param bufferBytes Size of each block buffer; may be 0 if getBuffer() is not used
+   */
+  BackgroundWriter(size_t queueDepth, size_t bufferBytes);
+
+  /**
+   * @brief Destructor. Waits for the submitted tasks like finish().
+   */
+  virtual ~BackgroundWriter();
+
+  /**
+   * @brief Returns the maximum number of tasks waiting or running
+   * @return
+   */
+  size_t getQueueDepth() const;
+
+  /**
+   * @brief Returns the buffer for the next task to be submitted
+   * @return
+   */
+  void* getBuffer();
+
+  /**
+   * @brief Queues a task, waiting first while the queue is full. Once a task has returned a
+   * negative value the remaining tasks are dropped without running.
+   * @param task
+   * @return false if an earlier task failed, in which case this task is dropped
+   */
+  bool submit(Task task);
+
+  /**
+   * @brief Waits for every submitted task and stops the writer thread
+   * @return The first negative value returned by a task, or 0
+   */
+  int finish();
+
+private:
+  void run();
+
+  size_t m_QueueDepth = 1;
+  std::vector<std::vector<uint8_t>> m_Buffers;
+  size_t m_NumSubmitted = 0;
+
+  std::mutex m_Mutex;
+  std::condition_variable m_TaskAdded;
+  std::condition_variable m_TaskDone;
+  std::deque<Task> m_Tasks;
+  size_t m_NumPending = 0;
+  bool m_Stopping = false;
+  int m_Error = 0;
+  std::thread m_Thread;
+
+public:
+  BackgroundWriter(const BackgroundWriter&) = delete;            // Copy Constructor Not Implemented
+  BackgroundWriter(BackgroundWriter&&) = delete;                 // Move Constructor Not Implemented
+  BackgroundWriter& operator=(const BackgroundWriter&) = delete; // Copy Assignment Not Implemented
+  BackgroundWriter& operator=(BackgroundWriter&&) = delete;      // Move Assignment Not Implemented
+};
@@ -0,0 +1,203 @@
+/* ============================================================================
+* Copyright (c) 2018 BlueQuartz Software, LLC
+*
+* Redistribution and use in source and binary forms, with or without modification,
+* are permitted provided that the following conditions are met:
+*
+* Redistributions of source code must retain the above copyright notice, this
+* list of conditions and the following disclaimer.
+*
+* Redistributions in binary form must reproduce the above copyright notice, this
+* list of conditions and the following disclaimer in the documentation and/or
+* other materials provided with the distribution.
+*
+* Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+* contributors may be used to endorse or promote products derived from this software
+* without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+* DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+* FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+* DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+* OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+* USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*
+* ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#include "ElementListH5mExporter.h"
+
+#include <algorithm>
+
+#include "SIMPLib/Geometry/VertexGeom.h"
+
+#include "BackgroundWriter.h"
+#include "ElementListMesher.h"
+#include "LabelCountingSort.h"
+#include "MeshPartitioner.h"
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+ElementListH5mExporter::ElementListH5mExporter(AbstractFilter* filter, const MeshExportSettings& settings)
+: MeshExporter(filter, settings)
+{
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+ElementListH5mExporter::~ElementListH5mExporter() = default;
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void ElementListH5mExporter::write(const IGeometry::Pointer& geom)
+{
+  GeometryElements elements;
+  GetGeometryElements(geom, elements);
+  const int64_t* elementList = elements.elements ? elements.elements->getPointer(0) : nullptr;
+  size_t listSize = elements.elements ? elements.elements->getNumberOfTuples() : 0;
+  ElementListMesher mesher(elements.vertices->getPointer(0), elements.vertices->getNumberOfTuples(), elementList, listSize, elements.nodesPerElement);
+  size_t numNodes = mesher.getNumberOfNodes();
+  size_t numElements = mesher.getNumberOfElements();
+
+  // Tag values go to the file straight from the memory of each array, which dataCheck() found
+  // to hold one tuple per element
+  std::vector<ExportTag> tags;
+  for(int i = 0; i < m_Settings.selectedWeakPtrVector.size(); i++)
+  {
+    ExportTag tag;
+    tag.name = m_Settings.selectedArrayPaths[i].getDataArrayName().toStdString() + "_";
+    tag.array = m_Settings.selectedWeakPtrVector[i].lock();
+    ExportTypeInfo typeInfo;
+    GetExportTypeInfo(tag.array->getTypeAsString(), typeInfo);
+    tag.hdf5Type = typeInfo.hdf5Type;
+    tag.numComponents = tag.array->getNumberOfComponents();
+    tag.tupleBytes = typeInfo.size * static_cast<size_t>(tag.numComponents);
+    tags.push_back(tag);
+  }
+
+  // The sets are sorted, and the partitions computed from the element centers, before the file
+  // is created so a bad label leaves no partial file behind
+  bool featurePartitions = (m_Settings.writePartitionSets && m_Settings.partitionStrategy == static_cast<int>(MeshPartitioner::Strategy::FeaturePreserving));
+  const int32_t* featureIds = (m_Settings.writeFeatureSets || featurePartitions) ? m_Settings.featureIdsPtr.lock()->getPointer(0) : nullptr;
+  LabelCountingSort featureSorter;
+  LabelCountingSort partSorter;
+  if(m_Settings.writeFeatureSets && !sortFeatureIds(featureSorter, featureIds, numElements))
+  {
+    return;
+  }
+  if(m_Settings.writePartitionSets)
+  {
+    std::vector<float> centers;
+    mesher.generateCenters(centers);
+    MeshPartitioner partitioner(static_cast<MeshPartitioner::Strategy>(m_Settings.partitionStrategy), static_cast<size_t>(m_Settings.partitionCount));
+    bool partitioned = partitioner.executeElements(centers, featureIds);
+    if(!sortPartitions(partSorter, partitioner.getParts(), partitioned))
+    {
+      return;
+    }
+  }
+
+  MoabH5mWriter writer;
+  applyCompression(writer);
+  if(writer.openFile(m_Settings.outputFile.toStdString()) < 0)
+  {
+    QString ss = QObject::tr("Unable to create the output file '%1'.").arg(m_Settings.outputFile);
+    setErrorCondition(-101014, ss);
+    return;
+  }
+
+  // The vertices of a VertexGeom are its elements, so their tags and sets go on the nodes
+  int err = writer.createNodes(numNodes);
+  std::string elementGroup;
+  std::string tagGroupPath = MoabH5mWriter::NodeGroupPath();
+  if(err >= 0 && !mesher.isVertexMesh())
+  {
+    elementGroup = writer.createElements(elements.type, elements.nodesPerElement, numElements);
+    err = elementGroup.empty() ? -1 : 0;
+    tagGroupPath = MoabH5mWriter::ElementGroupPath(elementGroup);
+  }
+  for(size_t i = 0; i < tags.size() && err >= 0; i++)
+  {
+    err = writer.createDenseTag(tags[i].name, tags[i].hdf5Type, tags[i].numComponents);
+    if(err >= 0)
+    {
+      err = writer.createDenseTagData(tagGroupPath, tags[i].name, numElements);
+    }
+  }
+
+  size_t blockSize = mesher.getEntitiesPerBlock(DefaultBlockBytes);
+  size_t nodeBlockSize = std::min(blockSize, numNodes);
+  size_t elementBlockSize = std::min(blockSize, numElements);
+  size_t bufferBytes = std::max(mesher.getNodeBufferSize(nodeBlockSize) * sizeof(double), mesher.getConnectivityBufferSize(elementBlockSize) * sizeof(int64_t));
+
+  double totalBytes = static_cast<double>(mesher.getNodeBufferSize(numNodes) * sizeof(double) + mesher.getConnectivityBufferSize(numElements) * sizeof(int64_t));
+  for(const ExportTag& tag : tags)
+  {
+    totalBytes += static_cast<double>(numElements * tag.tupleBytes);
+  }
+  ExportProgress progress(m_Filter, totalBytes);
+
+  // The coordinates are widened and the connectivity shifted to file ids block by block while
+  // the previous blocks are written. The tag values need no conversion and are written from
+  // the arrays in blocks of the same number of elements.
+  bool queued = (err >= 0);
+  if(err >= 0)
+  {
+    BackgroundWriter pipeline(WriteQueueDepth, bufferBytes);
+    for(size_t offset = 0; offset < numNodes && queued; offset += blockSize)
+    {
+      size_t count = std::min(blockSize, numNodes - offset);
+      double* xyz = static_cast<double*>(pipeline.getBuffer());
+      mesher.generateNodes(offset, offset + count, xyz);
+      queued = pipeline.submit([&writer, offset, count, xyz] { return writer.writeNodes(offset, count, xyz); });
+      queued = queued && progress.advance(QObject::tr("Writing nodes"), static_cast<double>(count * 3 * sizeof(double)));
+    }
+
+    int64_t firstNodeId = writer.getNodeStartId();
+    for(size_t offset = 0; offset < numElements && queued && !mesher.isVertexMesh(); offset += blockSize)
+    {
+      size_t count = std::min(blockSize, numElements - offset);
+      int64_t* connectivity = static_cast<int64_t*>(pipeline.getBuffer());
+      mesher.generateConnectivity(offset, offset + count, firstNodeId, connectivity);
+      queued = pipeline.submit([&writer, &elementGroup, offset, count, connectivity] { return writer.writeConnectivity(elementGroup, offset, count, connectivity); });
+      queued = queued && progress.advance(QObject::tr("Writing connectivity"), static_cast<double>(mesher.getConnectivityBufferSize(count) * sizeof(int64_t)));
+    }
+
+    for(size_t i = 0; i < tags.size() && queued; i++)
+    {
+      const ExportTag& tag = tags[i];
+      const uint8_t* values = static_cast<const uint8_t*>(tag.array->getVoidPointer(0));
+      QString stage = QObject::tr("Writing %1").arg(m_Settings.selectedArrayPaths[static_cast<int>(i)].getDataArrayName());
+      for(size_t offset = 0; offset < numElements && queued; offset += blockSize)
+      {
+        size_t count = std::min(blockSize, numElements - offset);
+        const void* block = values + offset * tag.tupleBytes;
+        queued = pipeline.submit([&writer, &tag, &tagGroupPath, offset, count, block] { return writer.writeDenseTagData(tagGroupPath, tag.name, offset, count, block); });
+        queued = queued && progress.advance(stage, static_cast<double>(count * tag.tupleBytes));
+      }
+    }
+
+    err = pipeline.finish();
+  }
+
+  // A cancelled export only closes its file, which execute() then removes
+  m_StoppedEarly = !queued && getCancel();
+  if(err >= 0 && queued && (m_Settings.writeFeatureSets || m_Settings.writePartitionSets))
+  {
+    int64_t firstElementId = mesher.isVertexMesh() ? writer.getNodeStartId() : writer.getElementStartId(elementGroup);
+    err = writeElementSets(writer, getSetGroups(featureSorter, partSorter), firstElementId);
+  }
+
+  if(writer.closeFile() < 0 || err < 0)
+  {
+    QString ss = QObject::tr("Unable to write MOAB mesh to the specified file.");
+    setErrorCondition(-101004, ss);
+    return;
+  }
+}
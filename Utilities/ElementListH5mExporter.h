@@ -0,0 +1,58 @@
+/* ============================================================================
+* Copyright (c) 2018 BlueQuartz Software, LLC
+*
+* Redistribution and use in source and binary forms, with or without modification,
+* are permitted provided that the following conditions are met:
+*
+* Redistributions of source code must retain the above copyright notice, this
+* list of conditions and the following disclaimer.
+*
+* Redistributions in binary form must reproduce the above copyright notice, this
+* list of conditions and the following disclaimer in the documentation and/or
+* other materials provided with the distribution.
+*
+* Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+* contributors may be used to endorse or promote products derived from this software
+* without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+* DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+* FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+* DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+* OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+* USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*
+* ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#pragma once
+
+#include "MeshExporter.h"
+
+/**
+ * @brief The ElementListH5mExporter class writes a vertex, edge, triangle, quadrilateral,
+ * tetrahedral or hexahedral geometry in the MOAB HDF5 layout through MoabH5mWriter, without
+ * going through VTK, SMTK or MOAB. The nodes and connectivity are copied from the shared vertex
+ * and element lists in blocks, and the tag values are written straight from the selected arrays.
+ */
+class ElementListH5mExporter : public MeshExporter
+{
+public:
+  ElementListH5mExporter(AbstractFilter* filter, const MeshExportSettings& settings);
+  ~ElementListH5mExporter() override;
+
+  /**
+   * @brief Writes the geometry with its own elements and the Feature and partition sets
+   * @param geom Geometry that holds the selected arrays
+   */
+  void write(const IGeometry::Pointer& geom);
+
+public:
+  ElementListH5mExporter(const ElementListH5mExporter&) = delete;            // Copy Constructor Not Implemented
+  ElementListH5mExporter(ElementListH5mExporter&&) = delete;                 // Move Constructor Not Implemented
+  ElementListH5mExporter& operator=(const ElementListH5mExporter&) = delete; // Copy Assignment Not Implemented
+  ElementListH5mExporter& operator=(ElementListH5mExporter&&) = delete;      // Move Assignment Not Implemented
+};
@@ -0,0 +1,286 @@
+/* ============================================================================
+* Copyright (c) 2018 BlueQuartz Software, LLC
+*
+* Redistribution and use in source and binary forms, with or without modification,
+* are permitted provided that the following conditions are met:
+*
+* Redistributions of source code must retain the above copyright notice, this
+* list of conditions and the following disclaimer.
+*
+* Redistributions in binary form must reproduce the above copyright notice, this
+* list of conditions and the following disclaimer in the documentation and/or
+* other materials provided with the distribution.
+*
+* Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+* contributors may be used to endorse or promote products derived from this software
+* without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+* DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+* FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+* DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+* OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+* USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*
+* ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#include "ElementListMesher.h"
+
+#include <algorithm>
+
+#include "SIMPLib/SIMPLib.h"
+
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_for.h>
+#include <tbb/partitioner.h>
+#endif
+
+namespace
+{
+/**
+ * @brief Widens a range of the float vertex list to interleaved double coordinates
+ */
+class GenerateNodesImpl
+{
+public:
+  GenerateNodesImpl(const float* vertices, size_t begin, double* xyz)
+  : m_Vertices(vertices)
+  , m_Begin(begin)
+  , m_Xyz(xyz)
+  {
+  }
+
+  void convert(size_t start, size_t end) const
+  {
+    const float* source = m_Vertices + 3 * m_Begin;
+    for(size_t i = 3 * start; i < 3 * end; i++)
+    {
+      m_Xyz[i] = static_cast<double>(source[i]);
+    }
+  }
+
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+  void operator()(const tbb::blocked_range<size_t>& r) const
+  {
+    convert(r.begin(), r.end());
+  }
+#endif
+
+private:
+  const float* m_Vertices;
+  size_t m_Begin;
+  double* m_Xyz;
+};
+
+/**
+ * @brief Copies a range of the element list, shifting every vertex index by the id of the first node
+ */
+class GenerateConnectivityImpl
+{
+public:
+  GenerateConnectivityImpl(const int64_t* elements, size_t nodesPerElement, size_t begin, int64_t firstNodeId, int64_t* connectivity)
+  : m_Elements(elements)
+  , m_NodesPerElement(nodesPerElement)
+  , m_Begin(begin)
+  , m_FirstNodeId(firstNodeId)
+  , m_Connectivity(connectivity)
+  {
+  }
+
+  void convert(size_t start, size_t end) const
+  {
+    const int64_t* source = m_Elements + m_Begin * m_NodesPerElement;
+    for(size_t i = start * m_NodesPerElement; i < end * m_NodesPerElement; i++)
+    {
+      m_Connectivity[i] = source[i] + m_FirstNodeId;
+    }
+  }
+
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+  void operator()(const tbb::blocked_range<size_t>& r) const
+  {
+    convert(r.begin(), r.end());
+  }
+#endif
+
+private:
+  const int64_t* m_Elements;
+  size_t m_NodesPerElement;
+  size_t m_Begin;
+  int64_t m_FirstNodeId;
+  int64_t* m_Connectivity;
+};
+
+/**
+ * @brief Averages the vertices of a range of elements
+ */
+class GenerateCentersImpl
+{
+public:
+  GenerateCentersImpl(const float* vertices, const int64_t* elements, size_t nodesPerElement, float* centers)
+  : m_Vertices(vertices)
+  , m_Elements(elements)
+  , m_NodesPerElement(nodesPerElement)
+  , m_Centers(centers)
+  {
+  }
+
+  void convert(size_t start, size_t end) const
+  {
+    const float scale = 1.0f / static_cast<float>(m_NodesPerElement);
+    for(size_t e = start; e < end; e++)
+    {
+      float center[3] = {0.0f, 0.0f, 0.0f};
+      const int64_t* element = m_Elements + e * m_NodesPerElement;
+      for(size_t n = 0; n < m_NodesPerElement; n++)
+      {
+        const float* vertex = m_Vertices + 3 * element[n];
+        center[0] += vertex[0];
+        center[1] += vertex[1];
+        center[2] += vertex[2];
+      }
+      m_Centers[3 * e] = center[0] * scale;
+      m_Centers[3 * e + 1] = center[1] * scale;
+      m_Centers[3 * e + 2] = center[2] * scale;
+    }
+  }
+
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+  void operator()(const tbb::blocked_range<size_t>& r) const
+  {
+    convert(r.begin(), r.end());
+  }
+#endif
+
+private:
+  const float* m_Vertices;
+  const int64_t* m_Elements;
+  size_t m_NodesPerElement;
+  float* m_Centers;
+};
+} // namespace
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+ElementListMesher::ElementListMesher(const float* vertices, size_t numNodes, const int64_t* elements, size_t numElements, int nodesPerElement)
+: m_Vertices(vertices)
+, m_NumNodes(numNodes)
+, m_Elements(elements)
+, m_NumElements(elements != nullptr ? numElements : numNodes)
+, m_NodesPerElement(elements != nullptr ? nodesPerElement : 1)
+{
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+ElementListMesher::~ElementListMesher() = default;
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+size_t ElementListMesher::getNumberOfNodes() const
+{
+  return m_NumNodes;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+size_t ElementListMesher::getNumberOfElements() const
+{
+  return m_NumElements;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int ElementListMesher::getNodesPerElement() const
+{
+  return m_NodesPerElement;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool ElementListMesher::isVertexMesh() const
+{
+  return nullptr == m_Elements;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+size_t ElementListMesher::getEntitiesPerBlock(size_t budgetBytes) const
+{
+  size_t bytesPerEntity = std::max(getNodeBufferSize(1) * sizeof(double), getConnectivityBufferSize(1) * sizeof(int64_t));
+  return std::max<size_t>(budgetBytes / bytesPerEntity, 1);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+size_t ElementListMesher::getNodeBufferSize(size_t count) const
+{
+  return count * 3;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+size_t ElementListMesher::getConnectivityBufferSize(size_t count) const
+{
+  return isVertexMesh() ? 0 : count * static_cast<size_t>(m_NodesPerElement);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void ElementListMesher::generateNodes(size_t begin, size_t end, double* xyz) const
+{
+  GenerateNodesImpl impl(m_Vertices, begin, xyz);
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+  tbb::parallel_for(tbb::blocked_range<size_t>(0, end - begin), impl, tbb::auto_partitioner());
+#else
+  impl.convert(0, end - begin);
+#endif
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void ElementListMesher::generateConnectivity(size_t begin, size_t end, int64_t firstNodeId, int64_t* connectivity) const
+{
+  GenerateConnectivityImpl impl(m_Elements, static_cast<size_t>(m_NodesPerElement), begin, firstNodeId, connectivity);
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+  tbb::parallel_for(tbb::blocked_range<size_t>(0, end - begin), impl, tbb::auto_partitioner());
+#else
+  impl.convert(0, end - begin);
+#endif
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void ElementListMesher::generateCenters(std::vector<float>& centers) const
+{
+  if(isVertexMesh())
+  {
+    centers.assign(m_Vertices, m_Vertices + 3 * m_NumNodes);
+    return;
+  }
+
+  centers.resize(3 * m_NumElements);
+  GenerateCentersImpl impl(m_Vertices, m_Elements, static_cast<size_t>(m_NodesPerElement), centers.data());
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+  tbb::parallel_for(tbb::blocked_range<size_t>(0, m_NumElements), impl, tbb::auto_partitioner());
+#else
+  impl.convert(0, m_NumElements);
+#endif
+}
@@ -0,0 +1,146 @@
+/* ============================================================================
+* Copyright (c) 2018 BlueQuartz Software, LLC
+*
+* Redistribution and use in source and binary forms, with or without modification,
+* are permitted provided that the following conditions are met:
+*
+* Redistributions of source code must retain the above copyright notice, this
+* list of conditions and the following disclaimer.
+*
+* Redistributions in binary form must reproduce the above copyright notice, this
+* list of conditions and the following disclaimer in the documentation and/or
+* other materials provided with the distribution.
+*
+* Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+* contributors may be used to endorse or promote products derived from this software
+* without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+* DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+* FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+* DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+* OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+* USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*
+* ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+/**
+ * @brief The ElementListMesher class hands the mesh of a SIMPL geometry with an explicit element
+ * list (vertices, edges, triangles, quadrilaterals or tetrahedra) to the native writers in
+ * blocks. The shared vertex list and the shared element list are read in bulk: a block of
+ * coordinates is the float vertex list widened to doubles and a block of connectivity is the
+ * int64 element list shifted by the id of the first node, so no element is visited through the
+ * geometry's per-element accessors.
+ *
+ * Nodes and elements keep the numbering of the SIMPL geometry, so a block of elements lines up
+ * with a contiguous range of the element arrays. Each block is converted in parallel when SIMPL
+ * is built with TBB.
+ */
+class ElementListMesher
+{
+public:
+  /**
+   * @brief Constructor
+   * @param vertices Interleaved XYZ coordinates of the shared vertex list
+   * @param numNodes Number of vertices
+   * @param elements Vertex indices of each element, or null when the vertices are the elements
+   * @param numElements Number of elements; ignored when elements is null
+   * @param nodesPerElement Number of vertices of each element; ignored when elements is null
+   */
+  ElementListMesher(const float* vertices, size_t numNodes, const int64_t* elements, size_t numElements, int nodesPerElement);
+  virtual ~ElementListMesher();
+
+  /**
+   * @brief Returns the total number of nodes
+   * @return
+   */
+  size_t getNumberOfNodes() const;
+
+  /**
+   * @brief Returns the total number of elements, which is the number of nodes when the vertices
+   * are the elements
+   * @return
+   */
+  size_t getNumberOfElements() const;
+
+  /**
+   * @brief Returns the number of nodes of each element
+   * @return
+   */
+  int getNodesPerElement() const;
+
+  /**
+   * @brief Returns whether the vertices are the elements, in which case there is no connectivity
+   * @return
+   */
+  bool isVertexMesh() const;
+
+  /**
+   * @brief Returns how many nodes or elements a block may hold so that a node buffer and a
+   * connectivity buffer sized with getNodeBufferSize() and getConnectivityBufferSize() each fit
+   * inside the budget
+   * @param budgetBytes
+   * @return At least 1
+   */
+  size_t getEntitiesPerBlock(size_t budgetBytes) const;
+
+  /**
+   * @brief Returns the number of doubles needed to hold the coordinates of a block of nodes
+   * @param count
+   * @return
+   */
+  size_t getNodeBufferSize(size_t count) const;
+
+  /**
+   * @brief Returns the number of ids needed to hold the connectivity of a block of elements
+   * @param count
+   * @return
+   */
+  size_t getConnectivityBufferSize(size_t count) const;
+
+  /**
+   * @brief Writes interleaved XYZ coordinates of nodes [begin, end)
+   * @param begin
+   * @param end
+   * @param xyz
+   */
+  void generateNodes(size_t begin, size_t end, double* xyz) const;
+
+  /**
+   * @brief Writes the connectivity of elements [begin, end)
+   * @param begin
+   * @param end
+   * @param firstNodeId Id assigned to node 0, e.g. 1 for MOAB file ids or 0 for VTK point ids
+   * @param connectivity getNodesPerElement() ids per element
+   */
+  void generateConnectivity(size_t begin, size_t end, int64_t firstNodeId, int64_t* connectivity) const;
+
+  /**
+   * @brief Computes the center of every element as the mean of its vertices
+   * @param centers Receives the interleaved XYZ center of each element
+   */
+  void generateCenters(std::vector<float>& centers) const;
+
+private:
+  const float* m_Vertices = nullptr;
+  size_t m_NumNodes = 0;
+  const int64_t* m_Elements = nullptr;
+  size_t m_NumElements = 0;
+  int m_NodesPerElement = 1;
+
+public:
+  ElementListMesher(const ElementListMesher&) = delete;            // Copy Constructor Not Implemented
+  ElementListMesher(ElementListMesher&&) = delete;                 // Move Constructor Not Implemented
+  ElementListMesher& operator=(const ElementListMesher&) = delete; // Copy Assignment Not Implemented
+  ElementListMesher& operator=(ElementListMesher&&) = delete;      // Move Assignment Not Implemented
+};
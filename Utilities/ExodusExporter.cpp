@@ -0,0 +1,330 @@
+/* ============================================================================
+* Copyright (c) 2018 BlueQuartz Software, LLC
+*
+* Redistribution and use in source and binary forms, with or without modification,
+* are permitted provided that the following conditions are met:
+*
+* Redistributions of source code must retain the above copyright notice, this
+* list of conditions and the following disclaimer.
+*
+* Redistributions in binary form must reproduce the above copyright notice, this
+* list of conditions and the following disclaimer in the documentation and/or
+* other materials provided with the distribution.
+*
+* Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+* contributors may be used to endorse or promote products derived from this software
+* without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+* DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+* FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+* DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+* OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+* USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*
+* ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#include "ExodusExporter.h"
+
+#include <algorithm>
+#include <string>
+
+#include "BackgroundWriter.h"
+#include "ExodusStreamWriter.h"
+#include "ImageSlabMesher.h"
+#include "LabelCountingSort.h"
+#include "MeshReorderer.h"
+
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_for.h>
+#endif
+
+namespace
+{
+/**
+ * @brief Describes one element variable of an Exodus export, which holds one component of a
+ * selected array as doubles
+ */
+struct ExodusVariable
+{
+  std::string name;                          //!< Name of the variable in the file
+  IDataArray::Pointer array;                 //!< Array that holds the values of every cell
+  size_t tupleBytes = 0;                     //!< Size of one tuple of the array in bytes
+  size_t componentOffset = 0;                //!< Offset of the component inside a tuple in bytes
+  double (*toDouble)(const void*) = nullptr; //!< Reads one component of the array type
+};
+
+/**
+ * @brief Converts the values of one Exodus variable on a run of elements to doubles. The
+ * elements are the region cells in order or, when an element order is given, the cells it
+ * lists.
+ */
+class GatherExodusValuesImpl
+{
+public:
+  GatherExodusValuesImpl(const ImageRegion& region, const size_t* dims, const ExodusVariable& variable, const size_t* order, size_t first, double* values)
+  : m_Region(region)
+  , m_Dims(dims)
+  , m_Variable(variable)
+  , m_Order(order)
+  , m_First(first)
+  , m_Values(values)
+  {
+  }
+
+  void convert(size_t start, size_t end) const
+  {
+    const void* source = m_Variable.array->getVoidPointer(0);
+    size_t cellsPerLayer = m_Dims[0] * m_Dims[1];
+    for(size_t i = start; i < end; i++)
+    {
+      size_t cell = (nullptr != m_Order) ? m_Order[m_First + i] : m_First + i;
+      size_t z = cell / cellsPerLayer;
+      size_t y = (cell - z * cellsPerLayer) / m_Dims[0];
+      size_t x = cell - z * cellsPerLayer - y * m_Dims[0];
+      const uint8_t* tuple = static_cast<const uint8_t*>(m_Region.getCellPointer(source, m_Variable.tupleBytes, x, y, z));
+      m_Values[i] = m_Variable.toDouble(tuple + m_Variable.componentOffset);
+    }
+  }
+
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+  void operator()(const tbb::blocked_range<size_t>& r) const
+  {
+    convert(r.begin(), r.end());
+  }
+#endif
+
+private:
+  const ImageRegion& m_Region;
+  const size_t* m_Dims;
+  const ExodusVariable& m_Variable;
+  const size_t* m_Order;
+  size_t m_First;
+  double* m_Values;
+};
+} // namespace
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+ExodusExporter::ExodusExporter(AbstractFilter* filter, const MeshExportSettings& settings)
+: MeshExporter(filter, settings)
+{
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+ExodusExporter::~ExodusExporter() = default;
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void ExodusExporter::write(const ImageGeom::Pointer& image, bool streaming)
+{
+  size_t dims[3] = {0, 0, 0};
+  float res[3] = {0.0f, 0.0f, 0.0f};
+  float origin[3] = {0.0f, 0.0f, 0.0f};
+
+  ImageRegion region = getRegion(image, dims, res, origin);
+
+  ImageSlabMesher mesher(dims, res, origin);
+  size_t slabLayers = getSlabLayers(mesher, streaming, 1);
+  if(slabLayers == 0)
+  {
+    return;
+  }
+
+  MeshReorderer reorderer(static_cast<MeshReorderer::Ordering>(m_Settings.meshOrdering));
+  orderMesh(reorderer, dims);
+  bool reordered = !reorderer.isNatural();
+
+  // Exodus numbers the elements block after block. With Feature meshsets every Feature gets a
+  // block of its own and the elements are written in the order of the sorted Feature Ids,
+  // which keeps the order of a renumbered mesh inside each block.
+  size_t numElements = mesher.getNumberOfElements();
+  LabelCountingSort featureSorter;
+  std::vector<ExodusStreamWriter::ElementBlockInfo> blocks;
+  std::vector<size_t> blockStarts;
+  std::vector<size_t> blockCells;
+  const size_t* order = reordered ? reorderer.getElementOrder().data() : nullptr;
+  if(m_Settings.writeFeatureSets)
+  {
+    std::vector<int32_t> featureIdsBuffer;
+    std::vector<int32_t> permutedFeatureIds;
+    const int32_t* featureIds = gatherFeatureIds(region, featureIdsBuffer);
+    if(reordered)
+    {
+      PermuteValues(featureIds, reorderer.getElementOrder(), permutedFeatureIds);
+      featureIds = permutedFeatureIds.data();
+    }
+    if(!sortFeatureIds(featureSorter, featureIds, region.getNumberOfCells()))
+    {
+      return;
+    }
+
+    // Block ids must be positive, so each block id is the Feature Id plus one
+    const std::vector<int32_t>& featureIdList = featureSorter.getLabels();
+    const std::vector<size_t>& offsets = featureSorter.getOffsets();
+    for(size_t f = 0; f < featureIdList.size(); f++)
+    {
+      ExodusStreamWriter::ElementBlockInfo block;
+      block.id = static_cast<int64_t>(featureIdList[f]) + 1;
+      block.name = "Feature_" + std::to_string(featureIdList[f]);
+      block.numElements = offsets[f + 1] - offsets[f];
+      blocks.push_back(block);
+      blockStarts.push_back(offsets[f]);
+    }
+
+    // The sorter lists renumbered elements, and the blocks are generated from their cells
+    order = featureSorter.getOrder().data();
+    if(reordered)
+    {
+      PermuteValues(reorderer.getElementOrder().data(), featureSorter.getOrder(), blockCells);
+      order = blockCells.data();
+    }
+  }
+  else
+  {
+    ExodusStreamWriter::ElementBlockInfo block;
+    block.name = "Cells";
+    block.numElements = numElements;
+    blocks.push_back(block);
+    blockStarts.push_back(0);
+  }
+
+  // Exodus variables are scalars, so an array with several components becomes one variable
+  // per component with the component index after its name
+  std::vector<ExodusVariable> variables;
+  std::vector<std::string> variableNames;
+  for(int i = 0; i < m_Settings.selectedArrayPaths.size(); i++)
+  {
+    IDataArray::Pointer selectedArray = m_Settings.selectedWeakPtrVector[i].lock();
+    ExportTypeInfo typeInfo;
+    GetExportTypeInfo(selectedArray->getTypeAsString(), typeInfo);
+    int numComps = selectedArray->getNumberOfComponents();
+    for(int c = 0; c < numComps; c++)
+    {
+      ExodusVariable variable;
+      variable.name = m_Settings.selectedArrayPaths[i].getDataArrayName().toStdString();
+      if(numComps > 1)
+      {
+        variable.name += "_" + std::to_string(c);
+      }
+      variable.array = selectedArray;
+      variable.tupleBytes = typeInfo.size * static_cast<size_t>(numComps);
+      variable.componentOffset = typeInfo.size * static_cast<size_t>(c);
+      variable.toDouble = typeInfo.toDouble;
+      variables.push_back(variable);
+      variableNames.push_back(variable.name);
+    }
+  }
+
+  ExodusStreamWriter writer;
+  if(writer.openFile(m_Settings.outputFile.toStdString(), mesher.getNumberOfNodes(), "HEX8", 8, blocks, variableNames) < 0)
+  {
+    QString ss = QObject::tr("Unable to create the output file '%1'.").arg(m_Settings.outputFile);
+    setErrorCondition(-101014, ss);
+    return;
+  }
+
+  size_t elementsPerLayer = mesher.getElementsPerLayer();
+  size_t elementsPerBlock = slabLayers * elementsPerLayer;
+  size_t bufferBytes = std::max(mesher.getNodeBufferSize(slabLayers) * sizeof(double), mesher.getConnectivityBufferSize(slabLayers) * sizeof(int64_t));
+  ExportProgress progress(m_Filter, (3.0 * sizeof(double)) * mesher.getNumberOfNodes() + (8.0 * sizeof(int64_t) + variables.size() * sizeof(double)) * numElements);
+
+  // Each block is generated by the worker threads while the writer thread writes the previous
+  // ones. Exodus takes the X, Y and Z coordinates as separate arrays, so each slab of nodes is
+  // generated interleaved and then split into the block buffer.
+  BackgroundWriter pipeline(WriteQueueDepth, bufferBytes);
+  bool queued = true;
+  size_t nodesPerLayer = mesher.getNodesPerLayer();
+  size_t numNodeLayers = mesher.getNumberOfNodeLayers();
+  std::vector<double> xyz(mesher.getNodeBufferSize(slabLayers));
+  for(size_t z = 0; z < numNodeLayers && queued; z += slabLayers)
+  {
+    size_t zEnd = std::min(z + slabLayers, numNodeLayers);
+    size_t offset = z * nodesPerLayer;
+    size_t count = (zEnd - z) * nodesPerLayer;
+    if(reordered)
+    {
+      mesher.generateNodeList(reorderer.getNodeOrder().data() + offset, count, xyz.data());
+    }
+    else
+    {
+      mesher.generateNodes(z, zEnd, xyz.data());
+    }
+    double* coords = static_cast<double*>(pipeline.getBuffer());
+    for(size_t n = 0; n < count; n++)
+    {
+      coords[n] = xyz[3 * n];
+      coords[count + n] = xyz[3 * n + 1];
+      coords[2 * count + n] = xyz[3 * n + 2];
+    }
+    queued = pipeline.submit([&writer, offset, count, coords] { return writer.writeNodes(offset, count, coords, coords + count, coords + 2 * count); });
+    queued = queued && progress.advance(QObject::tr("Writing nodes"), static_cast<double>(count * 3 * sizeof(double)));
+  }
+
+  // Without Feature blocks or renumbering the single block holds the cells in order, and each
+  // piece of it is a slab of element layers
+  for(size_t b = 0; b < blocks.size() && queued; b++)
+  {
+    for(size_t offset = 0; offset < blocks[b].numElements && queued; offset += elementsPerBlock)
+    {
+      size_t count = std::min(elementsPerBlock, blocks[b].numElements - offset);
+      int64_t* connectivity = static_cast<int64_t*>(pipeline.getBuffer());
+      if(nullptr == order)
+      {
+        mesher.generateConnectivity(offset / elementsPerLayer, (offset + count) / elementsPerLayer, 1, connectivity);
+      }
+      else
+      {
+        mesher.generateElementConnectivity(order + blockStarts[b] + offset, count, 1, connectivity, reordered ? reorderer.getNodeIds().data() : nullptr);
+      }
+      queued = pipeline.submit([&writer, b, offset, count, connectivity] { return writer.writeConnectivity(b, offset, count, connectivity); });
+      queued = queued && progress.advance(QObject::tr("Writing connectivity"), static_cast<double>(count * 8 * sizeof(int64_t)));
+    }
+  }
+
+  for(size_t v = 0; v < variables.size() && queued; v++)
+  {
+    QString stage = QObject::tr("Writing %1").arg(QString::fromStdString(variables[v].name));
+    for(size_t b = 0; b < blocks.size() && queued; b++)
+    {
+      for(size_t offset = 0; offset < blocks[b].numElements && queued; offset += elementsPerBlock)
+      {
+        size_t count = std::min(elementsPerBlock, blocks[b].numElements - offset);
+        double* values = static_cast<double*>(pipeline.getBuffer());
+        GatherExodusValuesImpl impl(region, dims, variables[v], order, blockStarts[b] + offset, values);
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+        tbb::parallel_for(tbb::blocked_range<size_t>(0, count), impl);
+#else
+        impl.convert(0, count);
+#endif
+        queued = pipeline.submit([&writer, v, b, offset, count, values] { return writer.writeVariable(v, b, offset, count, values); });
+        queued = queued && progress.advance(stage, static_cast<double>(count * sizeof(double)));
+      }
+    }
+  }
+
+  int err = pipeline.finish();
+
+  // A cancelled file lacks its last blocks, which execute() then removes
+  bool closed = (writer.closeFile() >= 0);
+  m_StoppedEarly = !queued && getCancel();
+  if(m_StoppedEarly)
+  {
+    return;
+  }
+  if(!closed || err < 0)
+  {
+    QString ss = QObject::tr("Unable to write the Exodus mesh to the specified file.");
+    setErrorCondition(-101004, ss);
+    return;
+  }
+}
@@ -0,0 +1,59 @@
+/* ============================================================================
+* Copyright (c) 2018 BlueQuartz Software, LLC
+*
+* Redistribution and use in source and binary forms, with or without modification,
+* are permitted provided that the following conditions are met:
+*
+* Redistributions of source code must retain the above copyright notice, this
+* list of conditions and the following disclaimer.
+*
+* Redistributions in binary form must reproduce the above copyright notice, this
+* list of conditions and the following disclaimer in the documentation and/or
+* other materials provided with the distribution.
+*
+* Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+* contributors may be used to endorse or promote products derived from this software
+* without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+* DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+* FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+* DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+* OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+* USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*
+* ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#pragma once
+
+#include "MeshExporter.h"
+
+/**
+ * @brief The ExodusExporter class writes an ImageGeom as Exodus II HEX8 element blocks through
+ * ExodusStreamWriter, one block for the whole region or one per Feature, with one element
+ * variable per array component. The nodes, connectivity and variables are written in blocks
+ * through the writer thread.
+ */
+class ExodusExporter : public MeshExporter
+{
+public:
+  ExodusExporter(AbstractFilter* filter, const MeshExportSettings& settings);
+  ~ExodusExporter() override;
+
+  /**
+   * @brief Writes the ImageGeom as Exodus II element blocks
+   * @param image ImageGeom that holds the selected array
+   * @param streaming Size the blocks to fit the memory budget instead of the default size
+   */
+  void write(const ImageGeom::Pointer& image, bool streaming);
+
+public:
+  ExodusExporter(const ExodusExporter&) = delete;            // Copy Constructor Not Implemented
+  ExodusExporter(ExodusExporter&&) = delete;                 // Move Constructor Not Implemented
+  ExodusExporter& operator=(const ExodusExporter&) = delete; // Copy Assignment Not Implemented
+  ExodusExporter& operator=(ExodusExporter&&) = delete;      // Move Assignment Not Implemented
+};
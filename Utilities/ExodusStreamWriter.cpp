@@ -0,0 +1,258 @@
+/* ============================================================================
+* Copyright (c) 2018 BlueQuartz Software, LLC
+*
+* Redistribution and use in source and binary forms, with or without modification,
+* are permitted provided that the following conditions are met:
+*
+* Redistributions of source code must retain the above copyright notice, this
+* list of conditions and the following disclaimer.
+*
+* Redistributions in binary form must reproduce the above copyright notice, this
+* list of conditions and the following disclaimer in the documentation and/or
+* other materials provided with the distribution.
+*
+* Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+* contributors may be used to endorse or promote products derived from this software
+* without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+* DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+* FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+* DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+* OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+* USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*
+* ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#include "ExodusStreamWriter.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <limits>
+
+#include "vtk_exodusII.h"
+
+namespace
+{
+// Longest block and variable names kept in the file; the exodusII default is 32
+const int k_MaxNameLength = 80;
+
+// Largest netCDF variable of the 64 bit offset format, such as one coordinate array, the
+// connectivity of one block or one time step of a variable on one block
+const size_t k_MaxOffsetVariableBytes = (static_cast<size_t>(1) << 32) - 4;
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+std::vector<char*> GetNamePointers(std::vector<std::string>& names)
+{
+  std::vector<char*> pointers;
+  for(std::string& name : names)
+  {
+    pointers.push_back(&name[0]);
+  }
+  return pointers;
+}
+} // namespace
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+ExodusStreamWriter::ExodusStreamWriter() = default;
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+ExodusStreamWriter::~ExodusStreamWriter()
+{
+  closeFile();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int ExodusStreamWriter::openFile(const std::string& filePath, size_t numNodes, const std::string& elementType, int nodesPerElement, const std::vector<ElementBlockInfo>& blocks,
+                                 const std::vector<std::string>& variableNames)
+{
+  closeFile();
+
+  // The coordinates are stored as one variable per axis, and each block gets a connectivity
+  // variable and one variable per element variable
+  size_t numElements = 0;
+  size_t maxVariableBytes = numNodes * sizeof(double);
+  for(const ElementBlockInfo& block : blocks)
+  {
+    numElements += block.numElements;
+    maxVariableBytes = std::max(maxVariableBytes, block.numElements * static_cast<size_t>(nodesPerElement) * sizeof(int32_t));
+    if(!variableNames.empty())
+    {
+      maxVariableBytes = std::max(maxVariableBytes, block.numElements * sizeof(double));
+    }
+  }
+
+  // The classic 64 bit offset format stores ids as 32 bit integers and limits each variable
+  // to 4 GiB, which the connectivity of a HEX8 block passes at about 134 million elements.
+  // Larger models are written as netCDF-4, with 64 bit integers once the ids need them. The
+  // API takes 64 bit connectivity either way.
+  const size_t k_MaxInt32 = static_cast<size_t>(std::numeric_limits<int32_t>::max());
+  int mode = EX_CLOBBER | EX_BULK_INT64_API;
+  if(numNodes > k_MaxInt32 || numElements > k_MaxInt32)
+  {
+    mode |= EX_NETCDF4 | EX_ALL_INT64_DB;
+  }
+  else if(maxVariableBytes > k_MaxOffsetVariableBytes)
+  {
+    mode |= EX_NETCDF4;
+  }
+  else
+  {
+    mode |= EX_LARGE_MODEL;
+  }
+  int computeWordSize = sizeof(double);
+  int ioWordSize = sizeof(double);
+  m_ExoId = ex_create(filePath.c_str(), mode, &computeWordSize, &ioWordSize);
+  if(m_ExoId < 0)
+  {
+    return -1;
+  }
+
+  m_NumNodes = numNodes;
+  m_NumVariables = variableNames.size();
+  m_Blocks = blocks;
+
+  ex_set_max_name_length(m_ExoId, k_MaxNameLength);
+  int err = ex_put_init(m_ExoId, "DREAM3D Export", 3, static_cast<int64_t>(numNodes), static_cast<int64_t>(numElements), static_cast<int64_t>(blocks.size()), 0, 0);
+
+  std::vector<std::string> coordNames = {"x", "y", "z"};
+  std::vector<char*> coordNamePtrs = GetNamePointers(coordNames);
+  if(err >= 0)
+  {
+    err = ex_put_coord_names(m_ExoId, coordNamePtrs.data());
+  }
+
+  // Every block is defined in one pass over the file header. One call per block would leave
+  // and reenter netCDF define mode, which rewrites the header, once per Feature.
+  std::vector<ex_block> blockParams(blocks.size());
+  std::vector<std::string> blockNames;
+  for(size_t i = 0; i < blocks.size(); i++)
+  {
+    blockParams[i].id = blocks[i].id;
+    blockParams[i].type = EX_ELEM_BLOCK;
+    std::snprintf(blockParams[i].topology, sizeof(blockParams[i].topology), "%s", elementType.c_str());
+    blockParams[i].num_entry = static_cast<int64_t>(blocks[i].numElements);
+    blockParams[i].num_nodes_per_entry = nodesPerElement;
+    blockParams[i].num_edges_per_entry = 0;
+    blockParams[i].num_faces_per_entry = 0;
+    blockParams[i].num_attribute = 0;
+    blockNames.push_back(blocks[i].name);
+  }
+  if(err >= 0 && !blocks.empty())
+  {
+    err = ex_put_block_params(m_ExoId, blocks.size(), blockParams.data());
+  }
+  std::vector<char*> blockNamePtrs = GetNamePointers(blockNames);
+  if(err >= 0 && !blocks.empty())
+  {
+    err = ex_put_names(m_ExoId, EX_ELEM_BLOCK, blockNamePtrs.data());
+  }
+
+  // The truth table defines every variable on every block in one pass over the file header
+  if(err >= 0 && !variableNames.empty())
+  {
+    int numVariables = static_cast<int>(variableNames.size());
+    std::vector<std::string> names = variableNames;
+    std::vector<char*> namePtrs = GetNamePointers(names);
+    std::vector<int> truthTable(blocks.size() * variableNames.size(), 1);
+    const double time = 0.0;
+    err = ex_put_variable_param(m_ExoId, EX_ELEM_BLOCK, numVariables);
+    if(err >= 0)
+    {
+      err = ex_put_variable_names(m_ExoId, EX_ELEM_BLOCK, numVariables, namePtrs.data());
+    }
+    if(err >= 0)
+    {
+      err = ex_put_truth_table(m_ExoId, EX_ELEM_BLOCK, static_cast<int>(blocks.size()), numVariables, truthTable.data());
+    }
+    if(err >= 0)
+    {
+      err = ex_put_time(m_ExoId, 1, &time);
+    }
+  }
+
+  if(err < 0)
+  {
+    closeFile();
+    return -2;
+  }
+  return 0;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int ExodusStreamWriter::writeNodes(size_t offset, size_t count, const double* x, const double* y, const double* z)
+{
+  if(m_ExoId < 0 || offset + count > m_NumNodes)
+  {
+    return -1;
+  }
+  if(count == 0)
+  {
+    return 0;
+  }
+  return (ex_put_partial_coord(m_ExoId, static_cast<int64_t>(offset + 1), static_cast<int64_t>(count), x, y, z) < 0) ? -2 : 0;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int ExodusStreamWriter::writeConnectivity(size_t block, size_t offset, size_t count, const int64_t* connectivity)
+{
+  if(m_ExoId < 0 || block >= m_Blocks.size() || offset + count > m_Blocks[block].numElements)
+  {
+    return -1;
+  }
+  if(count == 0)
+  {
+    return 0;
+  }
+  int err = ex_put_partial_conn(m_ExoId, EX_ELEM_BLOCK, m_Blocks[block].id, static_cast<int64_t>(offset + 1), static_cast<int64_t>(count), connectivity, nullptr, nullptr);
+  return (err < 0) ? -2 : 0;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int ExodusStreamWriter::writeVariable(size_t variable, size_t block, size_t offset, size_t count, const double* values)
+{
+  if(m_ExoId < 0 || variable >= m_NumVariables || block >= m_Blocks.size() || offset + count > m_Blocks[block].numElements)
+  {
+    return -1;
+  }
+  if(count == 0)
+  {
+    return 0;
+  }
+  int err = ex_put_partial_var(m_ExoId, 1, EX_ELEM_BLOCK, static_cast<int>(variable + 1), m_Blocks[block].id, static_cast<int64_t>(offset + 1), static_cast<int64_t>(count), values);
+  return (err < 0) ? -2 : 0;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int ExodusStreamWriter::closeFile()
+{
+  if(m_ExoId < 0)
+  {
+    return 0;
+  }
+
+  int err = ex_close(m_ExoId);
+  m_ExoId = -1;
+  m_Blocks.clear();
+  return (err < 0) ? -1 : 0;
+}
@@ -0,0 +1,130 @@
+/* ============================================================================
+* Copyright (c) 2018 BlueQuartz Software, LLC
+*
+* Redistribution and use in source and binary forms, with or without modification,
+* are permitted provided that the following conditions are met:
+*
+* Redistributions of source code must retain the above copyright notice, this
+* list of conditions and the following disclaimer.
+*
+* Redistributions in binary form must reproduce the above copyright notice, this
+* list of conditions and the following disclaimer in the documentation and/or
+* other materials provided with the distribution.
+*
+* Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+* contributors may be used to endorse or promote products derived from this software
+* without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+* DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+* FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+* DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+* OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+* USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*
+* ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+/**
+ * @brief The ExodusStreamWriter class writes an Exodus II file through the exodusII library
+ * that VTK's Exodus module is built on. The numbers of nodes and elements, the element blocks
+ * and the element variables are fixed when the file is opened, so the coordinates, the
+ * connectivity of each block and the values of each variable can then be written in pieces of
+ * any size and in any order, and a mesh never has to be held in memory in full.
+ *
+ * The elements of a block are numbered after those of the blocks before it. Every element
+ * variable is defined on every block and holds one double per element at a single time step.
+ * The calls are not thread safe; one thread at a time may use a writer.
+ */
+class ExodusStreamWriter
+{
+public:
+  /**
+   * @brief Describes one element block
+   */
+  struct ElementBlockInfo
+  {
+    int64_t id = 1;          //!< Block id, which Exodus requires to be positive
+    std::string name;        //!< Name shown for the block by readers
+    size_t numElements = 0;
+  };
+
+  ExodusStreamWriter();
+  virtual ~ExodusStreamWriter();
+
+  /**
+   * @brief Creates the file and defines its nodes, element blocks and element variables. Files
+   * with a coordinate, connectivity or variable array over 4 GiB are written as netCDF-4
+   * files, with 64 bit ids once they have more than 2^31 - 1 nodes or elements.
+   * @param filePath
+   * @param numNodes
+   * @param elementType Exodus element type shared by every block, such as "HEX8"
+   * @param nodesPerElement
+   * @param blocks
+   * @param variableNames One name per element variable
+   * @return Negative value on error
+   */
+  int openFile(const std::string& filePath, size_t numNodes, const std::string& elementType, int nodesPerElement, const std::vector<ElementBlockInfo>& blocks,
+               const std::vector<std::string>& variableNames);
+
+  /**
+   * @brief Writes the coordinates of the nodes [offset, offset + count)
+   * @param offset
+   * @param count
+   * @param x
+   * @param y
+   * @param z
+   * @return Negative value on error
+   */
+  int writeNodes(size_t offset, size_t count, const double* x, const double* y, const double* z);
+
+  /**
+   * @brief Writes the connectivity of the elements [offset, offset + count) of one block. Node
+   * ids start at 1.
+   * @param block Index of the block in the list given to openFile()
+   * @param offset
+   * @param count
+   * @param connectivity
+   * @return Negative value on error
+   */
+  int writeConnectivity(size_t block, size_t offset, size_t count, const int64_t* connectivity);
+
+  /**
+   * @brief Writes the values of one variable on the elements [offset, offset + count) of one block
+   * @param variable Index of the variable in the list given to openFile()
+   * @param block Index of the block in the list given to openFile()
+   * @param offset
+   * @param count
+   * @param values
+   * @return Negative value on error
+   */
+  int writeVariable(size_t variable, size_t block, size_t offset, size_t count, const double* values);
+
+  /**
+   * @brief Closes the file
+   * @return Negative value on error
+   */
+  int closeFile();
+
+private:
+  int m_ExoId = -1;
+  size_t m_NumNodes = 0;
+  size_t m_NumVariables = 0;
+  std::vector<ElementBlockInfo> m_Blocks;
+
+public:
+  ExodusStreamWriter(const ExodusStreamWriter&) = delete;            // Copy Constructor Not Implemented
+  ExodusStreamWriter(ExodusStreamWriter&&) = delete;                 // Move Constructor Not Implemented
+  ExodusStreamWriter& operator=(const ExodusStreamWriter&) = delete; // Copy Assignment Not Implemented
+  ExodusStreamWriter& operator=(ExodusStreamWriter&&) = delete;      // Move Assignment Not Implemented
+};
@@ -0,0 +1,210 @@
+/* ============================================================================
+* Copyright (c) 2018 BlueQuartz Software, LLC
+*
+* Redistribution and use in source and binary forms, with or without modification,
+* are permitted provided that the following conditions are met:
+*
+* Redistributions of source code must retain the above copyright notice, this
+* list of conditions and the following disclaimer.
+*
+* Redistributions in binary form must reproduce the above copyright notice, this
+* list of conditions and the following disclaimer in the documentation and/or
+* other materials provided with the distribution.
+*
+* Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+* contributors may be used to endorse or promote products derived from this software
+* without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+* DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+* FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+* DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+* OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+* USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*
+* ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#include "FeatureBoundaryExporter.h"
+
+#include <algorithm>
+
+#include <QtCore/QFileInfo>
+
+#include "FeatureBoundaryExtractor.h"
+#include "VtuStreamWriter.h"
+
+#include "vtkCellType.h"
+
+namespace
+{
+// Tags holding the Feature Id on the negative and positive side of each boundary face
+const char* const k_LeftFeatureIdTagName = "LeftFeatureId";
+const char* const k_RightFeatureIdTagName = "RightFeatureId";
+} // namespace
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+FeatureBoundaryExporter::FeatureBoundaryExporter(AbstractFilter* filter, const MeshExportSettings& settings)
+: MeshExporter(filter, settings)
+{
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+FeatureBoundaryExporter::~FeatureBoundaryExporter() = default;
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void FeatureBoundaryExporter::write(const ImageGeom::Pointer& image)
+{
+  size_t dims[3] = {0, 0, 0};
+  float res[3] = {0.0f, 0.0f, 0.0f};
+  float origin[3] = {0.0f, 0.0f, 0.0f};
+
+  ImageRegion region = getRegion(image, dims, res, origin);
+
+  // Faces on the sides of a region of interest are treated as the outside of the volume
+  std::vector<int32_t> buffer;
+  const int32_t* labels = gatherFeatureIds(region, buffer);
+
+  FeatureBoundaryExtractor extractor(dims, res, origin);
+  notifyStatusMessage(QObject::tr("Extracting the Feature boundaries of %1 cells").arg(region.getNumberOfCells()));
+  extractor.execute(labels);
+  if(getCancel())
+  {
+    return;
+  }
+
+  size_t numNodes = extractor.getNumberOfNodes();
+  size_t numQuads = extractor.getNumberOfQuads();
+  const std::vector<int64_t>& connectivity = extractor.getConnectivity();
+  const std::vector<int32_t>& leftLabels = extractor.getLeftLabels();
+  const std::vector<int32_t>& rightLabels = extractor.getRightLabels();
+  std::vector<double> xyz(numNodes * 3);
+  extractor.generateNodes(0, numNodes, xyz.data());
+
+  ExportProgress progress(m_Filter, 3.0 * sizeof(double) * numNodes + (4.0 * sizeof(int64_t) + 2.0 * sizeof(int32_t)) * numQuads);
+  int err = 0;
+  if(QFileInfo(m_Settings.outputFile).completeSuffix() == "vtu")
+  {
+    std::vector<VtuStreamWriter::DataArrayInfo> arrayInfos = {{k_LeftFeatureIdTagName, "Int32", 1, sizeof(int32_t)}, {k_RightFeatureIdTagName, "Int32", 1, sizeof(int32_t)}};
+    VtuStreamWriter writer;
+    if(writer.openFile(m_Settings.outputFile.toStdString(), numNodes, numQuads, VTK_QUAD, 4, arrayInfos) < 0)
+    {
+      QString ss = QObject::tr("Unable to create the output file '%1'.").arg(m_Settings.outputFile);
+      setErrorCondition(-101014, ss);
+      return;
+    }
+
+    std::vector<int64_t> offsets(numQuads);
+    for(size_t i = 0; i < numQuads; i++)
+    {
+      offsets[i] = static_cast<int64_t>(i + 1) * 4;
+    }
+    std::vector<uint8_t> types(numQuads, static_cast<uint8_t>(VTK_QUAD));
+
+    const std::vector<std::pair<const void*, size_t>> blocks = {{xyz.data(), xyz.size() * sizeof(double)},
+                                                                {leftLabels.data(), numQuads * sizeof(int32_t)},
+                                                                {rightLabels.data(), numQuads * sizeof(int32_t)},
+                                                                {connectivity.data(), connectivity.size() * sizeof(int64_t)},
+                                                                {offsets.data(), numQuads * sizeof(int64_t)},
+                                                                {types.data(), numQuads}};
+    bool running = true;
+    for(size_t i = 0; i < blocks.size() && err >= 0 && running; i++)
+    {
+      err = writer.beginBlock();
+      if(err >= 0)
+      {
+        err = writer.writeData(blocks[i].first, blocks[i].second);
+      }
+      running = progress.advance(QObject::tr("Writing boundary quads"), static_cast<double>(blocks[i].second));
+    }
+
+    bool closed = (writer.closeFile() >= 0);
+    m_StoppedEarly = !running;
+    if(m_StoppedEarly)
+    {
+      return;
+    }
+    if(!closed || err < 0)
+    {
+      QString ss = QObject::tr("Unable to write the VTK unstructured grid to the specified file.");
+      setErrorCondition(-101004, ss);
+    }
+    return;
+  }
+
+  MoabH5mWriter writer;
+  applyCompression(writer);
+  if(writer.openFile(m_Settings.outputFile.toStdString()) < 0)
+  {
+    QString ss = QObject::tr("Unable to create the output file '%1'.").arg(m_Settings.outputFile);
+    setErrorCondition(-101014, ss);
+    return;
+  }
+
+  err = writer.createNodes(numNodes);
+  if(err >= 0)
+  {
+    err = writer.writeNodes(0, numNodes, xyz.data());
+  }
+  bool running = progress.advance(QObject::tr("Writing nodes"), static_cast<double>(xyz.size() * sizeof(double)));
+
+  std::string quadGroup;
+  if(err >= 0)
+  {
+    quadGroup = writer.createElements(MoabH5mWriter::EntityType::Quad, 4, numQuads);
+    err = quadGroup.empty() ? -1 : 0;
+  }
+
+  // The extractor numbers the nodes from 0; the file numbers them from the node start id
+  const size_t k_QuadsPerBlock = 65536;
+  std::vector<int64_t> fileIds;
+  for(size_t offset = 0; offset < numQuads && err >= 0 && running; offset += k_QuadsPerBlock)
+  {
+    size_t count = std::min(k_QuadsPerBlock, numQuads - offset);
+    fileIds.assign(connectivity.begin() + offset * 4, connectivity.begin() + (offset + count) * 4);
+    for(int64_t& fileId : fileIds)
+    {
+      fileId += writer.getNodeStartId();
+    }
+    err = writer.writeConnectivity(quadGroup, offset, count, fileIds.data());
+    running = progress.advance(QObject::tr("Writing connectivity"), static_cast<double>(count * 4 * sizeof(int64_t)));
+  }
+
+  std::string quadGroupPath = MoabH5mWriter::ElementGroupPath(quadGroup);
+  const std::vector<std::pair<const char*, const int32_t*>> tags = {{k_LeftFeatureIdTagName, leftLabels.data()}, {k_RightFeatureIdTagName, rightLabels.data()}};
+  for(size_t i = 0; i < tags.size() && err >= 0 && running; i++)
+  {
+    err = writer.createDenseTag(tags[i].first, H5T_NATIVE_INT32, 1);
+    if(err >= 0)
+    {
+      err = writer.createDenseTagData(quadGroupPath, tags[i].first, numQuads);
+    }
+    if(err >= 0)
+    {
+      err = writer.writeDenseTagData(quadGroupPath, tags[i].first, 0, numQuads, tags[i].second);
+    }
+    running = progress.advance(QObject::tr("Writing %1").arg(tags[i].first), static_cast<double>(numQuads * sizeof(int32_t)));
+  }
+
+  bool closed = (writer.closeFile() >= 0);
+  m_StoppedEarly = !running;
+  if(m_StoppedEarly)
+  {
+    return;
+  }
+  if(!closed || err < 0)
+  {
+    QString ss = QObject::tr("Unable to write MOAB mesh to the specified file.");
+    setErrorCondition(-101004, ss);
+    return;
+  }
+}
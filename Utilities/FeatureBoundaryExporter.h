@@ -0,0 +1,58 @@
+/* ============================================================================
+* Copyright (c) 2018 BlueQuartz Software, LLC
+*
+* Redistribution and use in source and binary forms, with or without modification,
+* are permitted provided that the following conditions are met:
+*
+* Redistributions of source code must retain the above copyright notice, this
+* list of conditions and the following disclaimer.
+*
+* Redistributions in binary form must reproduce the above copyright notice, this
+* list of conditions and the following disclaimer in the documentation and/or
+* other materials provided with the distribution.
+*
+* Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+* contributors may be used to endorse or promote products derived from this software
+* without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+* DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+* FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+* DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+* OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+* USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*
+* ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#pragma once
+
+#include "MeshExporter.h"
+
+/**
+ * @brief The FeatureBoundaryExporter class writes the quad faces that separate cells with
+ * different Feature Ids, and the faces on the outside of the volume, as a surface mesh tagged
+ * with the Feature Id on each side of every face. The faces are found with
+ * FeatureBoundaryExtractor and written to a native h5m file or an appended vtu file.
+ */
+class FeatureBoundaryExporter : public MeshExporter
+{
+public:
+  FeatureBoundaryExporter(AbstractFilter* filter, const MeshExportSettings& settings);
+  ~FeatureBoundaryExporter() override;
+
+  /**
+   * @brief Writes the boundary faces of the Features of the ImageGeom
+   * @param image ImageGeom that holds the Feature Ids
+   */
+  void write(const ImageGeom::Pointer& image);
+
+public:
+  FeatureBoundaryExporter(const FeatureBoundaryExporter&) = delete;            // Copy Constructor Not Implemented
+  FeatureBoundaryExporter(FeatureBoundaryExporter&&) = delete;                 // Move Constructor Not Implemented
+  FeatureBoundaryExporter& operator=(const FeatureBoundaryExporter&) = delete; // Copy Assignment Not Implemented
+  FeatureBoundaryExporter& operator=(FeatureBoundaryExporter&&) = delete;      // Move Assignment Not Implemented
+};
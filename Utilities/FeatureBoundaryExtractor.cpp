@@ -0,0 +1,336 @@
+/* ============================================================================
+* Copyright (c) 2018 BlueQuartz Software, LLC
+*
+* Redistribution and use in source and binary forms, with or without modification,
+* are permitted provided that the following conditions are met:
+*
+* Redistributions of source code must retain the above copyright notice, this
+* list of conditions and the following disclaimer.
+*
+* Redistributions in binary form must reproduce the above copyright notice, this
+* list of conditions and the following disclaimer in the documentation and/or
+* other materials provided with the distribution.
+*
+* Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+* contributors may be used to endorse or promote products derived from this software
+* without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+* DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+* FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+* DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+* OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+* USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*
+* ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+
+#include "FeatureBoundaryExtractor.h"
+
+#include <algorithm>
+#include <thread>
+
+#include "SIMPLib/SIMPLib.h"
+
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_for.h>
+#include <tbb/parallel_sort.h>
+#include <tbb/partitioner.h>
+#endif
+
+namespace
+{
+/**
+ * @brief The faces found in one Z slab
+ */
+struct SlabFaces
+{
+  std::vector<int64_t> connectivity;
+  std::vector<int32_t> leftLabels;
+  std::vector<int32_t> rightLabels;
+};
+
+/**
+ * @brief Extracts the faces owned by the cells of each slab. A cell owns the faces on the
+ * negative side of each axis, and also the positive side faces on the upper domain boundary.
+ */
+class ExtractFacesImpl
+{
+public:
+  ExtractFacesImpl(const int32_t* labels, const size_t dims[3], size_t slabDepth, std::vector<SlabFaces>& slabs)
+  : m_Labels(labels)
+  , m_Dims(dims)
+  , m_SlabDepth(slabDepth)
+  , m_Slabs(slabs)
+  {
+  }
+
+  void convert(size_t slabBegin, size_t slabEnd) const
+  {
+    const int64_t nx = static_cast<int64_t>(m_Dims[0]);
+    const int64_t ny = static_cast<int64_t>(m_Dims[1]);
+    const int64_t nz = static_cast<int64_t>(m_Dims[2]);
+    const int64_t nodeRow = nx + 1;
+    const int64_t nodeLayer = (nx + 1) * (ny + 1);
+
+    for(size_t slab = slabBegin; slab < slabEnd; slab++)
+    {
+      SlabFaces& faces = m_Slabs[slab];
+      int64_t zBegin = static_cast<int64_t>(slab * m_SlabDepth);
+      int64_t zEnd = std::min(zBegin + static_cast<int64_t>(m_SlabDepth), nz);
+
+      auto addFace = [&faces](int64_t n0, int64_t n1, int64_t n2, int64_t n3, int32_t left, int32_t right) {
+        faces.connectivity.insert(faces.connectivity.end(), {n0, n1, n2, n3});
+        faces.leftLabels.push_back(left);
+        faces.rightLabels.push_back(right);
+      };
+
+      for(int64_t z = zBegin; z < zEnd; z++)
+      {
+        for(int64_t y = 0; y < ny; y++)
+        {
+          for(int64_t x = 0; x < nx; x++)
+          {
+            size_t cell = static_cast<size_t>((z * ny + y) * nx + x);
+            int32_t label = m_Labels[cell];
+            int64_t n0 = z * nodeLayer + y * nodeRow + x;
+
+            // Faces normal to X, wound Y then Z so the normal points along +X
+            int32_t left = (x == 0) ? FeatureBoundaryExtractor::ExteriorLabel : m_Labels[cell - 1];
+            if(left != label)
+            {
+              addFace(n0, n0 + nodeRow, n0 + nodeRow + nodeLayer, n0 + nodeLayer, left, label);
+            }
+            if(x == nx - 1)
+            {
+              addFace(n0 + 1, n0 + 1 + nodeRow, n0 + 1 + nodeRow + nodeLayer, n0 + 1 + nodeLayer, label, FeatureBoundaryExtractor::ExteriorLabel);
+            }
+
+            // Faces normal to Y, wound Z then X so the normal points along +Y
+            left = (y == 0) ? FeatureBoundaryExtractor::ExteriorLabel : m_Labels[cell - m_Dims[0]];
+            if(left != label)
+            {
+              addFace(n0, n0 + nodeLayer, n0 + nodeLayer + 1, n0 + 1, left, label);
+            }
+            if(y == ny - 1)
+            {
+              addFace(n0 + nodeRow, n0 + nodeRow + nodeLayer, n0 + nodeRow + nodeLayer + 1, n0 + nodeRow + 1, label, FeatureBoundaryExtractor::ExteriorLabel);
+            }
+
+            // Faces normal to Z, wound X then Y so the normal points along +Z
+            left = (z == 0) ? FeatureBoundaryExtractor::ExteriorLabel : m_Labels[cell - m_Dims[0] * m_Dims[1]];
+            if(left != label)
+            {
+              addFace(n0, n0 + 1, n0 + 1 + nodeRow, n0 + nodeRow, left, label);
+            }
+            if(z == nz - 1)
+            {
+              addFace(n0 + nodeLayer, n0 + nodeLayer + 1, n0 + nodeLayer + 1 + nodeRow, n0 + nodeLayer + nodeRow, label, FeatureBoundaryExtractor::ExteriorLabel);
+            }
+          }
+        }
+      }
+    }
+  }
+
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+  void operator()(const tbb::blocked_range<size_t>& r) const
+  {
+    convert(r.begin(), r.end());
+  }
+#endif
+
+private:
+  const int32_t* m_Labels;
+  const size_t* m_Dims;
+  size_t m_SlabDepth;
+  std::vector<SlabFaces>& m_Slabs;
+};
+
+/**
+ * @brief Replaces the grid node indices of the connectivity with their position among the used nodes
+ */
+class RenumberNodesImpl
+{
+public:
+  RenumberNodesImpl(const std::vector<int64_t>& nodeIds, std::vector<int64_t>& connectivity)
+  : m_NodeIds(nodeIds)
+  , m_Connectivity(connectivity)
+  {
+  }
+
+  void convert(size_t start, size_t end) const
+  {
+    for(size_t i = start; i < end; i++)
+    {
+      auto iter = std::lower_bound(m_NodeIds.begin(), m_NodeIds.end(), m_Connectivity[i]);
+      m_Connectivity[i] = static_cast<int64_t>(iter - m_NodeIds.begin());
+    }
+  }
+
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+  void operator()(const tbb::blocked_range<size_t>& r) const
+  {
+    convert(r.begin(), r.end());
+  }
+#endif
+
+private:
+  const std::vector<int64_t>& m_NodeIds;
+  std::vector<int64_t>& m_Connectivity;
+};
+} // namespace
+
+const int32_t FeatureBoundaryExtractor::ExteriorLabel;
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+FeatureBoundaryExtractor::FeatureBoundaryExtractor(const size_t dims[3], const float resolution[3], const float origin[3])
+{
+  for(size_t i = 0; i < 3; i++)
+  {
+    m_Dims[i] = dims[i];
+    m_Resolution[i] = resolution[i];
+    m_Origin[i] = origin[i];
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+FeatureBoundaryExtractor::~FeatureBoundaryExtractor() = default;
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void FeatureBoundaryExtractor::execute(const int32_t* labels)
+{
+  m_Connectivity.clear();
+  m_LeftLabels.clear();
+  m_RightLabels.clear();
+  m_NodeIds.clear();
+
+  if(m_Dims[0] == 0 || m_Dims[1] == 0 || m_Dims[2] == 0)
+  {
+    return;
+  }
+
+  // A few slabs per thread keeps the threads busy when the boundary density varies along Z
+  size_t numSlabs = 1;
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+  numSlabs = std::max<size_t>(1, std::thread::hardware_concurrency()) * 4;
+#endif
+  numSlabs = std::min(numSlabs, m_Dims[2]);
+  size_t slabDepth = (m_Dims[2] + numSlabs - 1) / numSlabs;
+  numSlabs = (m_Dims[2] + slabDepth - 1) / slabDepth;
+
+  std::vector<SlabFaces> slabs(numSlabs);
+  {
+    ExtractFacesImpl impl(labels, m_Dims, slabDepth, slabs);
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+    tbb::parallel_for(tbb::blocked_range<size_t>(0, numSlabs, 1), impl, tbb::simple_partitioner());
+#else
+    impl.convert(0, numSlabs);
+#endif
+  }
+
+  // Slabs are appended in Z order so the output does not depend on the thread count
+  size_t numQuads = 0;
+  for(const SlabFaces& faces : slabs)
+  {
+    numQuads += faces.leftLabels.size();
+  }
+  m_Connectivity.reserve(numQuads * 4);
+  m_LeftLabels.reserve(numQuads);
+  m_RightLabels.reserve(numQuads);
+  for(SlabFaces& faces : slabs)
+  {
+    m_Connectivity.insert(m_Connectivity.end(), faces.connectivity.begin(), faces.connectivity.end());
+    m_LeftLabels.insert(m_LeftLabels.end(), faces.leftLabels.begin(), faces.leftLabels.end());
+    m_RightLabels.insert(m_RightLabels.end(), faces.rightLabels.begin(), faces.rightLabels.end());
+    faces = SlabFaces();
+  }
+
+  // Merge the nodes shared by neighboring faces. Sorting the used grid nodes keeps the memory
+  // proportional to the surface rather than to the volume.
+  m_NodeIds = m_Connectivity;
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+  tbb::parallel_sort(m_NodeIds.begin(), m_NodeIds.end());
+#else
+  std::sort(m_NodeIds.begin(), m_NodeIds.end());
+#endif
+  m_NodeIds.erase(std::unique(m_NodeIds.begin(), m_NodeIds.end()), m_NodeIds.end());
+  m_NodeIds.shrink_to_fit();
+
+  RenumberNodesImpl impl(m_NodeIds, m_Connectivity);
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+  tbb::parallel_for(tbb::blocked_range<size_t>(0, m_Connectivity.size()), impl, tbb::auto_partitioner());
+#else
+  impl.convert(0, m_Connectivity.size());
+#endif
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+size_t FeatureBoundaryExtractor::getNumberOfQuads() const
+{
+  return m_LeftLabels.size();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+size_t FeatureBoundaryExtractor::getNumberOfNodes() const
+{
+  return m_NodeIds.size();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+const std::vector<int64_t>& FeatureBoundaryExtractor::getConnectivity() const
+{
+  return m_Connectivity;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+const std::vector<int32_t>& FeatureBoundaryExtractor::getLeftLabels() const
+{
+  return m_LeftLabels;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+const std::vector<int32_t>& FeatureBoundaryExtractor::getRightLabels() const
+{
+  return m_RightLabels;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void FeatureBoundaryExtractor::generateNodes(size_t offset, size_t count, double* xyz) const
+{
+  const int64_t nodeRow = static_cast<int64_t>(m_Dims[0]) + 1;
+  const int64_t nodeLayer = nodeRow * (static_cast<int64_t>(m_Dims[1]) + 1);
+  for(size_t i = 0; i < count; i++)
+  {
+    int64_t nodeId = m_NodeIds[offset + i];
+    int64_t z = nodeId / nodeLayer;
+    int64_t y = (nodeId - z * nodeLayer) / nodeRow;
+    int64_t x = nodeId - z * nodeLayer - y * nodeRow;
+    xyz[3 * i] = m_Origin[0] + x * m_Resolution[0];
+    xyz[3 * i + 1] = m_Origin[1] + y * m_Resolution[1];
+    xyz[3 * i + 2] = m_Origin[2] + z * m_Resolution[2];
+  }
+}
@@ -0,0 +1,121 @@
+/* ============================================================================
+* Copyright (c) 2018 BlueQuartz Software, LLC
+*
+* Redistribution and use in source and binary forms, with or without modification,
+* are permitted provided that the following conditions are met:
+*
+* Redistributions of source code must retain the above copyright notice, this
+* list of conditions and the following disclaimer.
+*
+* Redistributions in binary form must reproduce the above copyright notice, this
+* list of conditions and the following disclaimer in the documentation and/or
+* other materials provided with the distribution.
+*
+* Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+* contributors may be used to endorse or promote products derived from this software
+* without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+* DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+* FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+* DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+* OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+* USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*
+* ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+/**
+ * @brief The FeatureBoundaryExtractor class extracts the quad faces of an ImageGeom that
+ * separate cells with different labels, plus the faces on the outside of the volume. Each
+ * face is stored once with the label of the cell on its negative side (left) and the label
+ * of the cell on its positive side (right); the outside of the volume carries ExteriorLabel.
+ * Quads are wound so their normal points from the left cell to the right cell.
+ *
+ * The faces of each Z slab are extracted independently, in parallel when SIMPL is built with
+ * TBB, and the nodes the faces use are merged afterwards so every grid node appears once.
+ */
+class FeatureBoundaryExtractor
+{
+public:
+  static const int32_t ExteriorLabel = -1;
+
+  /**
+   * @brief Constructor
+   * @param dims Number of cells along X, Y and Z
+   * @param resolution Cell spacing
+   * @param origin Position of the first grid node
+   */
+  FeatureBoundaryExtractor(const size_t dims[3], const float resolution[3], const float origin[3]);
+  virtual ~FeatureBoundaryExtractor();
+
+  /**
+   * @brief Extracts the boundary faces
+   * @param labels One label per cell, X varying fastest
+   */
+  void execute(const int32_t* labels);
+
+  /**
+   * @brief Returns the number of extracted quads
+   * @return
+   */
+  size_t getNumberOfQuads() const;
+
+  /**
+   * @brief Returns the number of distinct nodes the quads use
+   * @return
+   */
+  size_t getNumberOfNodes() const;
+
+  /**
+   * @brief Returns four node indices per quad. The indices run from 0 to getNumberOfNodes() - 1.
+   * @return
+   */
+  const std::vector<int64_t>& getConnectivity() const;
+
+  /**
+   * @brief Returns the label on the negative side of each quad
+   * @return
+   */
+  const std::vector<int32_t>& getLeftLabels() const;
+
+  /**
+   * @brief Returns the label on the positive side of each quad
+   * @return
+   */
+  const std::vector<int32_t>& getRightLabels() const;
+
+  /**
+   * @brief Fills the interleaved XYZ coordinates of nodes [offset, offset + count)
+   * @param offset
+   * @param count
+   * @param xyz
+   */
+  void generateNodes(size_t offset, size_t count, double* xyz) const;
+
+private:
+  size_t m_Dims[3] = {0, 0, 0};
+  float m_Resolution[3] = {0.0f, 0.0f, 0.0f};
+  float m_Origin[3] = {0.0f, 0.0f, 0.0f};
+
+  std::vector<int64_t> m_Connectivity;
+  std::vector<int32_t> m_LeftLabels;
+  std::vector<int32_t> m_RightLabels;
+  std::vector<int64_t> m_NodeIds; //!< Sorted grid node indices of the used nodes
+
+public:
+  FeatureBoundaryExtractor(const FeatureBoundaryExtractor&) = delete;            // Copy Constructor Not Implemented
+  FeatureBoundaryExtractor(FeatureBoundaryExtractor&&) = delete;                 // Move Constructor Not Implemented
+  FeatureBoundaryExtractor& operator=(const FeatureBoundaryExtractor&) = delete; // Copy Assignment Not Implemented
+  FeatureBoundaryExtractor& operator=(FeatureBoundaryExtractor&&) = delete;      // Move Assignment Not Implemented
+};
@@ -0,0 +1,186 @@
+/* ============================================================================
+* Copyright (c) 2018 BlueQuartz Software, LLC
+*
+* Redistribution and use in source and binary forms, with or without modification,
+* are permitted provided that the following conditions are met:
+*
+* Redistributions of source code must retain the above copyright notice, this
+* list of conditions and the following disclaimer.
+*
+* Redistributions in binary form must reproduce the above copyright notice, this
+* list of conditions and the following disclaimer in the documentation and/or
+* other materials provided with the distribution.
+*
+* Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+* contributors may be used to endorse or promote products derived from this software
+* without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+* DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+* FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+* DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+* OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+* USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*
+* ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+
+#include "ImageRegion.h"
+
+#include <cstring>
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+ImageRegion::ImageRegion(const size_t dims[3])
+{
+  for(size_t i = 0; i < 3; i++)
+  {
+    m_SourceDims[i] = dims[i];
+    m_Dims[i] = dims[i];
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+ImageRegion::ImageRegion(const size_t dims[3], const size_t minIndex[3], const size_t maxIndex[3])
+{
+  for(size_t i = 0; i < 3; i++)
+  {
+    m_SourceDims[i] = dims[i];
+    m_MinIndex[i] = minIndex[i];
+    m_Dims[i] = maxIndex[i] - minIndex[i] + 1;
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+ImageRegion::~ImageRegion() = default;
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void ImageRegion::getDimensions(size_t dims[3]) const
+{
+  for(size_t i = 0; i < 3; i++)
+  {
+    dims[i] = m_Dims[i];
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void ImageRegion::getOrigin(const float origin[3], const float resolution[3], float regionOrigin[3]) const
+{
+  for(size_t i = 0; i < 3; i++)
+  {
+    regionOrigin[i] = origin[i] + m_MinIndex[i] * resolution[i];
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+size_t ImageRegion::getNumberOfCells() const
+{
+  return m_Dims[0] * m_Dims[1] * m_Dims[2];
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+size_t ImageRegion::getCellsPerLayer() const
+{
+  return m_Dims[0] * m_Dims[1];
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool ImageRegion::isWholeGeometry() const
+{
+  return isLayerContiguous() && m_Dims[2] == m_SourceDims[2];
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool ImageRegion::isLayerContiguous() const
+{
+  return m_Dims[0] == m_SourceDims[0] && m_Dims[1] == m_SourceDims[1];
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+const void* ImageRegion::getCellPointer(const void* source, size_t tupleSize, size_t x, size_t y, size_t z) const
+{
+  size_t index = ((m_MinIndex[2] + z) * m_SourceDims[1] + m_MinIndex[1] + y) * m_SourceDims[0] + m_MinIndex[0] + x;
+  return static_cast<const char*>(source) + index * tupleSize;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+const void* ImageRegion::getLayerPointer(const void* source, size_t tupleSize, size_t z) const
+{
+  return getCellPointer(source, tupleSize, 0, 0, z);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void ImageRegion::copyLayers(const void* source, size_t tupleSize, size_t zBegin, size_t zEnd, void* buffer) const
+{
+  // Each X run of the region is contiguous in the source array
+  size_t rowBytes = m_Dims[0] * tupleSize;
+  size_t sourceRowBytes = m_SourceDims[0] * tupleSize;
+  char* destination = static_cast<char*>(buffer);
+  for(size_t z = zBegin; z < zEnd; z++)
+  {
+    const char* row = static_cast<const char*>(getLayerPointer(source, tupleSize, z));
+    for(size_t y = 0; y < m_Dims[1]; y++)
+    {
+      std::memcpy(destination, row, rowBytes);
+      destination += rowBytes;
+      row += sourceRowBytes;
+    }
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void ImageRegion::copyCells(const void* source, size_t tupleSize, const size_t* cells, size_t count, void* buffer) const
+{
+  size_t cellsPerLayer = getCellsPerLayer();
+  char* destination = static_cast<char*>(buffer);
+  for(size_t i = 0; i < count; i++)
+  {
+    size_t z = cells[i] / cellsPerLayer;
+    size_t y = (cells[i] - z * cellsPerLayer) / m_Dims[0];
+    size_t x = cells[i] - z * cellsPerLayer - y * m_Dims[0];
+    std::memcpy(destination, getCellPointer(source, tupleSize, x, y, z), tupleSize);
+    destination += tupleSize;
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+const void* ImageRegion::gatherLayers(const void* source, size_t tupleSize, size_t zBegin, size_t zEnd, void* buffer) const
+{
+  if(isLayerContiguous())
+  {
+    return getLayerPointer(source, tupleSize, zBegin);
+  }
+  copyLayers(source, tupleSize, zBegin, zEnd, buffer);
+  return buffer;
+}
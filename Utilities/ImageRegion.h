@@ -0,0 +1,161 @@
+/* ============================================================================
+* Copyright (c) 2018 BlueQuartz Software, LLC
+*
+* Redistribution and use in source and binary forms, with or without modification,
+* are permitted provided that the following conditions are met:
+*
+* Redistributions of source code must retain the above copyright notice, this
+* list of conditions and the following disclaimer.
+*
+* Redistributions in binary form must reproduce the above copyright notice, this
+* list of conditions and the following disclaimer in the documentation and/or
+* other materials provided with the distribution.
+*
+* Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+* contributors may be used to endorse or promote products derived from this software
+* without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+* DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+* FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+* DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+* OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+* USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*
+* ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+
+#pragma once
+
+#include <cstddef>
+
+/**
+ * @brief The ImageRegion class describes a box of cells inside an ImageGeom and reads the
+ * cell values of that box straight from the arrays of the full geometry. No copy of the
+ * DataContainer is made: when the box spans whole XY layers its values are already contiguous
+ * in the source array and are used in place, otherwise the rows of the box are gathered one
+ * X run at a time into a caller supplied buffer.
+ *
+ * Layer indices passed to the methods below are relative to the region.
+ */
+class ImageRegion
+{
+public:
+  /**
+   * @brief Creates a region that covers the whole geometry
+   * @param dims Number of cells of the geometry along X, Y and Z
+   */
+  explicit ImageRegion(const size_t dims[3]);
+
+  /**
+   * @brief Creates a region from inclusive cell index bounds. The bounds must lie inside the geometry.
+   * @param dims Number of cells of the geometry along X, Y and Z
+   * @param minIndex First cell of the region along X, Y and Z
+   * @param maxIndex Last cell of the region along X, Y and Z
+   */
+  ImageRegion(const size_t dims[3], const size_t minIndex[3], const size_t maxIndex[3]);
+
+  virtual ~ImageRegion();
+
+  /**
+   * @brief Returns the number of cells of the region along X, Y and Z
+   * @param dims
+   */
+  void getDimensions(size_t dims[3]) const;
+
+  /**
+   * @brief Returns the position of the first node of the region
+   * @param origin Origin of the geometry
+   * @param resolution Cell spacing of the geometry
+   * @param regionOrigin
+   */
+  void getOrigin(const float origin[3], const float resolution[3], float regionOrigin[3]) const;
+
+  /**
+   * @brief Returns the number of cells in the region
+   * @return
+   */
+  size_t getNumberOfCells() const;
+
+  /**
+   * @brief Returns the number of cells in one Z layer of the region
+   * @return
+   */
+  size_t getCellsPerLayer() const;
+
+  /**
+   * @brief Returns whether the region covers the whole geometry
+   * @return
+   */
+  bool isWholeGeometry() const;
+
+  /**
+   * @brief Returns whether the region spans whole XY layers, in which case any range of its
+   * Z layers is contiguous in the source arrays
+   * @return
+   */
+  bool isLayerContiguous() const;
+
+  /**
+   * @brief Returns the address of region cell (x, y, z) inside a source array
+   * @param source First tuple of the source array
+   * @param tupleSize Size of one tuple in bytes
+   * @param x
+   * @param y
+   * @param z
+   * @return
+   */
+  const void* getCellPointer(const void* source, size_t tupleSize, size_t x, size_t y, size_t z) const;
+
+  /**
+   * @brief Returns the address of the first region cell of layer z inside a source array
+   * @param source First tuple of the source array
+   * @param tupleSize Size of one tuple in bytes
+   * @param z
+   * @return
+   */
+  const void* getLayerPointer(const void* source, size_t tupleSize, size_t z) const;
+
+  /**
+   * @brief Copies the region cells of layers [zBegin, zEnd) from a source array into a buffer
+   * @param source First tuple of the source array
+   * @param tupleSize Size of one tuple in bytes
+   * @param zBegin
+   * @param zEnd
+   * @param buffer Must hold (zEnd - zBegin) * getCellsPerLayer() tuples
+   */
+  void copyLayers(const void* source, size_t tupleSize, size_t zBegin, size_t zEnd, void* buffer) const;
+
+  /**
+   * @brief Copies a list of region cells from a source array into a buffer, in the order of
+   * the list
+   * @param source First tuple of the source array
+   * @param tupleSize Size of one tuple in bytes
+   * @param cells Region cell indices, numbered with X varying fastest
+   * @param count
+   * @param buffer Must hold count tuples
+   */
+  void copyCells(const void* source, size_t tupleSize, const size_t* cells, size_t count, void* buffer) const;
+
+  /**
+   * @brief Returns the region cells of layers [zBegin, zEnd) as one contiguous block. The block
+   * points into the source array when the region is layer contiguous, otherwise it is copied
+   * into the buffer, which may then be null.
+   * @param source First tuple of the source array
+   * @param tupleSize Size of one tuple in bytes
+   * @param zBegin
+   * @param zEnd
+   * @param buffer
+   * @return
+   */
+  const void* gatherLayers(const void* source, size_t tupleSize, size_t zBegin, size_t zEnd, void* buffer) const;
+
+private:
+  size_t m_SourceDims[3] = {0, 0, 0};
+  size_t m_MinIndex[3] = {0, 0, 0};
+  size_t m_Dims[3] = {0, 0, 0};
+};
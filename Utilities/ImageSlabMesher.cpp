@@ -0,0 +1,415 @@
+/* ============================================================================
+* Copyright (c) 2018 BlueQuartz Software, LLC
+*
+* Redistribution and use in source and binary forms, with or without modification,
+* are permitted provided that the following conditions are met:
+*
+* Redistributions of source code must retain the above copyright notice, this
+* list of conditions and the following disclaimer.
+*
+* Redistributions in binary form must reproduce the above copyright notice, this
+* list of conditions and the following disclaimer in the documentation and/or
+* other materials provided with the distribution.
+*
+* Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+* contributors may be used to endorse or promote products derived from this software
+* without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+* DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+* FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+* DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+* OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+* USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*
+* ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+
+#include "ImageSlabMesher.h"
+
+#include "SIMPLib/SIMPLib.h"
+
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_for.h>
+#include <tbb/partitioner.h>
+#endif
+
+namespace
+{
+/**
+ * @brief Writes the interleaved XYZ coordinates of a range of node layers. Each layer goes to
+ * its own part of the buffer, so the layers of a slab can be generated in parallel.
+ */
+class GenerateNodesImpl
+{
+public:
+  GenerateNodesImpl(const size_t* dims, const double* resolution, const double* origin, size_t layerBegin, double* xyz)
+  : m_Dims(dims)
+  , m_Resolution(resolution)
+  , m_Origin(origin)
+  , m_LayerBegin(layerBegin)
+  , m_Xyz(xyz)
+  {
+  }
+
+  void convert(size_t start, size_t end) const
+  {
+    size_t index = start * (m_Dims[0] + 1) * (m_Dims[1] + 1) * 3;
+    for(size_t z = m_LayerBegin + start; z < m_LayerBegin + end; z++)
+    {
+      double zPos = m_Origin[2] + z * m_Resolution[2];
+      for(size_t y = 0; y <= m_Dims[1]; y++)
+      {
+        double yPos = m_Origin[1] + y * m_Resolution[1];
+        for(size_t x = 0; x <= m_Dims[0]; x++)
+        {
+          m_Xyz[index++] = m_Origin[0] + x * m_Resolution[0];
+          m_Xyz[index++] = yPos;
+          m_Xyz[index++] = zPos;
+        }
+      }
+    }
+  }
+
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+  void operator()(const tbb::blocked_range<size_t>& r) const
+  {
+    convert(r.begin(), r.end());
+  }
+#endif
+
+private:
+  const size_t* m_Dims;
+  const double* m_Resolution;
+  const double* m_Origin;
+  size_t m_LayerBegin;
+  double* m_Xyz;
+};
+
+/**
+ * @brief Writes the interleaved XYZ coordinates of a list of nodes given in any order
+ */
+class GenerateNodeListImpl
+{
+public:
+  GenerateNodeListImpl(const size_t* dims, const double* resolution, const double* origin, const size_t* nodes, double* xyz)
+  : m_Dims(dims)
+  , m_Resolution(resolution)
+  , m_Origin(origin)
+  , m_Nodes(nodes)
+  , m_Xyz(xyz)
+  {
+  }
+
+  void convert(size_t start, size_t end) const
+  {
+    const size_t rowStride = m_Dims[0] + 1;
+    const size_t layerStride = (m_Dims[0] + 1) * (m_Dims[1] + 1);
+    for(size_t i = start; i < end; i++)
+    {
+      size_t node = m_Nodes[i];
+      size_t z = node / layerStride;
+      size_t y = (node - z * layerStride) / rowStride;
+      size_t x = node - z * layerStride - y * rowStride;
+      m_Xyz[3 * i] = m_Origin[0] + x * m_Resolution[0];
+      m_Xyz[3 * i + 1] = m_Origin[1] + y * m_Resolution[1];
+      m_Xyz[3 * i + 2] = m_Origin[2] + z * m_Resolution[2];
+    }
+  }
+
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+  void operator()(const tbb::blocked_range<size_t>& r) const
+  {
+    convert(r.begin(), r.end());
+  }
+#endif
+
+private:
+  const size_t* m_Dims;
+  const double* m_Resolution;
+  const double* m_Origin;
+  const size_t* m_Nodes;
+  double* m_Xyz;
+};
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+inline void WriteHex8(int64_t n0, int64_t rowStride, int64_t layerStride, int64_t* connectivity)
+{
+  // Hex8 ordering: counter-clockwise bottom face, then the top face above it
+  connectivity[0] = n0;
+  connectivity[1] = n0 + 1;
+  connectivity[2] = n0 + 1 + rowStride;
+  connectivity[3] = n0 + rowStride;
+  connectivity[4] = n0 + layerStride;
+  connectivity[5] = n0 + 1 + layerStride;
+  connectivity[6] = n0 + 1 + rowStride + layerStride;
+  connectivity[7] = n0 + rowStride + layerStride;
+}
+
+/**
+ * @brief Writes the Hex8 connectivity of a range of element layers
+ */
+class GenerateConnectivityImpl
+{
+public:
+  GenerateConnectivityImpl(const size_t* dims, size_t layerBegin, int64_t firstNodeId, int64_t* connectivity)
+  : m_Dims(dims)
+  , m_LayerBegin(layerBegin)
+  , m_FirstNodeId(firstNodeId)
+  , m_Connectivity(connectivity)
+  {
+  }
+
+  void convert(size_t start, size_t end) const
+  {
+    const int64_t rowStride = static_cast<int64_t>(m_Dims[0] + 1);
+    const int64_t layerStride = static_cast<int64_t>((m_Dims[0] + 1) * (m_Dims[1] + 1));
+
+    size_t index = start * m_Dims[0] * m_Dims[1] * 8;
+    for(size_t z = m_LayerBegin + start; z < m_LayerBegin + end; z++)
+    {
+      for(size_t y = 0; y < m_Dims[1]; y++)
+      {
+        int64_t rowStart = m_FirstNodeId + static_cast<int64_t>(z) * layerStride + static_cast<int64_t>(y) * rowStride;
+        for(size_t x = 0; x < m_Dims[0]; x++)
+        {
+          WriteHex8(rowStart + static_cast<int64_t>(x), rowStride, layerStride, m_Connectivity + index);
+          index += 8;
+        }
+      }
+    }
+  }
+
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+  void operator()(const tbb::blocked_range<size_t>& r) const
+  {
+    convert(r.begin(), r.end());
+  }
+#endif
+
+private:
+  const size_t* m_Dims;
+  size_t m_LayerBegin;
+  int64_t m_FirstNodeId;
+  int64_t* m_Connectivity;
+};
+
+/**
+ * @brief Writes the Hex8 connectivity of a list of elements given in any order, optionally
+ * with the nodes renumbered
+ */
+class GenerateElementConnectivityImpl
+{
+public:
+  GenerateElementConnectivityImpl(const size_t* dims, const size_t* elements, int64_t firstNodeId, int64_t* connectivity, const int64_t* nodeIds)
+  : m_Dims(dims)
+  , m_Elements(elements)
+  , m_FirstNodeId(firstNodeId)
+  , m_Connectivity(connectivity)
+  , m_NodeIds(nodeIds)
+  {
+  }
+
+  void convert(size_t start, size_t end) const
+  {
+    const int64_t rowStride = static_cast<int64_t>(m_Dims[0] + 1);
+    const int64_t layerStride = static_cast<int64_t>((m_Dims[0] + 1) * (m_Dims[1] + 1));
+    const size_t elementsPerLayer = m_Dims[0] * m_Dims[1];
+
+    for(size_t i = start; i < end; i++)
+    {
+      size_t element = m_Elements[i];
+      size_t z = element / elementsPerLayer;
+      size_t y = (element - z * elementsPerLayer) / m_Dims[0];
+      size_t x = element - z * elementsPerLayer - y * m_Dims[0];
+      int64_t n0 = static_cast<int64_t>(z) * layerStride + static_cast<int64_t>(y) * rowStride + static_cast<int64_t>(x);
+      int64_t* hex = m_Connectivity + i * 8;
+      if(nullptr == m_NodeIds)
+      {
+        WriteHex8(m_FirstNodeId + n0, rowStride, layerStride, hex);
+        continue;
+      }
+
+      WriteHex8(n0, rowStride, layerStride, hex);
+      for(size_t c = 0; c < 8; c++)
+      {
+        hex[c] = m_FirstNodeId + m_NodeIds[hex[c]];
+      }
+    }
+  }
+
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+  void operator()(const tbb::blocked_range<size_t>& r) const
+  {
+    convert(r.begin(), r.end());
+  }
+#endif
+
+private:
+  const size_t* m_Dims;
+  const size_t* m_Elements;
+  int64_t m_FirstNodeId;
+  int64_t* m_Connectivity;
+  const int64_t* m_NodeIds;
+};
+} // namespace
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+ImageSlabMesher::ImageSlabMesher(const size_t dims[3], const float resolution[3], const float origin[3])
+{
+  for(int i = 0; i < 3; i++)
+  {
+    m_Dims[i] = dims[i];
+    m_Resolution[i] = resolution[i];
+    m_Origin[i] = origin[i];
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+ImageSlabMesher::~ImageSlabMesher() = default;
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+size_t ImageSlabMesher::getNumberOfNodes() const
+{
+  return getNodesPerLayer() * getNumberOfNodeLayers();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+size_t ImageSlabMesher::getNumberOfElements() const
+{
+  return getElementsPerLayer() * getNumberOfElementLayers();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+size_t ImageSlabMesher::getNodesPerLayer() const
+{
+  return (m_Dims[0] + 1) * (m_Dims[1] + 1);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+size_t ImageSlabMesher::getElementsPerLayer() const
+{
+  return m_Dims[0] * m_Dims[1];
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+size_t ImageSlabMesher::getNumberOfNodeLayers() const
+{
+  return m_Dims[2] + 1;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+size_t ImageSlabMesher::getNumberOfElementLayers() const
+{
+  return m_Dims[2];
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+size_t ImageSlabMesher::getLayersPerSlab(size_t budgetBytes) const
+{
+  size_t bytesPerLayer = getNodeBufferSize(1) * sizeof(double) + getConnectivityBufferSize(1) * sizeof(int64_t);
+  if(bytesPerLayer == 0)
+  {
+    return getNumberOfNodeLayers();
+  }
+
+  size_t layers = budgetBytes / bytesPerLayer;
+  if(layers > getNumberOfNodeLayers())
+  {
+    layers = getNumberOfNodeLayers();
+  }
+  return layers;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+size_t ImageSlabMesher::getNodeBufferSize(size_t layers) const
+{
+  return layers * getNodesPerLayer() * 3;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+size_t ImageSlabMesher::getConnectivityBufferSize(size_t layers) const
+{
+  return layers * getElementsPerLayer() * 8;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void ImageSlabMesher::generateNodes(size_t layerBegin, size_t layerEnd, double* xyz) const
+{
+  GenerateNodesImpl impl(m_Dims, m_Resolution, m_Origin, layerBegin, xyz);
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+  tbb::parallel_for(tbb::blocked_range<size_t>(0, layerEnd - layerBegin, 1), impl, tbb::auto_partitioner());
+#else
+  impl.convert(0, layerEnd - layerBegin);
+#endif
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void ImageSlabMesher::generateNodeList(const size_t* nodes, size_t count, double* xyz) const
+{
+  GenerateNodeListImpl impl(m_Dims, m_Resolution, m_Origin, nodes, xyz);
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+  tbb::parallel_for(tbb::blocked_range<size_t>(0, count), impl, tbb::auto_partitioner());
+#else
+  impl.convert(0, count);
+#endif
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void ImageSlabMesher::generateConnectivity(size_t layerBegin, size_t layerEnd, int64_t firstNodeId, int64_t* connectivity) const
+{
+  GenerateConnectivityImpl impl(m_Dims, layerBegin, firstNodeId, connectivity);
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+  tbb::parallel_for(tbb::blocked_range<size_t>(0, layerEnd - layerBegin, 1), impl, tbb::auto_partitioner());
+#else
+  impl.convert(0, layerEnd - layerBegin);
+#endif
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void ImageSlabMesher::generateElementConnectivity(const size_t* elements, size_t count, int64_t firstNodeId, int64_t* connectivity, const int64_t* nodeIds) const
+{
+  GenerateElementConnectivityImpl impl(m_Dims, elements, firstNodeId, connectivity, nodeIds);
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+  tbb::parallel_for(tbb::blocked_range<size_t>(0, count), impl, tbb::auto_partitioner());
+#else
+  impl.convert(0, count);
+#endif
+}
@@ -0,0 +1,166 @@
+/* ============================================================================
+* Copyright (c) 2018 BlueQuartz Software, LLC
+*
+* Redistribution and use in source and binary forms, with or without modification,
+* are permitted provided that the following conditions are met:
+*
+* Redistributions of source code must retain the above copyright notice, this
+* list of conditions and the following disclaimer.
+*
+* Redistributions in binary form must reproduce the above copyright notice, this
+* list of conditions and the following disclaimer in the documentation and/or
+* other materials provided with the distribution.
+*
+* Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+* contributors may be used to endorse or promote products derived from this software
+* without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+* DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+* FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+* DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+* OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+* USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*
+* ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+/**
+ * @brief The ImageSlabMesher class generates the explicit hexahedral mesh of an ImageGeom
+ * one group of Z layers at a time. Nodes and elements are numbered with X varying fastest,
+ * then Y, then Z, so the elements of a slab line up with a contiguous range of the SIMPL
+ * cell arrays and each slab maps to a contiguous range of rows in the output file.
+ *
+ * Node layers run from 0 to the Z dimension inclusive; element layers from 0 to the Z
+ * dimension exclusive. The layers of a slab are generated in parallel when SIMPL is built
+ * with TBB.
+ */
+class ImageSlabMesher
+{
+public:
+  /**
+   * @brief Constructor
+   * @param dims Number of cells along X, Y and Z
+   * @param resolution Cell spacing
+   * @param origin Position of the first node
+   */
+  ImageSlabMesher(const size_t dims[3], const float resolution[3], const float origin[3]);
+  virtual ~ImageSlabMesher();
+
+  /**
+   * @brief Returns the total number of nodes
+   * @return
+   */
+  size_t getNumberOfNodes() const;
+
+  /**
+   * @brief Returns the total number of hexahedra
+   * @return
+   */
+  size_t getNumberOfElements() const;
+
+  /**
+   * @brief Returns the number of nodes in one Z layer
+   * @return
+   */
+  size_t getNodesPerLayer() const;
+
+  /**
+   * @brief Returns the number of hexahedra in one Z layer
+   * @return
+   */
+  size_t getElementsPerLayer() const;
+
+  /**
+   * @brief Returns the number of node layers
+   * @return
+   */
+  size_t getNumberOfNodeLayers() const;
+
+  /**
+   * @brief Returns the number of element layers
+   * @return
+   */
+  size_t getNumberOfElementLayers() const;
+
+  /**
+   * @brief Returns how many layers a slab may hold so that one node buffer and one
+   * connectivity buffer sized with getNodeBufferSize() and getConnectivityBufferSize()
+   * fit inside the budget.
+   * @param budgetBytes
+   * @return 0 if not even a single layer fits
+   */
+  size_t getLayersPerSlab(size_t budgetBytes) const;
+
+  /**
+   * @brief Returns the number of doubles needed to hold the coordinates of a slab
+   * @param layers
+   * @return
+   */
+  size_t getNodeBufferSize(size_t layers) const;
+
+  /**
+   * @brief Returns the number of ids needed to hold the connectivity of a slab
+   * @param layers
+   * @return
+   */
+  size_t getConnectivityBufferSize(size_t layers) const;
+
+  /**
+   * @brief Writes interleaved XYZ coordinates of node layers [layerBegin, layerEnd)
+   * @param layerBegin
+   * @param layerEnd
+   * @param xyz
+   */
+  void generateNodes(size_t layerBegin, size_t layerEnd, double* xyz) const;
+
+  /**
+   * @brief Writes interleaved XYZ coordinates of a list of nodes, such as a range of the nodes
+   * in a renumbered order, in the order of the list
+   * @param nodes Node indices, numbered with X varying fastest
+   * @param count
+   * @param xyz
+   */
+  void generateNodeList(const size_t* nodes, size_t count, double* xyz) const;
+
+  /**
+   * @brief Writes the Hex8 connectivity of element layers [layerBegin, layerEnd)
+   * @param layerBegin
+   * @param layerEnd
+   * @param firstNodeId Id assigned to node 0, e.g. 1 for MOAB file ids or 0 for VTK point ids
+   * @param connectivity
+   */
+  void generateConnectivity(size_t layerBegin, size_t layerEnd, int64_t firstNodeId, int64_t* connectivity) const;
+
+  /**
+   * @brief Writes the Hex8 connectivity of a list of elements, such as the elements of one
+   * Feature, in the order of the list
+   * @param elements Element indices, numbered like the cells with X varying fastest
+   * @param count
+   * @param firstNodeId Id assigned to node 0
+   * @param connectivity 8 ids per element
+   * @param nodeIds New index of every node when the nodes are renumbered, or null; the
+   * firstNodeId is added to it
+   */
+  void generateElementConnectivity(const size_t* elements, size_t count, int64_t firstNodeId, int64_t* connectivity, const int64_t* nodeIds = nullptr) const;
+
+private:
+  size_t m_Dims[3] = {0, 0, 0};
+  double m_Resolution[3] = {1.0, 1.0, 1.0};
+  double m_Origin[3] = {0.0, 0.0, 0.0};
+
+public:
+  ImageSlabMesher(const ImageSlabMesher&) = delete;            // Copy Constructor Not Implemented
+  ImageSlabMesher(ImageSlabMesher&&) = delete;                 // Move Constructor Not Implemented
+  ImageSlabMesher& operator=(const ImageSlabMesher&) = delete; // Copy Assignment Not Implemented
+  ImageSlabMesher& operator=(ImageSlabMesher&&) = delete;      // Move Assignment Not Implemented
+};
@@ -0,0 +1,436 @@
+/* ============================================================================
+* Copyright (c) 2018 BlueQuartz Software, LLC
+*
+* Redistribution and use in source and binary forms, with or without modification,
+* are permitted provided that the following conditions are met:
+*
+* Redistributions of source code must retain the above copyright notice, this
+* list of conditions and the following disclaimer.
+*
+* Redistributions in binary form must reproduce the above copyright notice, this
+* list of conditions and the following disclaimer in the documentation and/or
+* other materials provided with the distribution.
+*
+* Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+* contributors may be used to endorse or promote products derived from this software
+* without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+* DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+* FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+* DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+* OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+* USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*
+* ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+
+#include "LabelCountingSort.h"
+
+#include <algorithm>
+#include <thread>
+
+#include "SIMPLib/SIMPLib.h"
+
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_for.h>
+#include <tbb/partitioner.h>
+#endif
+
+namespace
+{
+/**
+ * @brief Finds the largest label of each chunk and flags negative labels
+ */
+class FindMaxLabelImpl
+{
+public:
+  FindMaxLabelImpl(const int32_t* labels, size_t numElements, size_t chunkSize, std::vector<int32_t>& chunkMax)
+  : m_Labels(labels)
+  , m_NumElements(numElements)
+  , m_ChunkSize(chunkSize)
+  , m_ChunkMax(chunkMax)
+  {
+  }
+
+  void convert(size_t chunkBegin, size_t chunkEnd) const
+  {
+    for(size_t chunk = chunkBegin; chunk < chunkEnd; chunk++)
+    {
+      size_t end = std::min((chunk + 1) * m_ChunkSize, m_NumElements);
+      int32_t maxLabel = -1;
+      for(size_t i = chunk * m_ChunkSize; i < end; i++)
+      {
+        if(m_Labels[i] < 0)
+        {
+          maxLabel = -2;
+          break;
+        }
+        maxLabel = std::max(maxLabel, m_Labels[i]);
+      }
+      m_ChunkMax[chunk] = maxLabel;
+    }
+  }
+
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+  void operator()(const tbb::blocked_range<size_t>& r) const
+  {
+    convert(r.begin(), r.end());
+  }
+#endif
+
+private:
+  const int32_t* m_Labels;
+  size_t m_NumElements;
+  size_t m_ChunkSize;
+  std::vector<int32_t>& m_ChunkMax;
+};
+
+/**
+ * @brief Collects the distinct labels of each chunk in ascending order
+ */
+class UniqueLabelsImpl
+{
+public:
+  UniqueLabelsImpl(const int32_t* labels, size_t numElements, size_t chunkSize, std::vector<std::vector<int32_t>>& chunkLabels)
+  : m_Labels(labels)
+  , m_NumElements(numElements)
+  , m_ChunkSize(chunkSize)
+  , m_ChunkLabels(chunkLabels)
+  {
+  }
+
+  void convert(size_t chunkBegin, size_t chunkEnd) const
+  {
+    for(size_t chunk = chunkBegin; chunk < chunkEnd; chunk++)
+    {
+      size_t end = std::min((chunk + 1) * m_ChunkSize, m_NumElements);
+      std::vector<int32_t>& labels = m_ChunkLabels[chunk];
+      labels.assign(m_Labels + chunk * m_ChunkSize, m_Labels + end);
+      std::sort(labels.begin(), labels.end());
+      labels.erase(std::unique(labels.begin(), labels.end()), labels.end());
+      labels.shrink_to_fit();
+    }
+  }
+
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+  void operator()(const tbb::blocked_range<size_t>& r) const
+  {
+    convert(r.begin(), r.end());
+  }
+#endif
+
+private:
+  const int32_t* m_Labels;
+  size_t m_NumElements;
+  size_t m_ChunkSize;
+  std::vector<std::vector<int32_t>>& m_ChunkLabels;
+};
+
+/**
+ * @brief Replaces every label of each chunk by its rank among the distinct labels
+ */
+class RankLabelsImpl
+{
+public:
+  RankLabelsImpl(const int32_t* labels, size_t numElements, size_t chunkSize, const std::vector<int32_t>& distinctLabels, std::vector<int32_t>& ranks)
+  : m_Labels(labels)
+  , m_NumElements(numElements)
+  , m_ChunkSize(chunkSize)
+  , m_DistinctLabels(distinctLabels)
+  , m_Ranks(ranks)
+  {
+  }
+
+  void convert(size_t chunkBegin, size_t chunkEnd) const
+  {
+    for(size_t chunk = chunkBegin; chunk < chunkEnd; chunk++)
+    {
+      size_t end = std::min((chunk + 1) * m_ChunkSize, m_NumElements);
+      for(size_t i = chunk * m_ChunkSize; i < end; i++)
+      {
+        m_Ranks[i] = static_cast<int32_t>(std::lower_bound(m_DistinctLabels.begin(), m_DistinctLabels.end(), m_Labels[i]) - m_DistinctLabels.begin());
+      }
+    }
+  }
+
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+  void operator()(const tbb::blocked_range<size_t>& r) const
+  {
+    convert(r.begin(), r.end());
+  }
+#endif
+
+private:
+  const int32_t* m_Labels;
+  size_t m_NumElements;
+  size_t m_ChunkSize;
+  const std::vector<int32_t>& m_DistinctLabels;
+  std::vector<int32_t>& m_Ranks;
+};
+
+/**
+ * @brief Counts the labels of each chunk into that chunk's row of the histogram
+ */
+class HistogramImpl
+{
+public:
+  HistogramImpl(const int32_t* labels, size_t numElements, size_t chunkSize, size_t numBins, std::vector<size_t>& histograms)
+  : m_Labels(labels)
+  , m_NumElements(numElements)
+  , m_ChunkSize(chunkSize)
+  , m_NumBins(numBins)
+  , m_Histograms(histograms)
+  {
+  }
+
+  void convert(size_t chunkBegin, size_t chunkEnd) const
+  {
+    for(size_t chunk = chunkBegin; chunk < chunkEnd; chunk++)
+    {
+      size_t* counts = m_Histograms.data() + chunk * m_NumBins;
+      size_t end = std::min((chunk + 1) * m_ChunkSize, m_NumElements);
+      for(size_t i = chunk * m_ChunkSize; i < end; i++)
+      {
+        counts[m_Labels[i]]++;
+      }
+    }
+  }
+
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+  void operator()(const tbb::blocked_range<size_t>& r) const
+  {
+    convert(r.begin(), r.end());
+  }
+#endif
+
+private:
+  const int32_t* m_Labels;
+  size_t m_NumElements;
+  size_t m_ChunkSize;
+  size_t m_NumBins;
+  std::vector<size_t>& m_Histograms;
+};
+
+/**
+ * @brief Scatters the element indices of each chunk to the positions reserved for that chunk
+ */
+class ScatterImpl
+{
+public:
+  ScatterImpl(const int32_t* labels, size_t numElements, size_t chunkSize, size_t numBins, std::vector<size_t>& positions, std::vector<size_t>& order)
+  : m_Labels(labels)
+  , m_NumElements(numElements)
+  , m_ChunkSize(chunkSize)
+  , m_NumBins(numBins)
+  , m_Positions(positions)
+  , m_Order(order)
+  {
+  }
+
+  void convert(size_t chunkBegin, size_t chunkEnd) const
+  {
+    for(size_t chunk = chunkBegin; chunk < chunkEnd; chunk++)
+    {
+      size_t* positions = m_Positions.data() + chunk * m_NumBins;
+      size_t end = std::min((chunk + 1) * m_ChunkSize, m_NumElements);
+      for(size_t i = chunk * m_ChunkSize; i < end; i++)
+      {
+        m_Order[positions[m_Labels[i]]++] = i;
+      }
+    }
+  }
+
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+  void operator()(const tbb::blocked_range<size_t>& r) const
+  {
+    convert(r.begin(), r.end());
+  }
+#endif
+
+private:
+  const int32_t* m_Labels;
+  size_t m_NumElements;
+  size_t m_ChunkSize;
+  size_t m_NumBins;
+  std::vector<size_t>& m_Positions;
+  std::vector<size_t>& m_Order;
+};
+} // namespace
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+LabelCountingSort::LabelCountingSort() = default;
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+LabelCountingSort::~LabelCountingSort() = default;
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool LabelCountingSort::execute(const int32_t* labels, size_t numElements)
+{
+  m_Labels.clear();
+  m_Offsets.assign(1, 0);
+  m_Order.clear();
+
+  if(numElements == 0)
+  {
+    return true;
+  }
+
+  size_t maxChunks = 1;
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+  maxChunks = std::max<size_t>(1, std::thread::hardware_concurrency());
+#endif
+  const size_t k_MinChunkSize = 65536;
+  size_t numChunks = std::max<size_t>(1, std::min(maxChunks, numElements / k_MinChunkSize));
+  size_t chunkSize = (numElements + numChunks - 1) / numChunks;
+
+  std::vector<int32_t> chunkMax(numChunks, -1);
+  {
+    FindMaxLabelImpl impl(labels, numElements, chunkSize, chunkMax);
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+    tbb::parallel_for(tbb::blocked_range<size_t>(0, numChunks, 1), impl, tbb::simple_partitioner());
+#else
+    impl.convert(0, numChunks);
+#endif
+  }
+
+  int32_t maxLabel = -1;
+  for(int32_t value : chunkMax)
+  {
+    if(value == -2)
+    {
+      return false;
+    }
+    maxLabel = std::max(maxLabel, value);
+  }
+
+  // Labels above the element count cannot all be used, so they are replaced by their rank
+  // among the distinct labels. The bins then never outnumber the elements.
+  size_t numBins = static_cast<size_t>(maxLabel) + 1;
+  std::vector<int32_t> distinctLabels;
+  std::vector<int32_t> ranks;
+  const int32_t* bins = labels;
+  if(numBins > numElements)
+  {
+    std::vector<std::vector<int32_t>> chunkLabels(numChunks);
+    {
+      UniqueLabelsImpl impl(labels, numElements, chunkSize, chunkLabels);
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+      tbb::parallel_for(tbb::blocked_range<size_t>(0, numChunks, 1), impl, tbb::simple_partitioner());
+#else
+      impl.convert(0, numChunks);
+#endif
+    }
+    for(std::vector<int32_t>& chunk : chunkLabels)
+    {
+      std::vector<int32_t> merged(distinctLabels.size() + chunk.size());
+      merged.erase(std::set_union(distinctLabels.begin(), distinctLabels.end(), chunk.begin(), chunk.end(), merged.begin()), merged.end());
+      distinctLabels.swap(merged);
+      std::vector<int32_t>().swap(chunk);
+    }
+
+    ranks.resize(numElements);
+    {
+      RankLabelsImpl impl(labels, numElements, chunkSize, distinctLabels, ranks);
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+      tbb::parallel_for(tbb::blocked_range<size_t>(0, numChunks, 1), impl, tbb::simple_partitioner());
+#else
+      impl.convert(0, numChunks);
+#endif
+    }
+    numBins = distinctLabels.size();
+    bins = ranks.data();
+  }
+
+  // Each chunk owns one histogram row, so the chunk count is kept near the thread count and
+  // low enough that the numChunks * numBins counters do not outgrow the element indices
+  numChunks = std::max<size_t>(1, std::min(numChunks, numElements / numBins));
+  chunkSize = (numElements + numChunks - 1) / numChunks;
+
+  std::vector<size_t> histograms(numChunks * numBins, 0);
+  {
+    HistogramImpl impl(bins, numElements, chunkSize, numBins, histograms);
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+    tbb::parallel_for(tbb::blocked_range<size_t>(0, numChunks, 1), impl, tbb::simple_partitioner());
+#else
+    impl.convert(0, numChunks);
+#endif
+  }
+
+  // Exclusive prefix sum over (label, chunk) turns the counts into the first output
+  // position of every chunk within every label, which keeps the sort stable. Bins without
+  // elements get no label.
+  m_Offsets.clear();
+  size_t position = 0;
+  for(size_t bin = 0; bin < numBins; bin++)
+  {
+    size_t start = position;
+    for(size_t chunk = 0; chunk < numChunks; chunk++)
+    {
+      size_t count = histograms[chunk * numBins + bin];
+      histograms[chunk * numBins + bin] = position;
+      position += count;
+    }
+    if(position > start)
+    {
+      m_Labels.push_back(distinctLabels.empty() ? static_cast<int32_t>(bin) : distinctLabels[bin]);
+      m_Offsets.push_back(start);
+    }
+  }
+  m_Offsets.push_back(position);
+
+  m_Order.resize(numElements);
+  {
+    ScatterImpl impl(bins, numElements, chunkSize, numBins, histograms, m_Order);
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+    tbb::parallel_for(tbb::blocked_range<size_t>(0, numChunks, 1), impl, tbb::simple_partitioner());
+#else
+    impl.convert(0, numChunks);
+#endif
+  }
+
+  return true;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+size_t LabelCountingSort::getNumberOfUsedLabels() const
+{
+  return m_Labels.size();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+const std::vector<int32_t>& LabelCountingSort::getLabels() const
+{
+  return m_Labels;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+const std::vector<size_t>& LabelCountingSort::getOffsets() const
+{
+  return m_Offsets;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+const std::vector<size_t>& LabelCountingSort::getOrder() const
+{
+  return m_Order;
+}
@@ -0,0 +1,98 @@
+/* ============================================================================
+* Copyright (c) 2018 BlueQuartz Software, LLC
+*
+* Redistribution and use in source and binary forms, with or without modification,
+* are permitted provided that the following conditions are met:
+*
+* Redistributions of source code must retain the above copyright notice, this
+* list of conditions and the following disclaimer.
+*
+* Redistributions in binary form must reproduce the above copyright notice, this
+* list of conditions and the following disclaimer in the documentation and/or
+* other materials provided with the distribution.
+*
+* Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+* contributors may be used to endorse or promote products derived from this software
+* without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+* DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+* FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+* DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+* OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+* USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*
+* ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+/**
+ * @brief The LabelCountingSort class groups element indices by an integer label, such as a
+ * FeatureIds array, with a histogram and a counting sort. Both passes are O(N) and run over
+ * independent chunks of the label array in parallel when SIMPL is built with TBB.
+ *
+ * The histogram has one bin per distinct label. Labels up to the element count are used as
+ * bins directly. Larger labels are first compacted to their rank among the distinct labels, so
+ * a stray large label costs a sort of the labels instead of a histogram of that size.
+ *
+ * After execute(), the indices of the elements with label getLabels()[l] are
+ * getOrder()[getOffsets()[l]] to getOrder()[getOffsets()[l + 1] - 1], in ascending order.
+ */
+class LabelCountingSort
+{
+public:
+  LabelCountingSort();
+  virtual ~LabelCountingSort();
+
+  /**
+   * @brief Sorts the element indices by label
+   * @param labels
+   * @param numElements
+   * @return false if a label is negative, in which case nothing is sorted
+   */
+  bool execute(const int32_t* labels, size_t numElements);
+
+  /**
+   * @brief Returns the number of distinct labels that have at least one element
+   * @return
+   */
+  size_t getNumberOfUsedLabels() const;
+
+  /**
+   * @brief Returns the distinct labels that have at least one element, in ascending order
+   * @return
+   */
+  const std::vector<int32_t>& getLabels() const;
+
+  /**
+   * @brief Returns the start of each label's range in getOrder(). Holds getLabels().size() + 1 values.
+   * @return
+   */
+  const std::vector<size_t>& getOffsets() const;
+
+  /**
+   * @brief Returns the element indices sorted by label
+   * @return
+   */
+  const std::vector<size_t>& getOrder() const;
+
+private:
+  std::vector<int32_t> m_Labels;
+  std::vector<size_t> m_Offsets;
+  std::vector<size_t> m_Order;
+
+public:
+  LabelCountingSort(const LabelCountingSort&) = delete;            // Copy Constructor Not Implemented
+  LabelCountingSort(LabelCountingSort&&) = delete;                 // Move Constructor Not Implemented
+  LabelCountingSort& operator=(const LabelCountingSort&) = delete; // Copy Assignment Not Implemented
+  LabelCountingSort& operator=(LabelCountingSort&&) = delete;      // Move Assignment Not Implemented
+};
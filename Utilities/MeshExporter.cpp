@@ -0,0 +1,662 @@
+/* ============================================================================
+* Copyright (c) 2018 BlueQuartz Software, LLC
+*
+* Redistribution and use in source and binary forms, with or without modification,
+* are permitted provided that the following conditions are met:
+*
+* Redistributions of source code must retain the above copyright notice, this
+* list of conditions and the following disclaimer.
+*
+* Redistributions in binary form must reproduce the above copyright notice, this
+* list of conditions and the following disclaimer in the documentation and/or
+* other materials provided with the distribution.
+*
+* Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+* contributors may be used to endorse or promote products derived from this software
+* without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+* DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+* FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+* DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+* OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+* USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*
+* ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#include "MeshExporter.h"
+
+#include <algorithm>
+
+#include <QtCore/QFileInfo>
+
+#include "SIMPLib/Geometry/EdgeGeom.h"
+#include "SIMPLib/Geometry/HexahedralGeom.h"
+#include "SIMPLib/Geometry/QuadGeom.h"
+#include "SIMPLib/Geometry/TetrahedralGeom.h"
+#include "SIMPLib/Geometry/TriangleGeom.h"
+#include "SIMPLib/Geometry/VertexGeom.h"
+
+#include "ImageSlabMesher.h"
+#include "LabelCountingSort.h"
+#include "MeshReorderer.h"
+
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_for.h>
+#endif
+
+namespace
+{
+// Tag that marks the parts read by MOAB's parallel reader. Its value is the part number.
+const char* const k_ParallelPartitionTagName = "PARALLEL_PARTITION";
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+template <typename T> double ComponentToDouble(const void* value)
+{
+  return static_cast<double>(*static_cast<const T*>(value));
+}
+
+/**
+ * @brief Copies values into the order of the renumbered elements, such as the labels of the
+ * cells or the cells of a list of renumbered elements
+ */
+template <typename T> class PermuteValuesImpl
+{
+public:
+  PermuteValuesImpl(const T* values, const std::vector<size_t>& order, std::vector<T>& permuted)
+  : m_Values(values)
+  , m_Order(order)
+  , m_Permuted(permuted)
+  {
+  }
+
+  void convert(size_t start, size_t end) const
+  {
+    for(size_t i = start; i < end; i++)
+    {
+      m_Permuted[i] = m_Values[m_Order[i]];
+    }
+  }
+
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+  void operator()(const tbb::blocked_range<size_t>& r) const
+  {
+    convert(r.begin(), r.end());
+  }
+#endif
+
+private:
+  const T* m_Values;
+  const std::vector<size_t>& m_Order;
+  std::vector<T>& m_Permuted;
+};
+
+/**
+ * @brief Copies the tuples of a list of region cells, such as the cells of a range of the
+ * renumbered elements, into a block buffer
+ */
+class GatherCellsImpl
+{
+public:
+  GatherCellsImpl(const ImageRegion& region, const void* source, size_t tupleBytes, const size_t* cells, uint8_t* buffer)
+  : m_Region(region)
+  , m_Source(source)
+  , m_TupleBytes(tupleBytes)
+  , m_Cells(cells)
+  , m_Buffer(buffer)
+  {
+  }
+
+  void convert(size_t start, size_t end) const
+  {
+    m_Region.copyCells(m_Source, m_TupleBytes, m_Cells + start, end - start, m_Buffer + start * m_TupleBytes);
+  }
+
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+  void operator()(const tbb::blocked_range<size_t>& r) const
+  {
+    convert(r.begin(), r.end());
+  }
+#endif
+
+private:
+  const ImageRegion& m_Region;
+  const void* m_Source;
+  size_t m_TupleBytes;
+  const size_t* m_Cells;
+  uint8_t* m_Buffer;
+};
+} // namespace
+
+const char* const MeshExporter::MaterialSetTagName = "MATERIAL_SET";
+const size_t MeshExporter::WriteQueueDepth = 2;
+const size_t MeshExporter::DefaultBlockBytes = 64 * 1024 * 1024;
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+ExportProgress::ExportProgress(const AbstractFilter* filter, double totalBytes)
+: m_Filter(filter)
+, m_TotalBytes(std::max(totalBytes, 1.0))
+{
+  m_Timer.start();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool ExportProgress::advance(const QString& stage, double bytes)
+{
+  m_DoneBytes += bytes;
+  int percent = static_cast<int>(std::min(100.0 * m_DoneBytes / m_TotalBytes, 100.0));
+  if(percent > m_Percent)
+  {
+    m_Percent = percent;
+    double seconds = static_cast<double>(m_Timer.elapsed()) / 1000.0;
+    QString ss = QObject::tr("%1: %2% (%3/s)").arg(stage).arg(percent).arg(MeshExporter::FormatBytes(seconds > 0.0 ? m_DoneBytes / seconds : 0.0));
+    m_Filter->notifyProgressMessage(percent, ss);
+  }
+  return m_DoneBytes >= m_TotalBytes || !m_Filter->getCancel();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+MeshExporter::MeshExporter(AbstractFilter* filter, const MeshExportSettings& settings)
+: m_Filter(filter)
+, m_Settings(settings)
+{
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+MeshExporter::~MeshExporter() = default;
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool MeshExporter::getStoppedEarly() const
+{
+  return m_StoppedEarly;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool MeshExporter::IsExodusFile(const QString& filePath)
+{
+  QString suffix = QFileInfo(filePath).completeSuffix();
+  return suffix == "exo" || suffix == "e";
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool MeshExporter::GetExportTypeInfo(const QString& typeName, ExportTypeInfo& info)
+{
+  if(typeName == SIMPL::TypeNames::Int8)
+  {
+    info = {H5T_NATIVE_INT8, "Int8", sizeof(int8_t), moab::MB_TYPE_OPAQUE, &ComponentToDouble<int8_t>};
+  }
+  else if(typeName == SIMPL::TypeNames::UInt8)
+  {
+    info = {H5T_NATIVE_UINT8, "UInt8", sizeof(uint8_t), moab::MB_TYPE_OPAQUE, &ComponentToDouble<uint8_t>};
+  }
+  else if(typeName == SIMPL::TypeNames::Int16)
+  {
+    info = {H5T_NATIVE_INT16, "Int16", sizeof(int16_t), moab::MB_TYPE_OPAQUE, &ComponentToDouble<int16_t>};
+  }
+  else if(typeName == SIMPL::TypeNames::UInt16)
+  {
+    info = {H5T_NATIVE_UINT16, "UInt16", sizeof(uint16_t), moab::MB_TYPE_OPAQUE, &ComponentToDouble<uint16_t>};
+  }
+  else if(typeName == SIMPL::TypeNames::Int32)
+  {
+    info = {H5T_NATIVE_INT32, "Int32", sizeof(int32_t), moab::MB_TYPE_INTEGER, &ComponentToDouble<int32_t>};
+  }
+  else if(typeName == SIMPL::TypeNames::UInt32)
+  {
+    info = {H5T_NATIVE_UINT32, "UInt32", sizeof(uint32_t), moab::MB_TYPE_OPAQUE, &ComponentToDouble<uint32_t>};
+  }
+  else if(typeName == SIMPL::TypeNames::Int64)
+  {
+    info = {H5T_NATIVE_INT64, "Int64", sizeof(int64_t), moab::MB_TYPE_OPAQUE, &ComponentToDouble<int64_t>};
+  }
+  else if(typeName == SIMPL::TypeNames::UInt64)
+  {
+    info = {H5T_NATIVE_UINT64, "UInt64", sizeof(uint64_t), moab::MB_TYPE_OPAQUE, &ComponentToDouble<uint64_t>};
+  }
+  else if(typeName == SIMPL::TypeNames::Float)
+  {
+    info = {H5T_NATIVE_FLOAT, "Float32", sizeof(float), moab::MB_TYPE_OPAQUE, &ComponentToDouble<float>};
+  }
+  else if(typeName == SIMPL::TypeNames::Double)
+  {
+    info = {H5T_NATIVE_DOUBLE, "Float64", sizeof(double), moab::MB_TYPE_DOUBLE, &ComponentToDouble<double>};
+  }
+  else
+  {
+    return false;
+  }
+  return true;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool MeshExporter::GetGeometryElements(const IGeometry::Pointer& geom, GeometryElements& elements)
+{
+  if(VertexGeom::Pointer vertexGeom = std::dynamic_pointer_cast<VertexGeom>(geom))
+  {
+    elements = {vertexGeom->getVertices(), Int64ArrayType::NullPointer(), MoabH5mWriter::EntityType::Vertex, 1, AttributeMatrix::Type::Vertex};
+  }
+  else if(EdgeGeom::Pointer edgeGeom = std::dynamic_pointer_cast<EdgeGeom>(geom))
+  {
+    elements = {edgeGeom->getVertices(), edgeGeom->getEdges(), MoabH5mWriter::EntityType::Edge, 2, AttributeMatrix::Type::Edge};
+  }
+  else if(TriangleGeom::Pointer triangleGeom = std::dynamic_pointer_cast<TriangleGeom>(geom))
+  {
+    elements = {triangleGeom->getVertices(), triangleGeom->getTriangles(), MoabH5mWriter::EntityType::Tri, 3, AttributeMatrix::Type::Face};
+  }
+  else if(QuadGeom::Pointer quadGeom = std::dynamic_pointer_cast<QuadGeom>(geom))
+  {
+    elements = {quadGeom->getVertices(), quadGeom->getQuads(), MoabH5mWriter::EntityType::Quad, 4, AttributeMatrix::Type::Face};
+  }
+  else if(TetrahedralGeom::Pointer tetGeom = std::dynamic_pointer_cast<TetrahedralGeom>(geom))
+  {
+    elements = {tetGeom->getVertices(), tetGeom->getTetrahedra(), MoabH5mWriter::EntityType::Tet, 4, AttributeMatrix::Type::Cell};
+  }
+  else if(HexahedralGeom::Pointer hexGeom = std::dynamic_pointer_cast<HexahedralGeom>(geom))
+  {
+    elements = {hexGeom->getVertices(), hexGeom->getHexahedra(), MoabH5mWriter::EntityType::Hex, 8, AttributeMatrix::Type::Cell};
+  }
+  else
+  {
+    return false;
+  }
+  return true;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QString MeshExporter::FormatBytes(double bytes)
+{
+  const char* const units[] = {"B", "KB", "MB", "GB", "TB"};
+  int unit = 0;
+  while(bytes >= 1024.0 && unit < 4)
+  {
+    bytes /= 1024.0;
+    unit++;
+  }
+  return QString("%1 %2").arg(bytes, 0, 'f', unit == 0 ? 0 : 1).arg(units[unit]);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+ImageRegion MeshExporter::GetRegion(const MeshExportSettings& settings, const ImageGeom::Pointer& image, size_t dims[3], float res[3], float origin[3])
+{
+  size_t imageDims[3] = {0, 0, 0};
+  float imageOrigin[3] = {0.0f, 0.0f, 0.0f};
+  std::tie(imageDims[0], imageDims[1], imageDims[2]) = image->getDimensions();
+  image->getResolution(res);
+  image->getOrigin(imageOrigin);
+
+  ImageRegion region(imageDims);
+  if(settings.cropToRegion)
+  {
+    size_t minIndex[3] = {static_cast<size_t>(settings.xMin), static_cast<size_t>(settings.yMin), static_cast<size_t>(settings.zMin)};
+    size_t maxIndex[3] = {static_cast<size_t>(settings.xMax), static_cast<size_t>(settings.yMax), static_cast<size_t>(settings.zMax)};
+    region = ImageRegion(imageDims, minIndex, maxIndex);
+  }
+
+  region.getDimensions(dims);
+  region.getOrigin(imageOrigin, res, origin);
+  return region;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QString MeshExporter::GetBatchOutputFile(const MeshExportSettings& settings, const QString& dataContainerName)
+{
+  QFileInfo fi(settings.outputFile);
+  return fi.path() + "/" + fi.baseName() + "_" + dataContainerName + "." + fi.completeSuffix();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QStringList MeshExporter::GetOutputFiles(const MeshExportSettings& settings)
+{
+  if(!settings.filePerStep)
+  {
+    return QStringList({settings.outputFile});
+  }
+
+  QStringList outputFiles;
+  for(const QString& dataContainerName : settings.batchDataContainerNames)
+  {
+    outputFiles.push_back(GetBatchOutputFile(settings, dataContainerName));
+  }
+  return outputFiles;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void MeshExporter::setErrorCondition(int code, const QString& message)
+{
+  m_Filter->setErrorCondition(code, message);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void MeshExporter::setWarningCondition(int code, const QString& message)
+{
+  m_Filter->setWarningCondition(code, message);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int MeshExporter::getErrorCondition() const
+{
+  return m_Filter->getErrorCondition();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool MeshExporter::getCancel() const
+{
+  return m_Filter->getCancel();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void MeshExporter::notifyStatusMessage(const QString& message)
+{
+  m_Filter->notifyStatusMessage(message);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+ImageRegion MeshExporter::getRegion(const ImageGeom::Pointer& image, size_t dims[3], float res[3], float origin[3]) const
+{
+  return GetRegion(m_Settings, image, dims, res, origin);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QStringList MeshExporter::getOutputFiles() const
+{
+  return GetOutputFiles(m_Settings);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void MeshExporter::applyCompression(MoabH5mWriter& writer) const
+{
+  if(m_Settings.compressOutput)
+  {
+    writer.setCompression(static_cast<size_t>(m_Settings.chunkSize), m_Settings.shuffle, m_Settings.deflateLevel, m_Settings.hdf5FilterId);
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+size_t MeshExporter::getSlabLayers(const ImageSlabMesher& mesher, bool streaming, size_t blockSteps)
+{
+  if(!streaming)
+  {
+    return std::max<size_t>(mesher.getLayersPerSlab(DefaultBlockBytes), 1);
+  }
+
+  // The budget is shared by the buffers of every block in flight through the writer thread. A
+  // block that gathers the slab of every batch step gets its share of a buffer per step.
+  size_t numBuffers = WriteQueueDepth + 1;
+  size_t budgetBytes = static_cast<size_t>(m_Settings.memoryBudget) * 1024 * 1024;
+  size_t layers = mesher.getLayersPerSlab(budgetBytes / (numBuffers * std::max<size_t>(blockSteps, 1)));
+  if(layers == 0)
+  {
+    double layerBytes = mesher.getNodeBufferSize(1) * sizeof(double) + mesher.getConnectivityBufferSize(1) * sizeof(int64_t);
+    QString ss = QObject::tr("The memory budget of %1 MB cannot hold %2 slab buffers of a single Z layer of the mesh for each of %3 steps, which need %4 MB.")
+                     .arg(m_Settings.memoryBudget)
+                     .arg(numBuffers)
+                     .arg(std::max<size_t>(blockSteps, 1))
+                     .arg(numBuffers * std::max<size_t>(blockSteps, 1) * layerBytes / (1024.0 * 1024.0), 0, 'f', 2);
+    setErrorCondition(-101013, ss);
+  }
+  return layers;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+const int32_t* MeshExporter::gatherFeatureIds(const ImageRegion& region, std::vector<int32_t>& buffer) const
+{
+  size_t dims[3] = {0, 0, 0};
+  region.getDimensions(dims);
+  Int32ArrayType::Pointer featureIds = m_Settings.featureIdsPtr.lock();
+  buffer.resize(region.isLayerContiguous() ? 0 : region.getNumberOfCells());
+  return static_cast<const int32_t*>(region.gatherLayers(featureIds->getVoidPointer(0), sizeof(int32_t), 0, dims[2], buffer.data()));
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool MeshExporter::sortFeatureIds(LabelCountingSort& sorter, const int32_t* featureIds, size_t count)
+{
+  if(!sorter.execute(featureIds, count))
+  {
+    QString ss = QObject::tr("The Feature Ids array '%1' holds negative values, which cannot be written as meshsets.").arg(m_Settings.featureIdsArrayPath.getDataArrayName());
+    setErrorCondition(-101020, ss);
+    return false;
+  }
+  return true;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool MeshExporter::sortPartitions(LabelCountingSort& sorter, const std::vector<int32_t>& parts, bool partitioned)
+{
+  if(!partitioned)
+  {
+    QString ss = QObject::tr("The Feature Ids array '%1' holds negative values, which cannot be assigned to partitions.").arg(m_Settings.featureIdsArrayPath.getDataArrayName());
+    setErrorCondition(-101020, ss);
+    return false;
+  }
+
+  sorter.execute(parts.data(), parts.size());
+  if(sorter.getNumberOfUsedLabels() < static_cast<size_t>(m_Settings.partitionCount))
+  {
+    QString ss = QObject::tr("Only %1 of the %2 partitions hold elements. Use fewer partitions or a strategy that can split the Features.").arg(sorter.getNumberOfUsedLabels()).arg(m_Settings.partitionCount);
+    setWarningCondition(-101035, ss);
+  }
+  return true;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void MeshExporter::orderMesh(MeshReorderer& reorderer, const size_t dims[3])
+{
+  if(reorderer.isNatural())
+  {
+    return;
+  }
+  notifyStatusMessage(QObject::tr("Renumbering %1 elements and their nodes").arg(dims[0] * dims[1] * dims[2]));
+  reorderer.executeGrid(dims);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int MeshExporter::writeElementSets(MoabH5mWriter& writer, const std::vector<std::pair<const char*, const LabelCountingSort*>>& groups, int64_t firstElementId)
+{
+  // Every set stores its elements as (start id, count) pairs of consecutive elements. The runs
+  // are counted first because the contents dataset is created with its final size.
+  std::vector<std::vector<size_t>> numRuns(groups.size());
+  std::vector<size_t> numGroupSets(groups.size(), 0);
+  size_t numSets = 0;
+  size_t contentsLength = 0;
+  for(size_t g = 0; g < groups.size(); g++)
+  {
+    const std::vector<size_t>& offsets = groups[g].second->getOffsets();
+    const std::vector<size_t>& order = groups[g].second->getOrder();
+    size_t numLabels = offsets.size() - 1;
+    numRuns[g].assign(numLabels, 0);
+    for(size_t label = 0; label < numLabels; label++)
+    {
+      for(size_t i = offsets[label]; i < offsets[label + 1]; i++)
+      {
+        if(i == offsets[label] || order[i] != order[i - 1] + 1)
+        {
+          numRuns[g][label]++;
+        }
+      }
+      if(numRuns[g][label] > 0)
+      {
+        numGroupSets[g]++;
+        contentsLength += 2 * numRuns[g][label];
+      }
+    }
+    numSets += numGroupSets[g];
+  }
+
+  int err = writer.createSets(numSets, contentsLength);
+  for(size_t g = 0; g < groups.size() && err >= 0; g++)
+  {
+    err = writer.createSparseTag(groups[g].first, H5T_NATIVE_INT32, 1, numGroupSets[g]);
+  }
+
+  // The set descriptions and tag values are small and written at once. The contents are
+  // flushed in blocks so they never need a buffer the size of the mesh.
+  const size_t k_ContentsBlockSize = 1048576;
+  std::vector<int64_t> setList;
+  std::vector<int64_t> setIds;
+  std::vector<int32_t> labels;
+  std::vector<int64_t> contents;
+  setList.reserve(4 * numSets);
+  size_t contentsOffset = 0;
+  for(size_t g = 0; g < groups.size() && err >= 0; g++)
+  {
+    const std::vector<int32_t>& groupLabels = groups[g].second->getLabels();
+    const std::vector<size_t>& offsets = groups[g].second->getOffsets();
+    const std::vector<size_t>& order = groups[g].second->getOrder();
+    setIds.clear();
+    labels.clear();
+    setIds.reserve(numGroupSets[g]);
+    labels.reserve(numGroupSets[g]);
+    for(size_t label = 0; label < numRuns[g].size() && err >= 0; label++)
+    {
+      if(numRuns[g][label] == 0)
+      {
+        continue;
+      }
+
+      for(size_t i = offsets[label]; i < offsets[label + 1]; i++)
+      {
+        if(i == offsets[label] || order[i] != order[i - 1] + 1)
+        {
+          contents.push_back(firstElementId + static_cast<int64_t>(order[i]));
+          contents.push_back(0);
+        }
+        contents.back()++;
+      }
+
+      int64_t contentsEnd = static_cast<int64_t>(contentsOffset + contents.size()) - 1;
+      setIds.push_back(writer.getSetStartId() + static_cast<int64_t>(setList.size() / 4));
+      setList.insert(setList.end(), {contentsEnd, -1, -1, MoabH5mWriter::SetUnique | MoabH5mWriter::SetRange});
+      labels.push_back(groupLabels[label]);
+
+      if(contents.size() >= k_ContentsBlockSize)
+      {
+        err = writer.writeSetContents(contentsOffset, contents.size(), contents.data());
+        contentsOffset += contents.size();
+        contents.clear();
+      }
+    }
+
+    if(err >= 0)
+    {
+      err = writer.writeSparseTagData(groups[g].first, 0, numGroupSets[g], setIds.data(), labels.data());
+    }
+  }
+
+  if(err >= 0)
+  {
+    err = writer.writeSetContents(contentsOffset, contents.size(), contents.data());
+  }
+  if(err >= 0)
+  {
+    err = writer.writeSetList(0, numSets, setList.data());
+  }
+
+  return err;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+std::vector<std::pair<const char*, const LabelCountingSort*>> MeshExporter::getSetGroups(const LabelCountingSort& featureSorter, const LabelCountingSort& partSorter) const
+{
+  std::vector<std::pair<const char*, const LabelCountingSort*>> groups;
+  if(m_Settings.writeFeatureSets)
+  {
+    groups.emplace_back(MaterialSetTagName, &featureSorter);
+  }
+  if(m_Settings.writePartitionSets)
+  {
+    groups.emplace_back(k_ParallelPartitionTagName, &partSorter);
+  }
+  return groups;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+template <typename T> void MeshExporter::PermuteValues(const T* values, const std::vector<size_t>& order, std::vector<T>& permuted)
+{
+  permuted.resize(order.size());
+  PermuteValuesImpl<T> impl(values, order, permuted);
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+  tbb::parallel_for(tbb::blocked_range<size_t>(0, order.size()), impl);
+#else
+  impl.convert(0, order.size());
+#endif
+}
+
+template void MeshExporter::PermuteValues<int32_t>(const int32_t* values, const std::vector<size_t>& order, std::vector<int32_t>& permuted);
+template void MeshExporter::PermuteValues<size_t>(const size_t* values, const std::vector<size_t>& order, std::vector<size_t>& permuted);
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+const void* MeshExporter::GatherCells(const ImageRegion& region, const void* source, size_t tupleBytes, const size_t* cells, size_t count, void* buffer)
+{
+  GatherCellsImpl impl(region, source, tupleBytes, cells, static_cast<uint8_t*>(buffer));
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+  tbb::parallel_for(tbb::blocked_range<size_t>(0, count), impl);
+#else
+  impl.convert(0, count);
+#endif
+  return buffer;
+}
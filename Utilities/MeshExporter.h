@@ -0,0 +1,423 @@
+/* ============================================================================
+* Copyright (c) 2018 BlueQuartz Software, LLC
+*
+* Redistribution and use in source and binary forms, with or without modification,
+* are permitted provided that the following conditions are met:
+*
+* Redistributions of source code must retain the above copyright notice, this
+* list of conditions and the following disclaimer.
+*
+* Redistributions in binary form must reproduce the above copyright notice, this
+* list of conditions and the following disclaimer in the documentation and/or
+* other materials provided with the distribution.
+*
+* Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+* contributors may be used to endorse or promote products derived from this software
+* without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+* DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+* FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+* DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+* OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+* USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*
+* ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <QtCore/QElapsedTimer>
+#include <QtCore/QString>
+#include <QtCore/QStringList>
+#include <QtCore/QVector>
+
+#include <hdf5.h>
+
+#include "SIMPLib/DataArrays/DataArray.hpp"
+#include "SIMPLib/DataContainers/AttributeMatrix.h"
+#include "SIMPLib/DataContainers/DataArrayPath.h"
+#include "SIMPLib/Filtering/AbstractFilter.h"
+#include "SIMPLib/Geometry/IGeometry.h"
+#include "SIMPLib/Geometry/ImageGeom.h"
+
+#include "moab/Types.hpp"
+
+#include "ImageRegion.h"
+#include "MoabH5mWriter.h"
+
+class ImageSlabMesher;
+class LabelCountingSort;
+class MeshReorderer;
+
+/**
+ * @brief The settings of an ExportMoabMesh filter that the mesh exporters write with,
+ * together with the arrays the filter found during its data check
+ */
+struct MeshExportSettings
+{
+  QString outputFile;                                            //!< Output file, or the file the per step files are named after
+  QVector<DataArrayPath> selectedArrayPaths;                     //!< Arrays written as tags or variables
+  QVector<IDataArray::WeakPointer> selectedWeakPtrVector;        //!< Selected arrays of the first Data Container
+  QVector<QVector<IDataArray::WeakPointer>> batchWeakPtrVectors; //!< Selected arrays of each batch step
+  QStringList batchDataContainerNames;                           //!< Data Container of each batch step
+  bool exportBatch = false;                                      //!< Write the selected arrays of every batch step
+  bool filePerStep = false;                                      //!< Write each batch step to its own file
+  int batchThreadLimit = 0;                                      //!< Number of threads that gather the steps of a batch, or 0 for all
+  bool reuseUnchangedMesh = false;                               //!< Only rewrite the tags of output files that hold the same mesh
+  DataArrayPath featureIdsArrayPath;                             //!< Path of the Feature Ids array
+  std::weak_ptr<Int32ArrayType> featureIdsPtr;                   //!< Feature Ids of every cell
+  bool writeFeatureSets = false;                                 //!< Write one MATERIAL_SET meshset per Feature
+  bool writePartitionSets = false;                               //!< Write one PARALLEL_PARTITION meshset per part
+  int partitionCount = 4;                                        //!< Number of parts
+  int partitionStrategy = 1;                                     //!< MeshPartitioner::Strategy of the parts
+  int meshOrdering = 0;                                          //!< MeshReorderer::Ordering of the elements and nodes
+  int memoryBudget = 1024;                                       //!< Memory budget of the streaming mode in MB
+  bool compressOutput = false;                                   //!< Chunk and filter the datasets of native h5m files
+  int chunkSize = 65536;                                         //!< Number of rows per chunk
+  bool shuffle = true;                                           //!< Apply the shuffle filter before compression
+  int deflateLevel = 4;                                          //!< Deflate level, or 0 for none
+  int hdf5FilterId = 0;                                          //!< Registered HDF5 filter applied instead of deflate, or 0 for none
+  bool cropToRegion = false;                                     //!< Export only the region of interest
+  int xMin = 0;                                                  //!< First cell of the region along X
+  int yMin = 0;                                                  //!< First cell of the region along Y
+  int zMin = 0;                                                  //!< First cell of the region along Z
+  int xMax = 0;                                                  //!< Last cell of the region along X
+  int yMax = 0;                                                  //!< Last cell of the region along Y
+  int zMax = 0;                                                  //!< Last cell of the region along Z
+  int maxOctreeLevel = 4;                                        //!< Largest octree level of the coarsened elements
+  bool writeHangingNodes = true;                                 //!< Tag the hanging nodes of an octree mesh with the nodes that constrain them
+};
+
+/**
+ * @brief Reports how far the loops of an export got and how fast they write, and tells them
+ * when the user cancelled. A message is sent each time another percent of the bytes is done,
+ * so even the largest exports send at most one hundred. A cancel that comes after the last
+ * chunk is ignored, so a loop that stops has always left chunks unwritten.
+ */
+class ExportProgress
+{
+public:
+  ExportProgress(const AbstractFilter* filter, double totalBytes);
+
+  /**
+   * @brief Counts the bytes of one more chunk
+   * @param stage What the loop is writing, such as "Writing nodes"
+   * @param bytes
+   * @return false once the user cancelled the export with chunks left to write
+   */
+  bool advance(const QString& stage, double bytes);
+
+private:
+  const AbstractFilter* m_Filter = nullptr;
+  double m_TotalBytes = 1.0;
+  double m_DoneBytes = 0.0;
+  int m_Percent = -1;
+  QElapsedTimer m_Timer;
+};
+
+/**
+ * @brief Describes the shared lists of a geometry with an explicit element list and how its
+ * elements are written
+ */
+struct GeometryElements
+{
+  SharedVertexList::Pointer vertices;                                 //!< Vertex coordinates
+  Int64ArrayType::Pointer elements;                                   //!< Vertex indices of each element, or null when the vertices are the elements
+  MoabH5mWriter::EntityType type = MoabH5mWriter::EntityType::Vertex; //!< MOAB entity type of the elements
+  int nodesPerElement = 1;                                            //!< Number of vertices of each element
+  AttributeMatrix::Type matrixType = AttributeMatrix::Type::Vertex;   //!< Attribute Matrix type that holds one tuple per element
+};
+
+/**
+ * @brief Describes how the values of one SIMPL array type are stored in the output formats
+ */
+struct ExportTypeInfo
+{
+  hid_t hdf5Type = -1;                            //!< Native HDF5 type of one component
+  const char* vtkType = nullptr;                  //!< VTK XML type name of one component
+  size_t size = 0;                                //!< Size of one component in bytes
+  moab::DataType moabType = moab::MB_TYPE_OPAQUE; //!< MOAB only has native int and double tag types
+  double (*toDouble)(const void*) = nullptr;      //!< Reads one component as a double for Exodus variables
+};
+
+/**
+ * @brief Describes one dense tag of a native h5m export and where its values come from
+ */
+struct ExportTag
+{
+  size_t file = 0;           //!< Index of the output file the tag goes to
+  std::string name;          //!< Name of the tag in the file
+  IDataArray::Pointer array; //!< Array that holds the tag values of every cell
+  hid_t hdf5Type = -1;       //!< Native HDF5 type of one component
+  int numComponents = 0;     //!< Number of components of the array
+  size_t tupleBytes = 0;     //!< Size of one tuple of the array in bytes
+};
+
+/**
+ * @brief The MeshExporter class is the base of the classes that write the mesh of one export
+ * mode of the ExportMoabMesh filter. Each subclass writes its files from the settings it is
+ * constructed with, and reports errors, warnings, progress and cancellation through the filter,
+ * so the filter itself only checks its parameters and picks the exporter for the mode and
+ * output format.
+ *
+ * This class holds what the exporters share: the region of interest, the Feature and partition
+ * meshsets of the native h5m files, the mesh orderings and the block sizes of the writer thread.
+ */
+class MeshExporter
+{
+public:
+  /**
+   * @brief Tag that marks material sets in MOAB's tag conventions. Its value is the Feature Id.
+   */
+  static const char* const MaterialSetTagName;
+
+  /**
+   * @brief Number of mesh blocks that may wait for or be in the writer thread while the next
+   * block is generated. Together with the block being generated this is the number of block
+   * buffers.
+   */
+  static const size_t WriteQueueDepth;
+
+  /**
+   * @brief Size of the mesh blocks handed to the writer thread when no memory budget applies
+   */
+  static const size_t DefaultBlockBytes;
+
+  /**
+   * @brief Constructs an exporter that writes with the given settings
+   * @param filter Filter that receives the errors, warnings and progress messages and whose
+   * cancel flag stops the export
+   * @param settings
+   */
+  MeshExporter(AbstractFilter* filter, const MeshExportSettings& settings);
+  virtual ~MeshExporter();
+
+  /**
+   * @brief Returns whether the export was cancelled after it changed the output files, which
+   * are then left incomplete
+   * @return
+   */
+  bool getStoppedEarly() const;
+
+  /**
+   * @brief Returns whether a file is written in the Exodus II format
+   * @param filePath
+   * @return
+   */
+  static bool IsExodusFile(const QString& filePath);
+
+  /**
+   * @brief Returns how the values of a SIMPL array type are stored, or false for a type that
+   * cannot be exported
+   * @param typeName
+   * @param info
+   * @return
+   */
+  static bool GetExportTypeInfo(const QString& typeName, ExportTypeInfo& info);
+
+  /**
+   * @brief Returns the shared lists of a geometry with an explicit element list, or false for
+   * the other geometries
+   * @param geom
+   * @param elements
+   * @return
+   */
+  static bool GetGeometryElements(const IGeometry::Pointer& geom, GeometryElements& elements);
+
+  /**
+   * @brief Formats a number of bytes with a binary unit, such as "1.5 GB"
+   * @param bytes
+   * @return
+   */
+  static QString FormatBytes(double bytes);
+
+  /**
+   * @brief Returns the part of the ImageGeom that is exported, which is the region of
+   * interest when cropping and the whole geometry otherwise
+   * @param settings
+   * @param image
+   * @param dims Number of cells of the region along X, Y and Z
+   * @param res Cell spacing
+   * @param origin Position of the first node of the region
+   * @return
+   */
+  static ImageRegion GetRegion(const MeshExportSettings& settings, const ImageGeom::Pointer& image, size_t dims[3], float res[3], float origin[3]);
+
+  /**
+   * @brief Returns the file that one step of a batch is written to when each step has its own
+   * file: the output file with the Data Container name appended to its base name
+   * @param settings
+   * @param dataContainerName
+   * @return
+   */
+  static QString GetBatchOutputFile(const MeshExportSettings& settings, const QString& dataContainerName);
+
+  /**
+   * @brief Returns every file the export writes: the output file, or one file per step when a
+   * batch is written with one file per step
+   * @param settings
+   * @return
+   */
+  static QStringList GetOutputFiles(const MeshExportSettings& settings);
+
+protected:
+  /**
+   * @brief Sets an error on the filter
+   * @param code
+   * @param message
+   */
+  void setErrorCondition(int code, const QString& message);
+
+  /**
+   * @brief Sets a warning on the filter
+   * @param code
+   * @param message
+   */
+  void setWarningCondition(int code, const QString& message);
+
+  /**
+   * @brief Returns the error condition of the filter
+   * @return
+   */
+  int getErrorCondition() const;
+
+  /**
+   * @brief Returns whether the user cancelled the filter
+   * @return
+   */
+  bool getCancel() const;
+
+  /**
+   * @brief Sends a status message through the filter
+   * @param message
+   */
+  void notifyStatusMessage(const QString& message);
+
+  /**
+   * @brief Returns the exported part of the ImageGeom, see GetRegion()
+   */
+  ImageRegion getRegion(const ImageGeom::Pointer& image, size_t dims[3], float res[3], float origin[3]) const;
+
+  /**
+   * @brief Returns every file the export writes, see GetOutputFiles()
+   */
+  QStringList getOutputFiles() const;
+
+  /**
+   * @brief applyCompression Passes the chunking and filter settings to a native h5m writer
+   * @param writer
+   */
+  void applyCompression(MoabH5mWriter& writer) const;
+
+  /**
+   * @brief getSlabLayers Returns the number of Z layers per block handed to the writer thread.
+   * When streaming, the buffers of every block in flight must fit the memory budget, and 0 is
+   * returned after setting an error if not even one layer fits.
+   * @param mesher
+   * @param streaming
+   * @param blockSteps Number of batch steps whose slabs share one block buffer
+   * @return
+   */
+  size_t getSlabLayers(const ImageSlabMesher& mesher, bool streaming, size_t blockSteps);
+
+  /**
+   * @brief gatherFeatureIds Returns the Feature Ids of the cells of the region. The pointer
+   * refers to the Feature Ids array when the region is layer contiguous and to buffer otherwise.
+   * @param region
+   * @param buffer
+   * @return
+   */
+  const int32_t* gatherFeatureIds(const ImageRegion& region, std::vector<int32_t>& buffer) const;
+
+  /**
+   * @brief sortFeatureIds Groups the element indices by Feature Id, or sets an error and
+   * returns false if a Feature Id is negative
+   * @param sorter
+   * @param featureIds One Feature Id per element
+   * @param count Number of elements
+   * @return
+   */
+  bool sortFeatureIds(LabelCountingSort& sorter, const int32_t* featureIds, size_t count);
+
+  /**
+   * @brief sortPartitions Groups the element indices by part, or sets an error and returns
+   * false if the partitioner rejected the Feature Ids. Warns when some parts are empty.
+   * @param sorter
+   * @param parts Part of each element
+   * @param partitioned Return value of the partitioner
+   * @return
+   */
+  bool sortPartitions(LabelCountingSort& sorter, const std::vector<int32_t>& parts, bool partitioned);
+
+  /**
+   * @brief orderMesh Renumbers the elements and nodes of the mesh of a grid with the selected
+   * mesh ordering. Nothing is computed for the natural ordering.
+   * @param reorderer
+   * @param dims Number of cells along X, Y and Z
+   */
+  void orderMesh(MeshReorderer& reorderer, const size_t dims[3]);
+
+  /**
+   * @brief writeElementSets Writes one meshset per label that owns at least one element, for
+   * each group of sets. Each set stores its elements as runs of consecutive element ids and is
+   * tagged with its label through the tag of its group, such as MATERIAL_SET for Features and
+   * PARALLEL_PARTITION for parts.
+   * @param writer Open writer whose element groups are all created
+   * @param groups Tag name and element indices grouped by label of each group of sets
+   * @param firstElementId File id of element 0
+   * @return Negative value on error
+   */
+  int writeElementSets(MoabH5mWriter& writer, const std::vector<std::pair<const char*, const LabelCountingSort*>>& groups, int64_t firstElementId);
+
+  /**
+   * @brief getSetGroups Returns the groups of sets to write: the Feature sets and the partition
+   * sets, as far as they are enabled
+   * @param featureSorter Element indices grouped by Feature Id
+   * @param partSorter Element indices grouped by part
+   * @return
+   */
+  std::vector<std::pair<const char*, const LabelCountingSort*>> getSetGroups(const LabelCountingSort& featureSorter, const LabelCountingSort& partSorter) const;
+
+  /**
+   * @brief Copies values into the order of the renumbered elements, such as the labels of the
+   * cells or the cells of a list of renumbered elements. Defined for int32_t and size_t.
+   * @param values
+   * @param order Index into values of each permuted value
+   * @param permuted
+   */
+  template <typename T> static void PermuteValues(const T* values, const std::vector<size_t>& order, std::vector<T>& permuted);
+
+  /**
+   * @brief Copies the tuples of a list of region cells, such as the cells of a range of the
+   * renumbered elements, into a block buffer
+   * @param region
+   * @param source First tuple of the array
+   * @param tupleBytes
+   * @param cells Region cells to copy
+   * @param count Number of cells
+   * @param buffer
+   * @return buffer
+   */
+  static const void* GatherCells(const ImageRegion& region, const void* source, size_t tupleBytes, const size_t* cells, size_t count, void* buffer);
+
+  AbstractFilter* m_Filter = nullptr;
+  MeshExportSettings m_Settings;
+  bool m_StoppedEarly = false; //!< Set by a writer that was cancelled after it changed the output files
+
+public:
+  MeshExporter(const MeshExporter&) = delete;            // Copy Constructor Not Implemented
+  MeshExporter(MeshExporter&&) = delete;                 // Move Constructor Not Implemented
+  MeshExporter& operator=(const MeshExporter&) = delete; // Copy Assignment Not Implemented
+  MeshExporter& operator=(MeshExporter&&) = delete;      // Move Assignment Not Implemented
+};
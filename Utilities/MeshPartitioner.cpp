@@ -0,0 +1,516 @@
+/* ============================================================================
+* Copyright (c) 2018 BlueQuartz Software, LLC
+*
+* Redistribution and use in source and binary forms, with or without modification,
+* are permitted provided that the following conditions are met:
+*
+* Redistributions of source code must retain the above copyright notice, this
+* list of conditions and the following disclaimer.
+*
+* Redistributions in binary form must reproduce the above copyright notice, this
+* list of conditions and the following disclaimer in the documentation and/or
+* other materials provided with the distribution.
+*
+* Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+* contributors may be used to endorse or promote products derived from this software
+* without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+* DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+* FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+* DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+* OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+* USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*
+* ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+
+#include "MeshPartitioner.h"
+
+#include <algorithm>
+#include <cmath>
+#include <numeric>
+
+#include "SIMPLib/SIMPLib.h"
+
+#include "Utilities/LabelCountingSort.h"
+
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_for.h>
+#include <tbb/parallel_invoke.h>
+#include <tbb/partitioner.h>
+#endif
+
+namespace
+{
+// Ranges with fewer points are bisected on the calling thread
+const size_t k_ParallelBisectionSize = 65536;
+
+/**
+ * @brief Describes a box of grid cells [lo, hi) that belongs to one part
+ */
+struct GridBox
+{
+  size_t lo[3];
+  size_t hi[3];
+  int32_t part;
+};
+
+/**
+ * @brief Splits a box of grid cells along its longest side until every box holds one part
+ */
+void SplitGridBox(const GridBox& box, size_t numParts, std::vector<GridBox>& boxes)
+{
+  size_t longest = 0;
+  for(size_t axis = 1; axis < 3; axis++)
+  {
+    if(box.hi[axis] - box.lo[axis] > box.hi[longest] - box.lo[longest])
+    {
+      longest = axis;
+    }
+  }
+  size_t length = box.hi[longest] - box.lo[longest];
+  if(numParts <= 1 || length <= 1)
+  {
+    boxes.push_back(box);
+    return;
+  }
+
+  size_t leftParts = numParts / 2;
+  size_t split = static_cast<size_t>(std::llround(static_cast<double>(length) * leftParts / numParts));
+  split = std::min(std::max<size_t>(split, 1), length - 1);
+
+  GridBox left = box;
+  GridBox right = box;
+  left.hi[longest] = box.lo[longest] + split;
+  right.lo[longest] = box.lo[longest] + split;
+  right.part = box.part + static_cast<int32_t>(leftParts);
+  SplitGridBox(left, leftParts, boxes);
+  SplitGridBox(right, numParts - leftParts, boxes);
+}
+
+/**
+ * @brief Cuts the elements into ranges of equal size
+ */
+class FillSlabsImpl
+{
+public:
+  FillSlabsImpl(size_t numParts, std::vector<int32_t>& parts)
+  : m_NumParts(numParts)
+  , m_Parts(parts)
+  {
+  }
+
+  void convert(size_t start, size_t end) const
+  {
+    double partsPerElement = static_cast<double>(m_NumParts) / static_cast<double>(m_Parts.size());
+    for(size_t i = start; i < end; i++)
+    {
+      m_Parts[i] = static_cast<int32_t>(std::min(static_cast<size_t>(i * partsPerElement), m_NumParts - 1));
+    }
+  }
+
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+  void operator()(const tbb::blocked_range<size_t>& r) const
+  {
+    convert(r.begin(), r.end());
+  }
+#endif
+
+private:
+  size_t m_NumParts;
+  std::vector<int32_t>& m_Parts;
+};
+
+/**
+ * @brief Writes the part of every cell of each box
+ */
+class FillBoxesImpl
+{
+public:
+  FillBoxesImpl(const size_t* dims, const std::vector<GridBox>& boxes, std::vector<int32_t>& parts)
+  : m_Dims(dims)
+  , m_Boxes(boxes)
+  , m_Parts(parts)
+  {
+  }
+
+  void convert(size_t start, size_t end) const
+  {
+    for(size_t b = start; b < end; b++)
+    {
+      const GridBox& box = m_Boxes[b];
+      for(size_t z = box.lo[2]; z < box.hi[2]; z++)
+      {
+        for(size_t y = box.lo[1]; y < box.hi[1]; y++)
+        {
+          size_t rowStart = (z * m_Dims[1] + y) * m_Dims[0];
+          std::fill(m_Parts.begin() + rowStart + box.lo[0], m_Parts.begin() + rowStart + box.hi[0], box.part);
+        }
+      }
+    }
+  }
+
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+  void operator()(const tbb::blocked_range<size_t>& r) const
+  {
+    convert(r.begin(), r.end());
+  }
+#endif
+
+private:
+  const size_t* m_Dims;
+  const std::vector<GridBox>& m_Boxes;
+  std::vector<int32_t>& m_Parts;
+};
+
+/**
+ * @brief Computes the centroid and element count of each Feature from its sorted elements
+ */
+class FeatureCentroidImpl
+{
+public:
+  FeatureCentroidImpl(const std::vector<float>& centers, const size_t* dims, const LabelCountingSort& sorter, std::vector<float>& featureCenters, std::vector<size_t>& weights)
+  : m_Centers(centers)
+  , m_Dims(dims)
+  , m_Sorter(sorter)
+  , m_FeatureCenters(featureCenters)
+  , m_Weights(weights)
+  {
+  }
+
+  void convert(size_t start, size_t end) const
+  {
+    const std::vector<size_t>& offsets = m_Sorter.getOffsets();
+    const std::vector<size_t>& order = m_Sorter.getOrder();
+    for(size_t feature = start; feature < end; feature++)
+    {
+      double sums[3] = {0.0, 0.0, 0.0};
+      for(size_t j = offsets[feature]; j < offsets[feature + 1]; j++)
+      {
+        size_t i = order[j];
+        if(m_Centers.empty())
+        {
+          sums[0] += static_cast<double>(i % m_Dims[0]) + 0.5;
+          sums[1] += static_cast<double>((i / m_Dims[0]) % m_Dims[1]) + 0.5;
+          sums[2] += static_cast<double>(i / (m_Dims[0] * m_Dims[1])) + 0.5;
+        }
+        else
+        {
+          sums[0] += m_Centers[3 * i];
+          sums[1] += m_Centers[3 * i + 1];
+          sums[2] += m_Centers[3 * i + 2];
+        }
+      }
+      size_t count = offsets[feature + 1] - offsets[feature];
+      for(size_t axis = 0; axis < 3; axis++)
+      {
+        m_FeatureCenters[3 * feature + axis] = static_cast<float>(sums[axis] / count);
+      }
+      m_Weights[feature] = count;
+    }
+  }
+
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+  void operator()(const tbb::blocked_range<size_t>& r) const
+  {
+    convert(r.begin(), r.end());
+  }
+#endif
+
+private:
+  const std::vector<float>& m_Centers;
+  const size_t* m_Dims;
+  const LabelCountingSort& m_Sorter;
+  std::vector<float>& m_FeatureCenters;
+  std::vector<size_t>& m_Weights;
+};
+
+/**
+ * @brief Gives every element the part of its Feature
+ */
+class AssignFeaturePartsImpl
+{
+public:
+  AssignFeaturePartsImpl(const LabelCountingSort& sorter, const std::vector<int32_t>& featureParts, std::vector<int32_t>& parts)
+  : m_Sorter(sorter)
+  , m_FeatureParts(featureParts)
+  , m_Parts(parts)
+  {
+  }
+
+  void convert(size_t start, size_t end) const
+  {
+    const std::vector<size_t>& offsets = m_Sorter.getOffsets();
+    const std::vector<size_t>& order = m_Sorter.getOrder();
+    for(size_t feature = start; feature < end; feature++)
+    {
+      for(size_t j = offsets[feature]; j < offsets[feature + 1]; j++)
+      {
+        m_Parts[order[j]] = m_FeatureParts[feature];
+      }
+    }
+  }
+
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+  void operator()(const tbb::blocked_range<size_t>& r) const
+  {
+    convert(r.begin(), r.end());
+  }
+#endif
+
+private:
+  const LabelCountingSort& m_Sorter;
+  const std::vector<int32_t>& m_FeatureParts;
+  std::vector<int32_t>& m_Parts;
+};
+
+/**
+ * @brief Recursively splits a permutation of weighted points at the weighted median of one axis
+ */
+class PointBisector
+{
+public:
+  PointBisector(const std::vector<float>& centers, const std::vector<size_t>& weights, bool alongZ, std::vector<size_t>& order, std::vector<int32_t>& pointParts)
+  : m_Centers(centers)
+  , m_Weights(weights)
+  , m_AlongZ(alongZ)
+  , m_Order(order)
+  , m_PointParts(pointParts)
+  {
+  }
+
+  void bisect(size_t begin, size_t end, int32_t firstPart, size_t numParts) const
+  {
+    if(numParts <= 1 || end - begin <= 1)
+    {
+      for(size_t i = begin; i < end; i++)
+      {
+        m_PointParts[m_Order[i]] = firstPart;
+      }
+      return;
+    }
+
+    size_t axis = m_AlongZ ? 2 : longestAxis(begin, end);
+    const float* centers = m_Centers.data();
+    auto lessAlongAxis = [centers, axis](size_t a, size_t b) { return centers[3 * a + axis] < centers[3 * b + axis]; };
+
+    // The points are split in proportion to the number of parts on each side
+    size_t leftParts = numParts / 2;
+    size_t mid = begin;
+    if(m_Weights.empty())
+    {
+      mid = begin + static_cast<size_t>(std::llround(static_cast<double>(end - begin) * leftParts / numParts));
+      mid = std::min(std::max(mid, begin + 1), end - 1);
+      std::nth_element(m_Order.begin() + begin, m_Order.begin() + mid, m_Order.begin() + end, lessAlongAxis);
+    }
+    else
+    {
+      std::sort(m_Order.begin() + begin, m_Order.begin() + end, lessAlongAxis);
+      double total = 0.0;
+      for(size_t i = begin; i < end; i++)
+      {
+        total += static_cast<double>(m_Weights[m_Order[i]]);
+      }
+      double target = total * leftParts / numParts;
+      double weight = 0.0;
+      while(mid < end - 1 && weight + 0.5 * m_Weights[m_Order[mid]] < target)
+      {
+        weight += static_cast<double>(m_Weights[m_Order[mid]]);
+        mid++;
+      }
+      mid = std::max(mid, begin + 1);
+    }
+
+    int32_t rightPart = firstPart + static_cast<int32_t>(leftParts);
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+    if(end - begin >= k_ParallelBisectionSize)
+    {
+      tbb::parallel_invoke([=] { bisect(begin, mid, firstPart, leftParts); }, [=] { bisect(mid, end, rightPart, numParts - leftParts); });
+      return;
+    }
+#endif
+    bisect(begin, mid, firstPart, leftParts);
+    bisect(mid, end, rightPart, numParts - leftParts);
+  }
+
+private:
+  size_t longestAxis(size_t begin, size_t end) const
+  {
+    float lo[3] = {m_Centers[3 * m_Order[begin]], m_Centers[3 * m_Order[begin] + 1], m_Centers[3 * m_Order[begin] + 2]};
+    float hi[3] = {lo[0], lo[1], lo[2]};
+    for(size_t i = begin + 1; i < end; i++)
+    {
+      const float* center = m_Centers.data() + 3 * m_Order[i];
+      for(size_t axis = 0; axis < 3; axis++)
+      {
+        lo[axis] = std::min(lo[axis], center[axis]);
+        hi[axis] = std::max(hi[axis], center[axis]);
+      }
+    }
+
+    size_t longest = 0;
+    for(size_t axis = 1; axis < 3; axis++)
+    {
+      if(hi[axis] - lo[axis] > hi[longest] - lo[longest])
+      {
+        longest = axis;
+      }
+    }
+    return longest;
+  }
+
+  const std::vector<float>& m_Centers;
+  const std::vector<size_t>& m_Weights;
+  bool m_AlongZ;
+  std::vector<size_t>& m_Order;
+  std::vector<int32_t>& m_PointParts;
+};
+} // namespace
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+MeshPartitioner::MeshPartitioner(Strategy strategy, size_t numParts)
+: m_Strategy(strategy)
+, m_NumParts(std::max<size_t>(numParts, 1))
+{
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+MeshPartitioner::~MeshPartitioner() = default;
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool MeshPartitioner::executeGrid(const size_t dims[3], const int32_t* featureIds)
+{
+  size_t numElements = dims[0] * dims[1] * dims[2];
+  m_Parts.assign(numElements, 0);
+  if(numElements == 0)
+  {
+    return true;
+  }
+
+  switch(m_Strategy)
+  {
+  case Strategy::Slabs:
+  {
+    // The cells are numbered Z slowest, so equal ranges of cells are Z slabs
+    FillSlabsImpl impl(m_NumParts, m_Parts);
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+    tbb::parallel_for(tbb::blocked_range<size_t>(0, numElements), impl, tbb::auto_partitioner());
+#else
+    impl.convert(0, numElements);
+#endif
+    return true;
+  }
+  case Strategy::CoordinateBisection:
+    bisectGrid(dims);
+    return true;
+  case Strategy::FeaturePreserving:
+    return bisectFeatures(std::vector<float>(), dims, featureIds, numElements);
+  }
+  return true;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool MeshPartitioner::executeElements(const std::vector<float>& centers, const int32_t* featureIds)
+{
+  size_t numElements = centers.size() / 3;
+  m_Parts.assign(numElements, 0);
+  if(m_Strategy == Strategy::FeaturePreserving)
+  {
+    return bisectFeatures(centers, nullptr, featureIds, numElements);
+  }
+
+  bisectPoints(centers, std::vector<size_t>(), m_Parts);
+  return true;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+const std::vector<int32_t>& MeshPartitioner::getParts() const
+{
+  return m_Parts;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void MeshPartitioner::bisectPoints(const std::vector<float>& centers, const std::vector<size_t>& weights, std::vector<int32_t>& pointParts) const
+{
+  size_t numPoints = centers.size() / 3;
+  std::vector<size_t> order(numPoints);
+  std::iota(order.begin(), order.end(), 0);
+
+  PointBisector bisector(centers, weights, m_Strategy == Strategy::Slabs, order, pointParts);
+  bisector.bisect(0, numPoints, 0, m_NumParts);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void MeshPartitioner::bisectGrid(const size_t dims[3])
+{
+  // The boxes follow from the dimensions alone; only filling in the cells touches the whole grid
+  GridBox box = {{0, 0, 0}, {dims[0], dims[1], dims[2]}, 0};
+  std::vector<GridBox> boxes;
+  SplitGridBox(box, m_NumParts, boxes);
+
+  FillBoxesImpl impl(dims, boxes, m_Parts);
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+  tbb::parallel_for(tbb::blocked_range<size_t>(0, boxes.size(), 1), impl, tbb::auto_partitioner());
+#else
+  impl.convert(0, boxes.size());
+#endif
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool MeshPartitioner::bisectFeatures(const std::vector<float>& centers, const size_t dims[3], const int32_t* featureIds, size_t numElements)
+{
+  // The sorter lists the elements of every Feature that has any, so the per Feature arrays
+  // below never depend on how large the Feature Ids are
+  LabelCountingSort sorter;
+  if(!sorter.execute(featureIds, numElements))
+  {
+    m_Parts.clear();
+    return false;
+  }
+  size_t numFeatures = sorter.getNumberOfUsedLabels();
+
+  // Each Feature is represented by the centroid of its elements and weighted by their number
+  std::vector<float> featureCenters(numFeatures * 3);
+  std::vector<size_t> weights(numFeatures);
+  {
+    FeatureCentroidImpl impl(centers, dims, sorter, featureCenters, weights);
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+    tbb::parallel_for(tbb::blocked_range<size_t>(0, numFeatures), impl, tbb::auto_partitioner());
+#else
+    impl.convert(0, numFeatures);
+#endif
+  }
+
+  std::vector<int32_t> featureParts(numFeatures, 0);
+  bisectPoints(featureCenters, weights, featureParts);
+
+  AssignFeaturePartsImpl impl(sorter, featureParts, m_Parts);
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+  tbb::parallel_for(tbb::blocked_range<size_t>(0, numFeatures), impl, tbb::auto_partitioner());
+#else
+  impl.convert(0, numFeatures);
+#endif
+  return true;
+}
@@ -0,0 +1,128 @@
+/* ============================================================================
+* Copyright (c) 2018 BlueQuartz Software, LLC
+*
+* Redistribution and use in source and binary forms, with or without modification,
+* are permitted provided that the following conditions are met:
+*
+* Redistributions of source code must retain the above copyright notice, this
+* list of conditions and the following disclaimer.
+*
+* Redistributions in binary form must reproduce the above copyright notice, this
+* list of conditions and the following disclaimer in the documentation and/or
+* other materials provided with the distribution.
+*
+* Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+* contributors may be used to endorse or promote products derived from this software
+* without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+* DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+* FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+* DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+* OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+* USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*
+* ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+/**
+ * @brief The MeshPartitioner class assigns the elements of a mesh to a number of parts for
+ * solvers that load the mesh in parallel. Three strategies are available:
+ *
+ * Slabs cuts the elements into parts of equal size along Z.
+ *
+ * CoordinateBisection recursively splits the elements in two along the longest side of their
+ * bounding box, in proportion to the number of parts on each side, which keeps the parts
+ * compact and their shared surfaces small.
+ *
+ * FeaturePreserving bisects whole Features, weighted by their element counts, so no Feature is
+ * split between parts. The parts are only as balanced as the Feature sizes allow.
+ *
+ * The bisections of independent halves run in parallel when SIMPL is built with TBB.
+ */
+class MeshPartitioner
+{
+public:
+  enum class Strategy : int
+  {
+    Slabs = 0,
+    CoordinateBisection = 1,
+    FeaturePreserving = 2
+  };
+
+  /**
+   * @brief Constructor
+   * @param strategy
+   * @param numParts Number of parts, at least 1
+   */
+  MeshPartitioner(Strategy strategy, size_t numParts);
+  virtual ~MeshPartitioner();
+
+  /**
+   * @brief Partitions the cells of a grid, numbered with X varying fastest, then Y, then Z
+   * @param dims Number of cells along X, Y and Z
+   * @param featureIds Feature Id of each cell; only read by the FeaturePreserving strategy
+   * @return false if a Feature Id is negative, in which case nothing is partitioned
+   */
+  bool executeGrid(const size_t dims[3], const int32_t* featureIds);
+
+  /**
+   * @brief Partitions elements given by their centers
+   * @param centers Interleaved XYZ center of each element
+   * @param featureIds Feature Id of each element; only read by the FeaturePreserving strategy
+   * @return false if a Feature Id is negative, in which case nothing is partitioned
+   */
+  bool executeElements(const std::vector<float>& centers, const int32_t* featureIds);
+
+  /**
+   * @brief Returns the part of each element
+   * @return
+   */
+  const std::vector<int32_t>& getParts() const;
+
+protected:
+  /**
+   * @brief Assigns the parts of weighted points by recursive bisection
+   * @param centers Interleaved XYZ coordinates of the points
+   * @param weights Weight of each point, or empty if every point weighs 1
+   * @param pointParts Receives the part of each point
+   */
+  void bisectPoints(const std::vector<float>& centers, const std::vector<size_t>& weights, std::vector<int32_t>& pointParts) const;
+
+  /**
+   * @brief Assigns the parts of the cells of a grid by recursively bisecting the grid box
+   * @param dims
+   */
+  void bisectGrid(const size_t dims[3]);
+
+  /**
+   * @brief Assigns the parts of the elements from the parts of their Features
+   * @param centers Interleaved XYZ center of each element, or empty for the cells of a grid
+   * @param dims Grid dimensions when centers is empty
+   * @param featureIds
+   * @param numElements
+   * @return false if a Feature Id is negative
+   */
+  bool bisectFeatures(const std::vector<float>& centers, const size_t dims[3], const int32_t* featureIds, size_t numElements);
+
+private:
+  Strategy m_Strategy = Strategy::CoordinateBisection;
+  size_t m_NumParts = 1;
+  std::vector<int32_t> m_Parts;
+
+public:
+  MeshPartitioner(const MeshPartitioner&) = delete;            // Copy Constructor Not Implemented
+  MeshPartitioner(MeshPartitioner&&) = delete;                 // Move Constructor Not Implemented
+  MeshPartitioner& operator=(const MeshPartitioner&) = delete; // Copy Assignment Not Implemented
+  MeshPartitioner& operator=(MeshPartitioner&&) = delete;      // Move Assignment Not Implemented
+};
@@ -0,0 +1,466 @@
+/* ============================================================================
+* Copyright (c) 2018 BlueQuartz Software, LLC
+*
+* Redistribution and use in source and binary forms, with or without modification,
+* are permitted provided that the following conditions are met:
+*
+* Redistributions of source code must retain the above copyright notice, this
+* list of conditions and the following disclaimer.
+*
+* Redistributions in binary form must reproduce the above copyright notice, this
+* list of conditions and the following disclaimer in the documentation and/or
+* other materials provided with the distribution.
+*
+* Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+* contributors may be used to endorse or promote products derived from this software
+* without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+* DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+* FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+* DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+* OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+* USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*
+* ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+
+#include "MeshReorderer.h"
+
+#include <algorithm>
+#include <utility>
+
+#include "SIMPLib/SIMPLib.h"
+
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_for.h>
+#include <tbb/parallel_sort.h>
+#include <tbb/partitioner.h>
+#endif
+
+namespace
+{
+using CurveKey = std::pair<uint64_t, size_t>;
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+uint64_t SpreadBits(uint32_t value)
+{
+  // Moves bit i of the lowest 21 bits to bit 3 * i
+  uint64_t bits = value & 0x1fffff;
+  bits = (bits | bits << 32) & 0x1f00000000ffffULL;
+  bits = (bits | bits << 16) & 0x1f0000ff0000ffULL;
+  bits = (bits | bits << 8) & 0x100f00f00f00f00fULL;
+  bits = (bits | bits << 4) & 0x10c30c30c30c30c3ULL;
+  bits = (bits | bits << 2) & 0x1249249249249249ULL;
+  return bits;
+}
+
+/**
+ * @brief Computes the curve key of each point of a grid, paired with its natural index
+ */
+class CurveKeysImpl
+{
+public:
+  CurveKeysImpl(const size_t* pointDims, bool hilbert, int bits, std::vector<CurveKey>& keys)
+  : m_PointDims(pointDims)
+  , m_Hilbert(hilbert)
+  , m_Bits(bits)
+  , m_Keys(keys)
+  {
+  }
+
+  void convert(size_t start, size_t end) const
+  {
+    size_t pointsPerLayer = m_PointDims[0] * m_PointDims[1];
+    for(size_t i = start; i < end; i++)
+    {
+      uint32_t z = static_cast<uint32_t>(i / pointsPerLayer);
+      uint32_t y = static_cast<uint32_t>((i % pointsPerLayer) / m_PointDims[0]);
+      uint32_t x = static_cast<uint32_t>(i % m_PointDims[0]);
+      m_Keys[i].first = m_Hilbert ? MeshReorderer::HilbertKey(x, y, z, m_Bits) : MeshReorderer::MortonKey(x, y, z);
+      m_Keys[i].second = i;
+    }
+  }
+
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+  void operator()(const tbb::blocked_range<size_t>& r) const
+  {
+    convert(r.begin(), r.end());
+  }
+#endif
+
+private:
+  const size_t* m_PointDims;
+  bool m_Hilbert;
+  int m_Bits;
+  std::vector<CurveKey>& m_Keys;
+};
+
+/**
+ * @brief Keys each element by the lowest new id of its eight nodes
+ */
+class ElementKeysImpl
+{
+public:
+  ElementKeysImpl(const size_t* dims, const std::vector<int64_t>& nodeIds, std::vector<CurveKey>& keys)
+  : m_Dims(dims)
+  , m_NodeIds(nodeIds)
+  , m_Keys(keys)
+  {
+  }
+
+  void convert(size_t start, size_t end) const
+  {
+    size_t rowStride = m_Dims[0] + 1;
+    size_t layerStride = rowStride * (m_Dims[1] + 1);
+    size_t elementsPerLayer = m_Dims[0] * m_Dims[1];
+    for(size_t i = start; i < end; i++)
+    {
+      size_t z = i / elementsPerLayer;
+      size_t y = (i % elementsPerLayer) / m_Dims[0];
+      size_t x = i % m_Dims[0];
+      size_t n0 = z * layerStride + y * rowStride + x;
+      int64_t lowest = m_NodeIds[n0];
+      for(size_t corner : {n0 + 1, n0 + rowStride, n0 + rowStride + 1})
+      {
+        lowest = std::min({lowest, m_NodeIds[corner], m_NodeIds[corner + layerStride]});
+      }
+      m_Keys[i].first = static_cast<uint64_t>(std::min(lowest, m_NodeIds[n0 + layerStride]));
+      m_Keys[i].second = i;
+    }
+  }
+
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+  void operator()(const tbb::blocked_range<size_t>& r) const
+  {
+    convert(r.begin(), r.end());
+  }
+#endif
+
+private:
+  const size_t* m_Dims;
+  const std::vector<int64_t>& m_NodeIds;
+  std::vector<CurveKey>& m_Keys;
+};
+
+/**
+ * @brief Copies the natural indices out of sorted keys
+ */
+class ExtractOrderImpl
+{
+public:
+  ExtractOrderImpl(const std::vector<CurveKey>& keys, std::vector<size_t>& order)
+  : m_Keys(keys)
+  , m_Order(order)
+  {
+  }
+
+  void convert(size_t start, size_t end) const
+  {
+    for(size_t i = start; i < end; i++)
+    {
+      m_Order[i] = m_Keys[i].second;
+    }
+  }
+
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+  void operator()(const tbb::blocked_range<size_t>& r) const
+  {
+    convert(r.begin(), r.end());
+  }
+#endif
+
+private:
+  const std::vector<CurveKey>& m_Keys;
+  std::vector<size_t>& m_Order;
+};
+
+/**
+ * @brief Writes the new id of each node at its natural index
+ */
+class InvertOrderImpl
+{
+public:
+  InvertOrderImpl(const std::vector<size_t>& order, std::vector<int64_t>& ids)
+  : m_Order(order)
+  , m_Ids(ids)
+  {
+  }
+
+  void convert(size_t start, size_t end) const
+  {
+    for(size_t i = start; i < end; i++)
+    {
+      m_Ids[m_Order[i]] = static_cast<int64_t>(i);
+    }
+  }
+
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+  void operator()(const tbb::blocked_range<size_t>& r) const
+  {
+    convert(r.begin(), r.end());
+  }
+#endif
+
+private:
+  const std::vector<size_t>& m_Order;
+  std::vector<int64_t>& m_Ids;
+};
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void SortKeys(std::vector<CurveKey>& keys, std::vector<size_t>& order)
+{
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+  tbb::parallel_sort(keys.begin(), keys.end());
+#else
+  std::sort(keys.begin(), keys.end());
+#endif
+
+  order.resize(keys.size());
+  ExtractOrderImpl impl(keys, order);
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+  tbb::parallel_for(tbb::blocked_range<size_t>(0, keys.size()), impl, tbb::auto_partitioner());
+#else
+  impl.convert(0, keys.size());
+#endif
+}
+} // namespace
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+MeshReorderer::MeshReorderer(Ordering ordering)
+: m_Ordering(ordering)
+{
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+MeshReorderer::~MeshReorderer() = default;
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void MeshReorderer::executeGrid(const size_t dims[3])
+{
+  m_ElementOrder.clear();
+  m_NodeOrder.clear();
+  m_NodeIds.clear();
+  if(isNatural())
+  {
+    return;
+  }
+
+  size_t nodeDims[3] = {dims[0] + 1, dims[1] + 1, dims[2] + 1};
+  if(m_Ordering == Ordering::ReverseCuthillMcKee)
+  {
+    orderNodesByCuthillMcKee(nodeDims);
+    orderElementsByNodes(dims);
+    return;
+  }
+
+  sortAlongCurve(dims, m_ElementOrder);
+  sortAlongCurve(nodeDims, m_NodeOrder);
+  m_NodeIds.resize(m_NodeOrder.size());
+  InvertOrderImpl impl(m_NodeOrder, m_NodeIds);
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+  tbb::parallel_for(tbb::blocked_range<size_t>(0, m_NodeOrder.size()), impl, tbb::auto_partitioner());
+#else
+  impl.convert(0, m_NodeOrder.size());
+#endif
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool MeshReorderer::isNatural() const
+{
+  return m_Ordering == Ordering::Natural;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+const std::vector<size_t>& MeshReorderer::getElementOrder() const
+{
+  return m_ElementOrder;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+const std::vector<size_t>& MeshReorderer::getNodeOrder() const
+{
+  return m_NodeOrder;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+const std::vector<int64_t>& MeshReorderer::getNodeIds() const
+{
+  return m_NodeIds;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+uint64_t MeshReorderer::MortonKey(uint32_t x, uint32_t y, uint32_t z)
+{
+  return SpreadBits(x) | SpreadBits(y) << 1 | SpreadBits(z) << 2;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+uint64_t MeshReorderer::HilbertKey(uint32_t x, uint32_t y, uint32_t z, int bits)
+{
+  // Skilling's transform of the coordinates into the transposed Hilbert index, "Programming
+  // the Hilbert curve", AIP Conference Proceedings 707 (2004)
+  uint32_t axes[3] = {x, y, z};
+  uint32_t highBit = 1u << (bits - 1);
+  for(uint32_t q = highBit; q > 1; q >>= 1)
+  {
+    uint32_t p = q - 1;
+    for(uint32_t& axis : axes)
+    {
+      if((axis & q) != 0)
+      {
+        axes[0] ^= p;
+      }
+      else
+      {
+        uint32_t t = (axes[0] ^ axis) & p;
+        axes[0] ^= t;
+        axis ^= t;
+      }
+    }
+  }
+
+  // Gray encode
+  axes[1] ^= axes[0];
+  axes[2] ^= axes[1];
+  uint32_t t = 0;
+  for(uint32_t q = highBit; q > 1; q >>= 1)
+  {
+    if((axes[2] & q) != 0)
+    {
+      t ^= q - 1;
+    }
+  }
+  for(uint32_t& axis : axes)
+  {
+    axis ^= t;
+  }
+
+  // The index interleaves the transposed bits from the highest down, X first
+  return SpreadBits(axes[0]) << 2 | SpreadBits(axes[1]) << 1 | SpreadBits(axes[2]);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void MeshReorderer::sortAlongCurve(const size_t pointDims[3], std::vector<size_t>& order) const
+{
+  // The curve fills the smallest power of two cube around the grid
+  size_t largest = std::max({pointDims[0], pointDims[1], pointDims[2]});
+  int bits = 1;
+  while(bits < 21 && (static_cast<size_t>(1) << bits) < largest)
+  {
+    bits++;
+  }
+
+  size_t numPoints = pointDims[0] * pointDims[1] * pointDims[2];
+  std::vector<CurveKey> keys(numPoints);
+  CurveKeysImpl impl(pointDims, m_Ordering == Ordering::Hilbert, bits, keys);
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+  tbb::parallel_for(tbb::blocked_range<size_t>(0, numPoints), impl, tbb::auto_partitioner());
+#else
+  impl.convert(0, numPoints);
+#endif
+  SortKeys(keys, order);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void MeshReorderer::orderNodesByCuthillMcKee(const size_t nodeDims[3])
+{
+  size_t numNodes = nodeDims[0] * nodeDims[1] * nodeDims[2];
+  size_t rowStride = nodeDims[0];
+  size_t layerStride = nodeDims[0] * nodeDims[1];
+  auto degree = [nodeDims](size_t x, size_t y, size_t z) {
+    return (x > 0) + (x + 1 < nodeDims[0]) + (y > 0) + (y + 1 < nodeDims[1]) + (z > 0) + (z + 1 < nodeDims[2]);
+  };
+
+  // The node order doubles as the queue of the breadth first search, and the node ids mark
+  // the nodes already queued. A corner node has the lowest degree and lies on the periphery.
+  m_NodeOrder.clear();
+  m_NodeOrder.reserve(numNodes);
+  m_NodeIds.assign(numNodes, -1);
+  m_NodeOrder.push_back(0);
+  m_NodeIds[0] = 0;
+  for(size_t head = 0; head < m_NodeOrder.size(); head++)
+  {
+    size_t node = m_NodeOrder[head];
+    size_t z = node / layerStride;
+    size_t y = (node % layerStride) / rowStride;
+    size_t x = node % rowStride;
+
+    // Unvisited edge neighbors are queued by increasing degree
+    std::pair<int, size_t> neighbors[6];
+    size_t numNeighbors = 0;
+    auto visit = [&](bool inside, size_t neighbor, size_t nx, size_t ny, size_t nz) {
+      if(inside && m_NodeIds[neighbor] < 0)
+      {
+        m_NodeIds[neighbor] = 0;
+        neighbors[numNeighbors++] = std::make_pair(degree(nx, ny, nz), neighbor);
+      }
+    };
+    visit(x > 0, node - 1, x - 1, y, z);
+    visit(x + 1 < nodeDims[0], node + 1, x + 1, y, z);
+    visit(y > 0, node - rowStride, x, y - 1, z);
+    visit(y + 1 < nodeDims[1], node + rowStride, x, y + 1, z);
+    visit(z > 0, node - layerStride, x, y, z - 1);
+    visit(z + 1 < nodeDims[2], node + layerStride, x, y, z + 1);
+    std::sort(neighbors, neighbors + numNeighbors);
+    for(size_t i = 0; i < numNeighbors; i++)
+    {
+      m_NodeOrder.push_back(neighbors[i].second);
+    }
+  }
+
+  std::reverse(m_NodeOrder.begin(), m_NodeOrder.end());
+  InvertOrderImpl impl(m_NodeOrder, m_NodeIds);
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+  tbb::parallel_for(tbb::blocked_range<size_t>(0, numNodes), impl, tbb::auto_partitioner());
+#else
+  impl.convert(0, numNodes);
+#endif
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void MeshReorderer::orderElementsByNodes(const size_t dims[3])
+{
+  size_t numElements = dims[0] * dims[1] * dims[2];
+  std::vector<CurveKey> keys(numElements);
+  ElementKeysImpl impl(dims, m_NodeIds, keys);
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+  tbb::parallel_for(tbb::blocked_range<size_t>(0, numElements), impl, tbb::auto_partitioner());
+#else
+  impl.convert(0, numElements);
+#endif
+  SortKeys(keys, m_ElementOrder);
+}
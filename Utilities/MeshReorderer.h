@@ -0,0 +1,157 @@
+/* ============================================================================
+* Copyright (c) 2018 BlueQuartz Software, LLC
+*
+* Redistribution and use in source and binary forms, with or without modification,
+* are permitted provided that the following conditions are met:
+*
+* Redistributions of source code must retain the above copyright notice, this
+* list of conditions and the following disclaimer.
+*
+* Redistributions in binary form must reproduce the above copyright notice, this
+* list of conditions and the following disclaimer in the documentation and/or
+* other materials provided with the distribution.
+*
+* Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+* contributors may be used to endorse or promote products derived from this software
+* without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+* DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+* FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+* DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+* OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+* USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*
+* ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+/**
+ * @brief The MeshReorderer class renumbers the elements and nodes of the hexahedral mesh of a
+ * grid so that entities close in space get close numbers, which improves the cache locality
+ * and the matrix bandwidth of solvers that read the mesh. Three orderings are available:
+ *
+ * Morton and Hilbert sort the elements by the position of their cell, and the nodes by their
+ * own position, along a Z-order or a Hilbert space filling curve. The keys are computed and
+ * sorted in parallel when SIMPL is built with TBB.
+ *
+ * ReverseCuthillMcKee numbers the nodes by a breadth first search over the edges of the mesh
+ * from a corner, reversed, and sorts the elements by their lowest node. The search itself is
+ * serial.
+ *
+ * The orders map the new numbering to the natural one, where X varies fastest, then Y, then Z,
+ * so a writer can generate any range of the renumbered mesh from them.
+ */
+class MeshReorderer
+{
+public:
+  enum class Ordering : int
+  {
+    Natural = 0,
+    Morton = 1,
+    Hilbert = 2,
+    ReverseCuthillMcKee = 3
+  };
+
+  /**
+   * @brief Constructor
+   * @param ordering
+   */
+  explicit MeshReorderer(Ordering ordering);
+  virtual ~MeshReorderer();
+
+  /**
+   * @brief Computes the element and node orders of the hexahedral mesh of a grid. Nothing is
+   * computed for the Natural ordering.
+   * @param dims Number of cells along X, Y and Z
+   */
+  void executeGrid(const size_t dims[3]);
+
+  /**
+   * @brief Returns whether the mesh keeps its natural numbering, in which case the orders are
+   * empty
+   * @return
+   */
+  bool isNatural() const;
+
+  /**
+   * @brief Returns the natural index of each renumbered element
+   * @return
+   */
+  const std::vector<size_t>& getElementOrder() const;
+
+  /**
+   * @brief Returns the natural index of each renumbered node
+   * @return
+   */
+  const std::vector<size_t>& getNodeOrder() const;
+
+  /**
+   * @brief Returns the new index of each node in the natural numbering, the inverse of the node
+   * order
+   * @return
+   */
+  const std::vector<int64_t>& getNodeIds() const;
+
+  /**
+   * @brief Returns the position of a point along the Z-order curve, with the bits of X, Y and Z
+   * interleaved from X up
+   * @param x
+   * @param y
+   * @param z
+   * @return
+   */
+  static uint64_t MortonKey(uint32_t x, uint32_t y, uint32_t z);
+
+  /**
+   * @brief Returns the position of a point along the Hilbert curve that fills a cube of
+   * 2^bits points per side
+   * @param x
+   * @param y
+   * @param z
+   * @param bits At most 21
+   * @return
+   */
+  static uint64_t HilbertKey(uint32_t x, uint32_t y, uint32_t z, int bits);
+
+protected:
+  /**
+   * @brief Sorts the points of a grid along the space filling curve of the ordering
+   * @param pointDims Number of points along X, Y and Z
+   * @param order Receives the natural index of each point in curve order
+   */
+  void sortAlongCurve(const size_t pointDims[3], std::vector<size_t>& order) const;
+
+  /**
+   * @brief Numbers the nodes of the grid by reverse Cuthill-McKee
+   * @param nodeDims Number of nodes along X, Y and Z
+   */
+  void orderNodesByCuthillMcKee(const size_t nodeDims[3]);
+
+  /**
+   * @brief Sorts the elements by the lowest new id of their nodes
+   * @param dims Number of cells along X, Y and Z
+   */
+  void orderElementsByNodes(const size_t dims[3]);
+
+private:
+  Ordering m_Ordering = Ordering::Natural;
+  std::vector<size_t> m_ElementOrder;
+  std::vector<size_t> m_NodeOrder;
+  std::vector<int64_t> m_NodeIds;
+
+public:
+  MeshReorderer(const MeshReorderer&) = delete;            // Copy Constructor Not Implemented
+  MeshReorderer(MeshReorderer&&) = delete;                 // Move Constructor Not Implemented
+  MeshReorderer& operator=(const MeshReorderer&) = delete; // Copy Assignment Not Implemented
+  MeshReorderer& operator=(MeshReorderer&&) = delete;      // Move Assignment Not Implemented
+};
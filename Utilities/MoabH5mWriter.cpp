@@ -0,0 +1,874 @@
+/* ============================================================================
+* Copyright (c) 2018 BlueQuartz Software, LLC
+*
+* Redistribution and use in source and binary forms, with or without modification,
+* are permitted provided that the following conditions are met:
+*
+* Redistributions of source code must retain the above copyright notice, this
+* list of conditions and the following disclaimer.
+*
+* Redistributions in binary form must reproduce the above copyright notice, this
+* list of conditions and the following disclaimer in the documentation and/or
+* other materials provided with the distribution.
+*
+* Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+* contributors may be used to endorse or promote products derived from this software
+* without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+* DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+* FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+* DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+* OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+* USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*
+* ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#include "MoabH5mWriter.h"
+
+#include <algorithm>
+
+namespace
+{
+// Entity type names in MOAB's EntityType order. They make up the elemtypes enumeration.
+const char* const k_EntityTypeNames[] = {"Vertex", "Edge", "Tri", "Quad", "Polygon", "Tet", "Pyramid", "Prism", "Knife", "Hex", "Polyhedron", "EntitySet"};
+const int k_NumEntityTypes = 12;
+
+// MOAB's TagType values for sparse and dense tag storage
+const int k_SparseTagClass = 1;
+const int k_DenseTagClass = 2;
+
+// Attribute of /tstt that identifies the settings and data the mesh of the file came from
+const char* const k_FingerprintAttributeName = "mesh_fingerprint";
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+hid_t CreateTagFileType(hid_t memType, int numComponents)
+{
+  if(numComponents > 1)
+  {
+    hsize_t arrayDims[1] = {static_cast<hsize_t>(numComponents)};
+    return H5Tarray_create2(memType, 1, arrayDims);
+  }
+  return H5Tcopy(memType);
+}
+} // namespace
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+MoabH5mWriter::MoabH5mWriter() = default;
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+MoabH5mWriter::~MoabH5mWriter()
+{
+  closeFile();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+std::string MoabH5mWriter::NodeGroupPath()
+{
+  return "/tstt/nodes";
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+std::string MoabH5mWriter::ElementGroupPath(const std::string& groupName)
+{
+  return "/tstt/elements/" + groupName;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+std::string MoabH5mWriter::ElementGroupName(EntityType type, int nodesPerElement)
+{
+  return std::string(k_EntityTypeNames[static_cast<int>(type)]) + std::to_string(nodesPerElement);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool MoabH5mWriter::IsFilterAvailable(int filterId)
+{
+  if(filterId <= 0 || H5Zfilter_avail(static_cast<H5Z_filter_t>(filterId)) <= 0)
+  {
+    return false;
+  }
+  unsigned int config = 0;
+  if(H5Zget_filter_info(static_cast<H5Z_filter_t>(filterId), &config) < 0)
+  {
+    return false;
+  }
+  return (config & H5Z_FILTER_CONFIG_ENCODE_ENABLED) != 0;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void MoabH5mWriter::setCompression(size_t chunkRows, bool shuffle, int deflateLevel, int filterId)
+{
+  m_ChunkRows = chunkRows;
+  m_Shuffle = shuffle;
+  m_DeflateLevel = deflateLevel;
+  m_FilterId = filterId;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int MoabH5mWriter::openFile(const std::string& filePath)
+{
+  closeFile();
+
+  m_FileId = H5Fcreate(filePath.c_str(), H5F_ACC_TRUNC, H5P_DEFAULT, H5P_DEFAULT);
+  if(m_FileId < 0)
+  {
+    return -1;
+  }
+
+  if(ensureGroup("/tstt") < 0 || ensureGroup("/tstt/nodes") < 0 || ensureGroup("/tstt/elements") < 0 || ensureGroup("/tstt/sets") < 0 || ensureGroup("/tstt/tags") < 0)
+  {
+    return -2;
+  }
+
+  // Element groups reference this dictionary through their element_type attribute
+  m_ElemTypesId = H5Tenum_create(H5T_NATIVE_UCHAR);
+  for(int i = 0; i < k_NumEntityTypes; i++)
+  {
+    unsigned char value = static_cast<unsigned char>(i);
+    if(H5Tenum_insert(m_ElemTypesId, k_EntityTypeNames[i], &value) < 0)
+    {
+      return -3;
+    }
+  }
+  if(H5Tcommit2(m_FileId, "/tstt/elemtypes", m_ElemTypesId, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT) < 0)
+  {
+    return -3;
+  }
+
+  m_NumNodes = 0;
+  m_NodeStartId = 1;
+  m_NextId = 1;
+  m_SetStartId = -1;
+  return 0;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int MoabH5mWriter::reopenFile(const std::string& filePath, uint64_t fingerprint)
+{
+  closeFile();
+
+  // A missing file or one that is not HDF5 is an expected outcome, not an error to report
+  H5E_BEGIN_TRY
+  {
+    m_FileId = H5Fopen(filePath.c_str(), H5F_ACC_RDWR, H5P_DEFAULT);
+  }
+  H5E_END_TRY;
+  if(m_FileId < 0)
+  {
+    return -1;
+  }
+
+  uint64_t fileFingerprint = 0;
+  uint64_t maxId = 0;
+  if(readTsttAttribute(k_FingerprintAttributeName, fileFingerprint) < 0 || fileFingerprint != fingerprint || readTsttAttribute("max_id", maxId) < 0)
+  {
+    H5Fclose(m_FileId);
+    m_FileId = -1;
+    return -2;
+  }
+
+  if(H5Adelete_by_name(m_FileId, "/tstt", k_FingerprintAttributeName, H5P_DEFAULT) < 0)
+  {
+    H5Fclose(m_FileId);
+    m_FileId = -1;
+    return -3;
+  }
+
+  // No entities are added, so max_id is written back unchanged when the file is closed
+  m_NextId = static_cast<int64_t>(maxId) + 1;
+  return 0;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int MoabH5mWriter::writeFingerprint(uint64_t fingerprint)
+{
+  return writeTsttAttribute(k_FingerprintAttributeName, fingerprint);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int MoabH5mWriter::closeFile()
+{
+  if(m_FileId < 0)
+  {
+    return 0;
+  }
+
+  // max_id is the largest file id handed out so far
+  int err = writeTsttAttribute("max_id", static_cast<uint64_t>(m_NextId - 1));
+
+  for(auto& tagData : m_TagData)
+  {
+    H5Dclose(tagData.second);
+  }
+  m_TagData.clear();
+
+  for(auto& tag : m_Tags)
+  {
+    H5Tclose(tag.second.fileType);
+    H5Tclose(tag.second.memType);
+  }
+  m_Tags.clear();
+
+  for(auto& group : m_ElementGroups)
+  {
+    H5Dclose(group.second.connectivityId);
+  }
+  m_ElementGroups.clear();
+
+  if(m_SetListId >= 0)
+  {
+    H5Dclose(m_SetListId);
+    m_SetListId = -1;
+  }
+  if(m_SetContentsId >= 0)
+  {
+    H5Dclose(m_SetContentsId);
+    m_SetContentsId = -1;
+  }
+
+  if(m_NodesId >= 0)
+  {
+    H5Dclose(m_NodesId);
+    m_NodesId = -1;
+  }
+  if(m_ElemTypesId >= 0)
+  {
+    H5Tclose(m_ElemTypesId);
+    m_ElemTypesId = -1;
+  }
+
+  if(H5Fclose(m_FileId) < 0)
+  {
+    err = -1;
+  }
+  m_FileId = -1;
+
+  return err;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool MoabH5mWriter::isOpen() const
+{
+  return m_FileId >= 0;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int MoabH5mWriter::createNodes(size_t numNodes)
+{
+  // Node ids must precede element ids, so the nodes have to be created first
+  if(m_FileId < 0 || m_NodesId >= 0 || !m_ElementGroups.empty() || m_SetListId >= 0)
+  {
+    return -1;
+  }
+
+  m_NodesId = createDataset("/tstt/nodes/coordinates", H5T_IEEE_F64LE, numNodes, 3, true);
+  if(m_NodesId < 0)
+  {
+    return -2;
+  }
+
+  m_NumNodes = numNodes;
+  m_NodeStartId = m_NextId;
+  m_NextId += static_cast<int64_t>(numNodes);
+
+  return writeStartId(m_NodesId, m_NodeStartId);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int MoabH5mWriter::writeNodes(size_t offset, size_t count, const double* xyz)
+{
+  if(m_NodesId < 0)
+  {
+    return -1;
+  }
+  return writeRows(m_NodesId, H5T_NATIVE_DOUBLE, offset, count, xyz);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int64_t MoabH5mWriter::getNodeStartId() const
+{
+  return m_NodeStartId;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+std::string MoabH5mWriter::createElements(EntityType type, int nodesPerElement, size_t numElements)
+{
+  int typeIndex = static_cast<int>(type);
+  if(m_FileId < 0 || m_SetListId >= 0 || typeIndex <= 0 || typeIndex >= static_cast<int>(EntityType::EntitySet) || nodesPerElement <= 0)
+  {
+    return std::string();
+  }
+
+  std::string groupName = ElementGroupName(type, nodesPerElement);
+  if(m_ElementGroups.find(groupName) != m_ElementGroups.end())
+  {
+    return std::string();
+  }
+
+  std::string groupPath = ElementGroupPath(groupName);
+  hid_t groupId = H5Gcreate2(m_FileId, groupPath.c_str(), H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT);
+  if(groupId < 0)
+  {
+    return std::string();
+  }
+
+  unsigned char typeValue = static_cast<unsigned char>(typeIndex);
+  hid_t scalarId = H5Screate(H5S_SCALAR);
+  hid_t attrId = H5Acreate2(groupId, "element_type", m_ElemTypesId, scalarId, H5P_DEFAULT, H5P_DEFAULT);
+  herr_t err = (attrId < 0) ? -1 : H5Awrite(attrId, m_ElemTypesId, &typeValue);
+  if(attrId >= 0)
+  {
+    H5Aclose(attrId);
+  }
+  H5Sclose(scalarId);
+
+  H5Gclose(groupId);
+
+  ElementGroup group;
+  if(err >= 0)
+  {
+    group.connectivityId = createDataset(groupPath + "/connectivity", H5T_STD_I64LE, numElements, static_cast<size_t>(nodesPerElement), true);
+  }
+
+  if(group.connectivityId < 0)
+  {
+    return std::string();
+  }
+
+  group.nodesPerElement = nodesPerElement;
+  group.count = numElements;
+  group.startId = m_NextId;
+  m_NextId += static_cast<int64_t>(numElements);
+
+  if(writeStartId(group.connectivityId, group.startId) < 0)
+  {
+    H5Dclose(group.connectivityId);
+    return std::string();
+  }
+
+  m_ElementGroups[groupName] = group;
+  return groupName;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int MoabH5mWriter::writeConnectivity(const std::string& groupName, size_t offset, size_t count, const int64_t* fileIds)
+{
+  auto iter = m_ElementGroups.find(groupName);
+  if(iter == m_ElementGroups.end())
+  {
+    return -1;
+  }
+  return writeRows(iter->second.connectivityId, H5T_NATIVE_INT64, offset, count, fileIds);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int64_t MoabH5mWriter::getElementStartId(const std::string& groupName) const
+{
+  auto iter = m_ElementGroups.find(groupName);
+  if(iter == m_ElementGroups.end())
+  {
+    return -1;
+  }
+  return iter->second.startId;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int MoabH5mWriter::createDenseTag(const std::string& tagName, hid_t memType, int numComponents)
+{
+  return createTag(tagName, memType, numComponents, k_DenseTagClass);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int MoabH5mWriter::createDenseTagData(const std::string& entityGroupPath, const std::string& tagName, size_t count)
+{
+  auto tagIter = m_Tags.find(tagName);
+  if(tagIter == m_Tags.end())
+  {
+    return -1;
+  }
+
+  std::string tagsPath = entityGroupPath + "/tags";
+  if(ensureGroup(tagsPath) < 0)
+  {
+    return -2;
+  }
+
+  std::string dataPath = tagsPath + "/" + tagName;
+  if(m_TagData.find(dataPath) != m_TagData.end())
+  {
+    return -3;
+  }
+
+  hid_t dataId = createDataset(dataPath, tagIter->second.fileType, count, 0, true);
+  if(dataId < 0)
+  {
+    return -4;
+  }
+
+  m_TagData[dataPath] = dataId;
+  return 0;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int MoabH5mWriter::openDenseTagData(const std::string& entityGroupPath, const std::string& tagName, hid_t memType, int numComponents, size_t count)
+{
+  std::string dataPath = entityGroupPath + "/tags/" + tagName;
+  if(m_FileId < 0 || numComponents <= 0 || m_Tags.find(tagName) != m_Tags.end() || m_TagData.find(dataPath) != m_TagData.end())
+  {
+    return -1;
+  }
+
+  hid_t dataId = -1;
+  H5E_BEGIN_TRY
+  {
+    dataId = H5Dopen2(m_FileId, dataPath.c_str(), H5P_DEFAULT);
+  }
+  H5E_END_TRY;
+  if(dataId < 0)
+  {
+    return -2;
+  }
+
+  Tag tag;
+  tag.fileType = CreateTagFileType(memType, numComponents);
+  tag.memType = H5Tcopy(tag.fileType);
+
+  // The values must fit the dataset exactly since nothing else in the file changes
+  hid_t dataTypeId = H5Dget_type(dataId);
+  hid_t spaceId = H5Dget_space(dataId);
+  hsize_t dims[2] = {0, 0};
+  bool matches = H5Tequal(dataTypeId, tag.fileType) > 0 && H5Sget_simple_extent_ndims(spaceId) == 1 && H5Sget_simple_extent_dims(spaceId, dims, nullptr) >= 0 &&
+                 dims[0] == static_cast<hsize_t>(count);
+  H5Sclose(spaceId);
+  H5Tclose(dataTypeId);
+
+  // Chunks are cached as for new datasets, so blocks that split a chunk do not compress it twice
+  hid_t createPropsId = H5Dget_create_plist(dataId);
+  if(matches && H5Pget_layout(createPropsId) == H5D_CHUNKED)
+  {
+    hsize_t chunkDims[1] = {0};
+    H5Pget_chunk(createPropsId, 1, chunkDims);
+    size_t chunkBytes = static_cast<size_t>(chunkDims[0]) * H5Tget_size(tag.fileType);
+    hid_t accessPropsId = H5Pcreate(H5P_DATASET_ACCESS);
+    H5Pset_chunk_cache(accessPropsId, 521, std::max<size_t>(2 * chunkBytes, 1024 * 1024), 1.0);
+    H5Dclose(dataId);
+    dataId = H5Dopen2(m_FileId, dataPath.c_str(), accessPropsId);
+    H5Pclose(accessPropsId);
+  }
+  H5Pclose(createPropsId);
+
+  if(!matches || dataId < 0)
+  {
+    if(dataId >= 0)
+    {
+      H5Dclose(dataId);
+    }
+    H5Tclose(tag.fileType);
+    H5Tclose(tag.memType);
+    return -3;
+  }
+
+  m_Tags[tagName] = tag;
+  m_TagData[dataPath] = dataId;
+  return 0;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int MoabH5mWriter::writeDenseTagData(const std::string& entityGroupPath, const std::string& tagName, size_t offset, size_t count, const void* data)
+{
+  auto tagIter = m_Tags.find(tagName);
+  auto dataIter = m_TagData.find(entityGroupPath + "/tags/" + tagName);
+  if(tagIter == m_Tags.end() || dataIter == m_TagData.end())
+  {
+    return -1;
+  }
+  return writeRows(dataIter->second, tagIter->second.memType, offset, count, data);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int MoabH5mWriter::createSets(size_t numSets, size_t contentsLength)
+{
+  // Set ids follow every node and element id, so no entities can be added afterwards
+  if(m_FileId < 0 || m_SetListId >= 0)
+  {
+    return -1;
+  }
+
+  m_SetListId = createDataset("/tstt/sets/list", H5T_STD_I64LE, numSets, 4);
+  if(m_SetListId < 0)
+  {
+    return -2;
+  }
+  m_SetContentsId = createDataset("/tstt/sets/contents", H5T_STD_I64LE, contentsLength, 0);
+  if(m_SetContentsId < 0)
+  {
+    return -2;
+  }
+
+  m_SetStartId = m_NextId;
+  m_NextId += static_cast<int64_t>(numSets);
+
+  return writeStartId(m_SetListId, m_SetStartId);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int MoabH5mWriter::writeSetList(size_t offset, size_t count, const int64_t* rows)
+{
+  if(m_SetListId < 0)
+  {
+    return -1;
+  }
+  return writeRows(m_SetListId, H5T_NATIVE_INT64, offset, count, rows);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int MoabH5mWriter::writeSetContents(size_t offset, size_t count, const int64_t* values)
+{
+  if(m_SetContentsId < 0)
+  {
+    return -1;
+  }
+  return writeRows(m_SetContentsId, H5T_NATIVE_INT64, offset, count, values);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int64_t MoabH5mWriter::getSetStartId() const
+{
+  return m_SetStartId;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int MoabH5mWriter::createSparseTag(const std::string& tagName, hid_t memType, int numComponents, size_t count)
+{
+  int err = createTag(tagName, memType, numComponents, k_SparseTagClass);
+  if(err < 0)
+  {
+    return err;
+  }
+
+  std::string tagPath = "/tstt/tags/" + tagName;
+  hid_t idsId = createDataset(tagPath + "/id_list", H5T_STD_I64LE, count, 0, true);
+  if(idsId < 0)
+  {
+    return -4;
+  }
+  m_TagData[tagPath + "/id_list"] = idsId;
+
+  hid_t valuesId = createDataset(tagPath + "/values", m_Tags[tagName].fileType, count, 0, true);
+  if(valuesId < 0)
+  {
+    return -4;
+  }
+  m_TagData[tagPath + "/values"] = valuesId;
+
+  return 0;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int MoabH5mWriter::writeSparseTagData(const std::string& tagName, size_t offset, size_t count, const int64_t* fileIds, const void* data)
+{
+  std::string tagPath = "/tstt/tags/" + tagName;
+  auto tagIter = m_Tags.find(tagName);
+  auto idsIter = m_TagData.find(tagPath + "/id_list");
+  auto valuesIter = m_TagData.find(tagPath + "/values");
+  if(tagIter == m_Tags.end() || idsIter == m_TagData.end() || valuesIter == m_TagData.end())
+  {
+    return -1;
+  }
+
+  int err = writeRows(idsIter->second, H5T_NATIVE_INT64, offset, count, fileIds);
+  if(err < 0)
+  {
+    return err;
+  }
+  return writeRows(valuesIter->second, tagIter->second.memType, offset, count, data);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int MoabH5mWriter::writeRows(hid_t datasetId, hid_t memType, size_t offset, size_t count, const void* data)
+{
+  if(count == 0)
+  {
+    return 0;
+  }
+
+  hid_t fileSpaceId = H5Dget_space(datasetId);
+  if(fileSpaceId < 0)
+  {
+    return -1;
+  }
+
+  int rank = H5Sget_simple_extent_ndims(fileSpaceId);
+  hsize_t dims[2] = {0, 0};
+  if(rank < 1 || rank > 2 || H5Sget_simple_extent_dims(fileSpaceId, dims, nullptr) < 0 || offset + count > dims[0])
+  {
+    H5Sclose(fileSpaceId);
+    return -2;
+  }
+
+  hsize_t start[2] = {static_cast<hsize_t>(offset), 0};
+  hsize_t block[2] = {static_cast<hsize_t>(count), dims[1]};
+  herr_t err = H5Sselect_hyperslab(fileSpaceId, H5S_SELECT_SET, start, nullptr, block, nullptr);
+
+  hid_t memSpaceId = H5Screate_simple(rank, block, nullptr);
+  if(err >= 0)
+  {
+    err = H5Dwrite(datasetId, memType, memSpaceId, fileSpaceId, H5P_DEFAULT, data);
+  }
+  H5Sclose(memSpaceId);
+  H5Sclose(fileSpaceId);
+
+  return err < 0 ? -3 : 0;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int MoabH5mWriter::writeStartId(hid_t objectId, int64_t startId)
+{
+  hid_t scalarId = H5Screate(H5S_SCALAR);
+  hid_t attrId = H5Acreate2(objectId, "start_id", H5T_STD_I64LE, scalarId, H5P_DEFAULT, H5P_DEFAULT);
+  herr_t err = (attrId < 0) ? -1 : H5Awrite(attrId, H5T_NATIVE_INT64, &startId);
+  if(attrId >= 0)
+  {
+    H5Aclose(attrId);
+  }
+  H5Sclose(scalarId);
+  return err < 0 ? -1 : 0;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int MoabH5mWriter::ensureGroup(const std::string& path)
+{
+  htri_t exists = H5Lexists(m_FileId, path.c_str(), H5P_DEFAULT);
+  if(exists > 0)
+  {
+    return 0;
+  }
+
+  hid_t groupId = H5Gcreate2(m_FileId, path.c_str(), H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT);
+  if(groupId < 0)
+  {
+    return -1;
+  }
+  H5Gclose(groupId);
+  return 0;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int MoabH5mWriter::createTag(const std::string& tagName, hid_t memType, int numComponents, int tagClass)
+{
+  if(m_FileId < 0 || numComponents <= 0 || m_Tags.find(tagName) != m_Tags.end())
+  {
+    return -1;
+  }
+
+  std::string tagPath = "/tstt/tags/" + tagName;
+  hid_t groupId = H5Gcreate2(m_FileId, tagPath.c_str(), H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT);
+  if(groupId < 0)
+  {
+    return -2;
+  }
+
+  hid_t scalarId = H5Screate(H5S_SCALAR);
+  hid_t attrId = H5Acreate2(groupId, "class", H5T_NATIVE_INT, scalarId, H5P_DEFAULT, H5P_DEFAULT);
+  herr_t err = (attrId < 0) ? -1 : H5Awrite(attrId, H5T_NATIVE_INT, &tagClass);
+  if(attrId >= 0)
+  {
+    H5Aclose(attrId);
+  }
+  H5Sclose(scalarId);
+
+  Tag tag;
+  tag.fileType = CreateTagFileType(memType, numComponents);
+  tag.memType = H5Tcopy(tag.fileType);
+
+  if(err >= 0)
+  {
+    err = H5Tcommit2(groupId, "type", tag.fileType, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT);
+  }
+  H5Gclose(groupId);
+
+  if(err < 0)
+  {
+    H5Tclose(tag.fileType);
+    H5Tclose(tag.memType);
+    return -3;
+  }
+
+  m_Tags[tagName] = tag;
+  return 0;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int MoabH5mWriter::writeTsttAttribute(const char* name, uint64_t value)
+{
+  hid_t tsttId = H5Gopen2(m_FileId, "/tstt", H5P_DEFAULT);
+  if(tsttId < 0)
+  {
+    return -1;
+  }
+
+  hid_t spaceId = H5Screate(H5S_SCALAR);
+  hid_t attrId = H5Aexists(tsttId, name) > 0 ? H5Aopen(tsttId, name, H5P_DEFAULT) : H5Acreate2(tsttId, name, H5T_STD_U64LE, spaceId, H5P_DEFAULT, H5P_DEFAULT);
+  int err = 0;
+  if(attrId < 0 || H5Awrite(attrId, H5T_NATIVE_UINT64, &value) < 0)
+  {
+    err = -2;
+  }
+  if(attrId >= 0)
+  {
+    H5Aclose(attrId);
+  }
+  H5Sclose(spaceId);
+  H5Gclose(tsttId);
+  return err;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int MoabH5mWriter::readTsttAttribute(const char* name, uint64_t& value)
+{
+  hid_t tsttId = -1;
+  H5E_BEGIN_TRY
+  {
+    tsttId = H5Gopen2(m_FileId, "/tstt", H5P_DEFAULT);
+  }
+  H5E_END_TRY;
+  if(tsttId < 0)
+  {
+    return -1;
+  }
+
+  int err = -2;
+  if(H5Aexists(tsttId, name) > 0)
+  {
+    hid_t attrId = H5Aopen(tsttId, name, H5P_DEFAULT);
+    if(attrId >= 0)
+    {
+      err = (H5Aread(attrId, H5T_NATIVE_UINT64, &value) < 0) ? -3 : 0;
+      H5Aclose(attrId);
+    }
+  }
+  H5Gclose(tsttId);
+  return err;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+hid_t MoabH5mWriter::createDataset(const std::string& path, hid_t fileType, size_t rows, size_t columns, bool compressed)
+{
+  int rank = columns > 0 ? 2 : 1;
+  hsize_t dims[2] = {static_cast<hsize_t>(rows), static_cast<hsize_t>(columns)};
+  hid_t spaceId = H5Screate_simple(rank, dims, nullptr);
+
+  // Chunks must not be larger than a fixed size dataset, and empty datasets are left contiguous
+  hid_t createPropsId = H5P_DEFAULT;
+  hid_t accessPropsId = H5P_DEFAULT;
+  if(compressed && m_ChunkRows > 0 && rows > 0)
+  {
+    hsize_t chunkDims[2] = {static_cast<hsize_t>(std::min(m_ChunkRows, rows)), dims[1]};
+    createPropsId = H5Pcreate(H5P_DATASET_CREATE);
+    H5Pset_chunk(createPropsId, rank, chunkDims);
+    if(m_Shuffle)
+    {
+      H5Pset_shuffle(createPropsId);
+    }
+    if(m_DeflateLevel > 0)
+    {
+      H5Pset_deflate(createPropsId, static_cast<unsigned>(m_DeflateLevel));
+    }
+    if(m_FilterId > 0)
+    {
+      H5Pset_filter(createPropsId, static_cast<H5Z_filter_t>(m_FilterId), H5Z_FLAG_MANDATORY, 0, nullptr);
+    }
+
+    // Callers write blocks that need not line up with the chunks. A cache that holds the two
+    // chunks a block boundary can split keeps partial chunks from being compressed, written and
+    // read back before the next block completes them.
+    size_t chunkBytes = static_cast<size_t>(chunkDims[0]) * std::max<size_t>(columns, 1) * H5Tget_size(fileType);
+    accessPropsId = H5Pcreate(H5P_DATASET_ACCESS);
+    H5Pset_chunk_cache(accessPropsId, 521, std::max<size_t>(2 * chunkBytes, 1024 * 1024), 1.0);
+  }
+
+  hid_t dataId = H5Dcreate2(m_FileId, path.c_str(), fileType, spaceId, H5P_DEFAULT, createPropsId, accessPropsId);
+  if(createPropsId != H5P_DEFAULT)
+  {
+    H5Pclose(createPropsId);
+    H5Pclose(accessPropsId);
+  }
+  H5Sclose(spaceId);
+  return dataId;
+}
@@ -0,0 +1,426 @@
+/* ============================================================================
+* Copyright (c) 2018 BlueQuartz Software, LLC
+*
+* Redistribution and use in source and binary forms, with or without modification,
+* are permitted provided that the following conditions are met:
+*
+* Redistributions of source code must retain the above copyright notice, this
+* list of conditions and the following disclaimer.
+*
+* Redistributions in binary form must reproduce the above copyright notice, this
+* list of conditions and the following disclaimer in the documentation and/or
+* other materials provided with the distribution.
+*
+* Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+* contributors may be used to endorse or promote products derived from this software
+* without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+* DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+* FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+* DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+* OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+* USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*
+* ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#pragma once
+
+#include <cstdint>
+#include <map>
+#include <string>
+
+#include <hdf5.h>
+
+/**
+ * @brief The MoabH5mWriter class writes meshes in the native MOAB HDF5 ("tstt") layout
+ * without going through a MOAB or SMTK instance. Every dataset is created with its final
+ * size up front and then filled with hyperslab writes, so callers can stream nodes,
+ * connectivity and tag values in blocks of any size and in any order.
+ *
+ * Entity ids are assigned in creation order starting at 1: nodes first, then each
+ * element group, then the entity sets. The file layout follows the one MOAB's WriteHDF5 produces:
+ *
+ *   /tstt                                    (max_id and optional mesh_fingerprint attributes)
+ *   /tstt/elemtypes                          (committed element type enumeration)
+ *   /tstt/nodes/coordinates                  (N x 3 doubles, start_id attribute)
+ *   /tstt/nodes/tags/<tag>                   (dense node tag values)
+ *   /tstt/elements/<Group>/connectivity      (M x nodes per element ids, start_id attribute)
+ *   /tstt/elements/<Group>/tags/<tag>        (dense element tag values)
+ *   /tstt/sets/list                          (S x 4 set descriptions, start_id attribute)
+ *   /tstt/sets/contents                      (set contents for every set, back to back)
+ *   /tstt/tags/<tag>                         (tag class attribute and committed type)
+ *   /tstt/tags/<tag>/id_list, values         (sparse tag entity ids and values)
+ *
+ * The coordinate, connectivity and tag datasets can be chunked and compressed with
+ * setCompression(). MOAB reads them through HDF5, so any filter the reading HDF5 library
+ * can decode is transparent.
+ *
+ * A file can carry a fingerprint of the settings and data its mesh was generated from. When a
+ * later export has the same fingerprint, reopenFile() and openDenseTagData() let it overwrite
+ * the dense tag values in place and keep the nodes, elements and sets already in the file.
+ */
+class MoabH5mWriter
+{
+public:
+  /**
+   * @brief The MOAB entity types, numbered as in MOAB's EntityType enumeration
+   */
+  enum class EntityType : int
+  {
+    Vertex = 0,
+    Edge = 1,
+    Tri = 2,
+    Quad = 3,
+    Polygon = 4,
+    Tet = 5,
+    Pyramid = 6,
+    Prism = 7,
+    Knife = 8,
+    Hex = 9,
+    Polyhedron = 10,
+    EntitySet = 11
+  };
+
+  /**
+   * @brief The set flag bits stored in the last column of /tstt/sets/list
+   */
+  enum SetFlag : int64_t
+  {
+    SetOwner = 0x1,   //!< The set tracks the sets that contain it
+    SetUnique = 0x2,  //!< The set holds each entity at most once (MESHSET_SET)
+    SetOrdered = 0x4, //!< The set preserves insertion order (MESHSET_ORDERED)
+    SetRange = 0x8    //!< The contents are stored as (start id, count) pairs
+  };
+
+  MoabH5mWriter();
+  virtual ~MoabH5mWriter();
+
+  /**
+   * @brief Returns the HDF5 path of the node group, for use with the dense tag methods
+   * @return
+   */
+  static std::string NodeGroupPath();
+
+  /**
+   * @brief Returns the HDF5 path of an element group, for use with the dense tag methods
+   * @param groupName Element group name such as "Hex8"
+   * @return
+   */
+  static std::string ElementGroupPath(const std::string& groupName);
+
+  /**
+   * @brief Returns the name of the element group createElements() creates for a type and
+   * number of nodes per element
+   * @param type
+   * @param nodesPerElement
+   * @return Group name such as "Hex8"
+   */
+  static std::string ElementGroupName(EntityType type, int nodesPerElement);
+
+  /**
+   * @brief Returns whether an HDF5 filter is registered with the HDF5 library, either built in
+   * or loaded as a plugin, and can encode data
+   * @param filterId
+   * @return
+   */
+  static bool IsFilterAvailable(int filterId);
+
+  /**
+   * @brief Sets how the coordinate, connectivity and tag datasets created afterwards are
+   * stored. A chunk size of 0 keeps them contiguous and uncompressed, which is the default.
+   * @param chunkRows Number of entities per chunk
+   * @param shuffle Apply the byte shuffle filter before the compressors
+   * @param deflateLevel Deflate (gzip) level from 1 to 9, or 0 for none
+   * @param filterId Id of an additional registered HDF5 filter applied last, or 0 for none
+   */
+  void setCompression(size_t chunkRows, bool shuffle, int deflateLevel, int filterId);
+
+  /**
+   * @brief Creates (or truncates) the file and writes the tstt skeleton
+   * @param filePath
+   * @return Negative value on error
+   */
+  int openFile(const std::string& filePath);
+
+  /**
+   * @brief Opens a file written earlier for updating its dense tag values. The file is only
+   * opened if it carries the given mesh fingerprint, which is removed until writeFingerprint()
+   * is called again so an interrupted update is never mistaken for a complete file.
+   * @param filePath
+   * @param fingerprint
+   * @return Negative value if the file does not exist, cannot be opened or holds another mesh
+   */
+  int reopenFile(const std::string& filePath, uint64_t fingerprint);
+
+  /**
+   * @brief Stores the fingerprint of the mesh in the file. Call it once the file is complete.
+   * @param fingerprint
+   * @return Negative value on error
+   */
+  int writeFingerprint(uint64_t fingerprint);
+
+  /**
+   * @brief Writes the max_id attribute and closes every open HDF5 object
+   * @return Negative value on error
+   */
+  int closeFile();
+
+  /**
+   * @brief Returns whether a file is currently open
+   * @return
+   */
+  bool isOpen() const;
+
+  /**
+   * @brief Creates the node coordinate dataset. Must be called before any element group is created.
+   * @param numNodes
+   * @return Negative value on error
+   */
+  int createNodes(size_t numNodes);
+
+  /**
+   * @brief Writes interleaved XYZ coordinates for nodes [offset, offset + count)
+   * @param offset
+   * @param count
+   * @param xyz
+   * @return Negative value on error
+   */
+  int writeNodes(size_t offset, size_t count, const double* xyz);
+
+  /**
+   * @brief Returns the file id of the first node
+   * @return
+   */
+  int64_t getNodeStartId() const;
+
+  /**
+   * @brief Creates an element group and its connectivity dataset
+   * @param type MOAB entity type of the elements
+   * @param nodesPerElement
+   * @param numElements
+   * @return The element group name (for example "Hex8") or an empty string on error
+   */
+  std::string createElements(EntityType type, int nodesPerElement, size_t numElements);
+
+  /**
+   * @brief Writes the connectivity of elements [offset, offset + count). The values are node file ids.
+   * @param groupName
+   * @param offset
+   * @param count
+   * @param fileIds
+   * @return Negative value on error
+   */
+  int writeConnectivity(const std::string& groupName, size_t offset, size_t count, const int64_t* fileIds);
+
+  /**
+   * @brief Returns the file id of the first element of a group
+   * @param groupName
+   * @return
+   */
+  int64_t getElementStartId(const std::string& groupName) const;
+
+  /**
+   * @brief Declares a dense tag in /tstt/tags. Multi-component tags are stored with an HDF5 array type.
+   * @param tagName
+   * @param memType Native HDF5 type of one component
+   * @param numComponents
+   * @return Negative value on error
+   */
+  int createDenseTag(const std::string& tagName, hid_t memType, int numComponents);
+
+  /**
+   * @brief Creates the dense value dataset of a declared tag on an entity group
+   * @param entityGroupPath Value of NodeGroupPath() or ElementGroupPath()
+   * @param tagName
+   * @param count Number of entities in the group
+   * @return Negative value on error
+   */
+  int createDenseTagData(const std::string& entityGroupPath, const std::string& tagName, size_t count);
+
+  /**
+   * @brief Opens the dense value dataset of a tag in a reopened file so its values can be
+   * overwritten with writeDenseTagData()
+   * @param entityGroupPath Value of NodeGroupPath() or ElementGroupPath()
+   * @param tagName
+   * @param memType Native HDF5 type of one component
+   * @param numComponents
+   * @param count Number of entities in the group
+   * @return Negative value if the dataset does not exist or has another type or size
+   */
+  int openDenseTagData(const std::string& entityGroupPath, const std::string& tagName, hid_t memType, int numComponents, size_t count);
+
+  /**
+   * @brief Writes tag values for entities [offset, offset + count) of a group straight from the caller's buffer
+   * @param entityGroupPath
+   * @param tagName
+   * @param offset
+   * @param count
+   * @param data Tuples in the tag's native memory type
+   * @return Negative value on error
+   */
+  int writeDenseTagData(const std::string& entityGroupPath, const std::string& tagName, size_t offset, size_t count, const void* data);
+
+  /**
+   * @brief Creates the entity set list and contents datasets. Must be called after every element group is created.
+   * @param numSets
+   * @param contentsLength Total number of values in the contents of all sets
+   * @return Negative value on error
+   */
+  int createSets(size_t numSets, size_t contentsLength);
+
+  /**
+   * @brief Writes the descriptions of sets [offset, offset + count). Each set is described by four
+   * values: the index of its last contents value, the index of its last child, the index of its
+   * last parent (all inclusive, -1 if there are none) and its SetFlag bits.
+   * @param offset
+   * @param count
+   * @param rows
+   * @return Negative value on error
+   */
+  int writeSetList(size_t offset, size_t count, const int64_t* rows);
+
+  /**
+   * @brief Writes values [offset, offset + count) of the set contents. Sets flagged with SetRange
+   * hold (start id, count) pairs, the other sets hold plain entity ids.
+   * @param offset
+   * @param count
+   * @param values
+   * @return Negative value on error
+   */
+  int writeSetContents(size_t offset, size_t count, const int64_t* values);
+
+  /**
+   * @brief Returns the file id of the first set
+   * @return
+   */
+  int64_t getSetStartId() const;
+
+  /**
+   * @brief Declares a sparse tag in /tstt/tags and creates its id and value datasets
+   * @param tagName
+   * @param memType Native HDF5 type of one component
+   * @param numComponents
+   * @param count Number of tagged entities
+   * @return Negative value on error
+   */
+  int createSparseTag(const std::string& tagName, hid_t memType, int numComponents, size_t count);
+
+  /**
+   * @brief Writes entries [offset, offset + count) of a sparse tag
+   * @param tagName
+   * @param offset
+   * @param count
+   * @param fileIds Ids of the tagged entities
+   * @param data Tuples in the tag's native memory type
+   * @return Negative value on error
+   */
+  int writeSparseTagData(const std::string& tagName, size_t offset, size_t count, const int64_t* fileIds, const void* data);
+
+protected:
+  /**
+   * @brief Writes rows [offset, offset + count) of a dataset whose first dimension indexes entities
+   * @param datasetId
+   * @param memType
+   * @param offset
+   * @param count
+   * @param data
+   * @return Negative value on error
+   */
+  int writeRows(hid_t datasetId, hid_t memType, size_t offset, size_t count, const void* data);
+
+  /**
+   * @brief Attaches a scalar start_id attribute to a dataset
+   * @param objectId
+   * @param startId
+   * @return Negative value on error
+   */
+  int writeStartId(hid_t objectId, int64_t startId);
+
+  /**
+   * @brief Writes a scalar unsigned 64 bit attribute of the /tstt group, creating it if needed
+   * @param name
+   * @param value
+   * @return Negative value on error
+   */
+  int writeTsttAttribute(const char* name, uint64_t value);
+
+  /**
+   * @brief Reads a scalar unsigned 64 bit attribute of the /tstt group
+   * @param name
+   * @param value
+   * @return Negative value if the attribute does not exist
+   */
+  int readTsttAttribute(const char* name, uint64_t& value);
+
+  /**
+   * @brief Creates a group if it does not exist yet
+   * @param path
+   * @return Negative value on error
+   */
+  int ensureGroup(const std::string& path);
+
+  /**
+   * @brief Creates the /tstt/tags group of a tag with its class attribute and committed type
+   * @param tagName
+   * @param memType
+   * @param numComponents
+   * @param tagClass MOAB TagType value
+   * @return Negative value on error
+   */
+  int createTag(const std::string& tagName, hid_t memType, int numComponents, int tagClass);
+
+  /**
+   * @brief Creates a one or two dimensional dataset
+   * @param path
+   * @param fileType
+   * @param rows
+   * @param columns 0 for a one dimensional dataset
+   * @param compressed Apply the chunking and filters set with setCompression()
+   * @return The dataset id or a negative value on error
+   */
+  hid_t createDataset(const std::string& path, hid_t fileType, size_t rows, size_t columns, bool compressed = false);
+
+private:
+  struct ElementGroup
+  {
+    hid_t connectivityId = -1;
+    int nodesPerElement = 0;
+    size_t count = 0;
+    int64_t startId = 0;
+  };
+
+  struct Tag
+  {
+    hid_t fileType = -1;
+    hid_t memType = -1;
+  };
+
+  hid_t m_FileId = -1;
+  hid_t m_ElemTypesId = -1;
+  hid_t m_NodesId = -1;
+  size_t m_NumNodes = 0;
+  int64_t m_NodeStartId = 1;
+  int64_t m_NextId = 1;
+  hid_t m_SetListId = -1;
+  hid_t m_SetContentsId = -1;
+  int64_t m_SetStartId = -1;
+  size_t m_ChunkRows = 0;
+  bool m_Shuffle = false;
+  int m_DeflateLevel = 0;
+  int m_FilterId = 0;
+
+  std::map<std::string, ElementGroup> m_ElementGroups;
+  std::map<std::string, Tag> m_Tags;
+  std::map<std::string, hid_t> m_TagData;
+
+public:
+  MoabH5mWriter(const MoabH5mWriter&) = delete;            // Copy Constructor Not Implemented
+  MoabH5mWriter(MoabH5mWriter&&) = delete;                 // Move Constructor Not Implemented
+  MoabH5mWriter& operator=(const MoabH5mWriter&) = delete; // Copy Assignment Not Implemented
+  MoabH5mWriter& operator=(MoabH5mWriter&&) = delete;      // Move Assignment Not Implemented
+};
@@ -0,0 +1,612 @@
+/* ============================================================================
+* Copyright (c) 2018 BlueQuartz Software, LLC
+*
+* Redistribution and use in source and binary forms, with or without modification,
+* are permitted provided that the following conditions are met:
+*
+* Redistributions of source code must retain the above copyright notice, this
+* list of conditions and the following disclaimer.
+*
+* Redistributions in binary form must reproduce the above copyright notice, this
+* list of conditions and the following disclaimer in the documentation and/or
+* other materials provided with the distribution.
+*
+* Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+* contributors may be used to endorse or promote products derived from this software
+* without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+* DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+* FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+* DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+* OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+* USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*
+* ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#include "NativeH5mExporter.h"
+
+#include <algorithm>
+#include <memory>
+
+#include <QtCore/QFileInfo>
+
+#include "BackgroundWriter.h"
+#include "ImageSlabMesher.h"
+#include "LabelCountingSort.h"
+#include "MeshPartitioner.h"
+#include "MeshReorderer.h"
+
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_for.h>
+#include <tbb/task_arena.h>
+#endif
+
+namespace
+{
+// Version of the mesh fingerprint. Change it whenever the layout of the native h5m files does,
+// so files written before are not reused.
+const uint32_t k_MeshFingerprintVersion = 1;
+
+// Size of the blocks that large arrays are hashed in, in parallel
+const size_t k_HashBlockBytes = 1024 * 1024;
+
+const uint64_t k_FnvOffsetBasis = 14695981039346656037ull;
+const uint64_t k_FnvPrime = 1099511628211ull;
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+uint64_t HashBytes(const void* data, size_t size, uint64_t hash)
+{
+  const uint8_t* bytes = static_cast<const uint8_t*>(data);
+  for(size_t i = 0; i < size; i++)
+  {
+    hash = (hash ^ bytes[i]) * k_FnvPrime;
+  }
+  return hash;
+}
+
+/**
+ * @brief Hashes the blocks of an array independently of each other
+ */
+class HashBlocksImpl
+{
+public:
+  HashBlocksImpl(const uint8_t* data, size_t size, std::vector<uint64_t>& blockHashes)
+  : m_Data(data)
+  , m_Size(size)
+  , m_BlockHashes(blockHashes)
+  {
+  }
+
+  void convert(size_t start, size_t end) const
+  {
+    for(size_t b = start; b < end; b++)
+    {
+      size_t first = b * k_HashBlockBytes;
+      m_BlockHashes[b] = HashBytes(m_Data + first, std::min(k_HashBlockBytes, m_Size - first), k_FnvOffsetBasis);
+    }
+  }
+
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+  void operator()(const tbb::blocked_range<size_t>& r) const
+  {
+    convert(r.begin(), r.end());
+  }
+#endif
+
+private:
+  const uint8_t* m_Data;
+  size_t m_Size;
+  std::vector<uint64_t>& m_BlockHashes;
+};
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+uint64_t HashArray(const void* data, size_t size)
+{
+  std::vector<uint64_t> blockHashes((size + k_HashBlockBytes - 1) / k_HashBlockBytes, 0);
+  HashBlocksImpl impl(static_cast<const uint8_t*>(data), size, blockHashes);
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+  tbb::parallel_for(tbb::blocked_range<size_t>(0, blockHashes.size()), impl);
+#else
+  impl.convert(0, blockHashes.size());
+#endif
+  return HashBytes(blockHashes.data(), blockHashes.size() * sizeof(uint64_t), k_FnvOffsetBasis);
+}
+
+/**
+ * @brief Accumulates a 64 bit FNV-1a hash of the settings and data that a mesh is generated from
+ */
+class MeshFingerprint
+{
+public:
+  void add(const void* data, size_t size)
+  {
+    m_Hash = HashBytes(data, size, m_Hash);
+  }
+
+  template <typename T> void add(const T& value)
+  {
+    add(&value, sizeof(T));
+  }
+
+  void add(const std::string& value)
+  {
+    add(value.size());
+    add(value.data(), value.size());
+  }
+
+  uint64_t getValue() const
+  {
+    return m_Hash;
+  }
+
+private:
+  uint64_t m_Hash = k_FnvOffsetBasis;
+};
+
+/**
+ * @brief Gathers the values of one Z slab of a region from the arrays of several batch steps,
+ * each into its own part of a block buffer
+ */
+class GatherStepsImpl
+{
+public:
+  GatherStepsImpl(const ImageRegion& region, const std::vector<ExportTag>& tags, size_t zBegin, size_t zEnd, uint8_t* buffer, size_t stepBytes, std::vector<const void*>& values)
+  : m_Region(region)
+  , m_Tags(tags)
+  , m_ZBegin(zBegin)
+  , m_ZEnd(zEnd)
+  , m_Buffer(buffer)
+  , m_StepBytes(stepBytes)
+  , m_Values(values)
+  {
+  }
+
+  void convert(size_t start, size_t end) const
+  {
+    for(size_t s = start; s < end; s++)
+    {
+      const ExportTag& tag = m_Tags[s];
+      m_Values[s] = m_Region.gatherLayers(tag.array->getVoidPointer(0), tag.tupleBytes, m_ZBegin, m_ZEnd, m_Buffer + s * m_StepBytes);
+    }
+  }
+
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+  void operator()(const tbb::blocked_range<size_t>& r) const
+  {
+    convert(r.begin(), r.end());
+  }
+#endif
+
+private:
+  const ImageRegion& m_Region;
+  const std::vector<ExportTag>& m_Tags;
+  size_t m_ZBegin;
+  size_t m_ZEnd;
+  uint8_t* m_Buffer;
+  size_t m_StepBytes;
+  std::vector<const void*>& m_Values;
+};
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+uint64_t GetTagsFingerprint(uint64_t meshFingerprint, const std::vector<std::vector<ExportTag>>& tags)
+{
+  // A reused file must already hold a dataset of the same type for every tag
+  MeshFingerprint fingerprint;
+  fingerprint.add(meshFingerprint);
+  for(const std::vector<ExportTag>& stepTags : tags)
+  {
+    for(const ExportTag& tag : stepTags)
+    {
+      fingerprint.add(tag.file);
+      fingerprint.add(tag.name);
+      fingerprint.add(tag.array->getTypeAsString().toStdString());
+      fingerprint.add(tag.numComponents);
+    }
+  }
+  return fingerprint.getValue();
+}
+} // namespace
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+NativeH5mExporter::NativeH5mExporter(AbstractFilter* filter, const MeshExportSettings& settings)
+: MeshExporter(filter, settings)
+{
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+NativeH5mExporter::~NativeH5mExporter() = default;
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void NativeH5mExporter::write(const ImageGeom::Pointer& image, bool streaming)
+{
+  size_t dims[3] = {0, 0, 0};
+  float res[3] = {0.0f, 0.0f, 0.0f};
+  float origin[3] = {0.0f, 0.0f, 0.0f};
+
+  ImageRegion region = getRegion(image, dims, res, origin);
+
+  // A cropped or renumbered batch gathers the tag values of every step into one block buffer
+  size_t blockSteps = 1;
+  if(m_Settings.exportBatch && (m_Settings.cropToRegion || m_Settings.meshOrdering != static_cast<int>(MeshReorderer::Ordering::Natural)))
+  {
+    blockSteps = static_cast<size_t>(m_Settings.batchWeakPtrVectors.size());
+  }
+
+  ImageSlabMesher mesher(dims, res, origin);
+  size_t slabLayers = getSlabLayers(mesher, streaming, blockSteps);
+  if(slabLayers == 0)
+  {
+    return;
+  }
+
+  bool featurePartitions = (m_Settings.writePartitionSets && m_Settings.partitionStrategy == static_cast<int>(MeshPartitioner::Strategy::FeaturePreserving));
+  std::vector<int32_t> featureIdsBuffer;
+  const int32_t* featureIds = (m_Settings.writeFeatureSets || featurePartitions) ? gatherFeatureIds(region, featureIdsBuffer) : nullptr;
+
+  // Outside of batch mode the selected arrays are the only step. Every step is written with
+  // the same topology, into the output file or into a file of its own.
+  QVector<QVector<IDataArray::WeakPointer>> steps = m_Settings.exportBatch ? m_Settings.batchWeakPtrVectors : QVector<QVector<IDataArray::WeakPointer>>({m_Settings.selectedWeakPtrVector});
+  bool filePerStep = m_Settings.filePerStep;
+  QStringList outputFiles = getOutputFiles();
+
+  // The topology is shared by every selected array. Tag values go to the file straight from
+  // the memory of each array, or through a block buffer when a region of interest is cropped.
+  // A batch in one file tells its steps apart by the Data Container name after each tag name.
+  std::vector<std::vector<ExportTag>> tags(static_cast<size_t>(m_Settings.selectedArrayPaths.size()));
+  for(size_t i = 0; i < tags.size(); i++)
+  {
+    for(int s = 0; s < steps.size(); s++)
+    {
+      ExportTag tag;
+      tag.file = filePerStep ? static_cast<size_t>(s) : 0;
+      tag.name = m_Settings.selectedArrayPaths[static_cast<int>(i)].getDataArrayName().toStdString() + "_";
+      if(m_Settings.exportBatch && !filePerStep)
+      {
+        tag.name += m_Settings.batchDataContainerNames[s].toStdString();
+      }
+      tag.array = steps[s][static_cast<int>(i)].lock();
+      ExportTypeInfo typeInfo;
+      GetExportTypeInfo(tag.array->getTypeAsString(), typeInfo);
+      tag.hdf5Type = typeInfo.hdf5Type;
+      tag.numComponents = tag.array->getNumberOfComponents();
+      tag.tupleBytes = typeInfo.size * static_cast<size_t>(tag.numComponents);
+      tags[i].push_back(tag);
+    }
+  }
+
+  size_t numElements = mesher.getNumberOfElements();
+  size_t elementsPerLayer = mesher.getElementsPerLayer();
+  size_t numLayers = mesher.getNumberOfElementLayers();
+  std::string hexGroup = MoabH5mWriter::ElementGroupName(MoabH5mWriter::EntityType::Hex, 8);
+  std::string hexGroupPath = MoabH5mWriter::ElementGroupPath(hexGroup);
+
+  std::vector<std::unique_ptr<MoabH5mWriter>> writers(static_cast<size_t>(outputFiles.size()));
+  for(std::unique_ptr<MoabH5mWriter>& writer : writers)
+  {
+    writer = std::make_unique<MoabH5mWriter>();
+    applyCompression(*writer);
+  }
+
+  // When the files already hold the mesh of this export only their tag values are rewritten.
+  // The files are reused together or not at all.
+  uint64_t fingerprint = 0;
+  bool reuseMesh = false;
+  if(m_Settings.reuseUnchangedMesh)
+  {
+    fingerprint = GetTagsFingerprint(getMeshFingerprint(region, res, origin, featureIds), tags);
+    reuseMesh = true;
+    for(int w = 0; w < outputFiles.size() && reuseMesh; w++)
+    {
+      reuseMesh = QFileInfo::exists(outputFiles[w]) && writers[static_cast<size_t>(w)]->reopenFile(outputFiles[w].toStdString(), fingerprint) >= 0;
+    }
+    for(size_t i = 0; i < tags.size() && reuseMesh; i++)
+    {
+      for(const ExportTag& tag : tags[i])
+      {
+        reuseMesh = reuseMesh && writers[tag.file]->openDenseTagData(hexGroupPath, tag.name, tag.hdf5Type, tag.numComponents, numElements) >= 0;
+      }
+    }
+    if(reuseMesh)
+    {
+      notifyStatusMessage(QObject::tr("The mesh in the output file is unchanged; rewriting the tag values only"));
+    }
+    else
+    {
+      for(std::unique_ptr<MoabH5mWriter>& writer : writers)
+      {
+        writer->closeFile();
+      }
+    }
+  }
+
+  // A renumbered mesh is generated straight in its new order. Its tag values are gathered
+  // cell by cell, also when the rewritten tags of a reused file are the only output.
+  MeshReorderer reorderer(static_cast<MeshReorderer::Ordering>(m_Settings.meshOrdering));
+  orderMesh(reorderer, dims);
+  bool reordered = !reorderer.isNatural();
+  const size_t* elementOrder = reorderer.getElementOrder().data();
+  const size_t* nodeOrder = reorderer.getNodeOrder().data();
+  const int64_t* nodeIds = reorderer.getNodeIds().data();
+
+  // The Feature Ids are grouped and the cells partitioned before the file is created so a bad
+  // label leaves no partial file behind. The labels of a renumbered mesh are grouped in the new
+  // order, so every set still lists ascending element ids.
+  LabelCountingSort featureSorter;
+  LabelCountingSort partSorter;
+  std::vector<int32_t> permutedLabels;
+  if(!reuseMesh && m_Settings.writeFeatureSets)
+  {
+    const int32_t* setLabels = featureIds;
+    if(reordered)
+    {
+      PermuteValues(featureIds, reorderer.getElementOrder(), permutedLabels);
+      setLabels = permutedLabels.data();
+    }
+    if(!sortFeatureIds(featureSorter, setLabels, region.getNumberOfCells()))
+    {
+      return;
+    }
+  }
+  if(!reuseMesh && m_Settings.writePartitionSets)
+  {
+    MeshPartitioner partitioner(static_cast<MeshPartitioner::Strategy>(m_Settings.partitionStrategy), static_cast<size_t>(m_Settings.partitionCount));
+    bool partitioned = partitioner.executeGrid(dims, featureIds);
+    if(partitioned && reordered)
+    {
+      PermuteValues(partitioner.getParts().data(), reorderer.getElementOrder(), permutedLabels);
+    }
+    if(!sortPartitions(partSorter, reordered ? permutedLabels : partitioner.getParts(), partitioned))
+    {
+      return;
+    }
+  }
+
+  for(int w = 0; w < outputFiles.size() && !reuseMesh; w++)
+  {
+    if(writers[static_cast<size_t>(w)]->openFile(outputFiles[w].toStdString()) < 0)
+    {
+      QString ss = QObject::tr("Unable to create the output file '%1'.").arg(outputFiles[w]);
+      setErrorCondition(-101014, ss);
+      return;
+    }
+  }
+
+  // Every dataset is created up front. Once the blocks start flowing, HDF5 is only called
+  // from the writer thread. Nodes are created first so they receive the lowest file ids.
+  int err = 0;
+  for(size_t w = 0; w < writers.size() && err >= 0 && !reuseMesh; w++)
+  {
+    err = writers[w]->createNodes(mesher.getNumberOfNodes());
+    if(err >= 0)
+    {
+      err = (writers[w]->createElements(MoabH5mWriter::EntityType::Hex, 8, numElements) == hexGroup) ? 0 : -1;
+    }
+  }
+
+  size_t bufferBytes = std::max(mesher.getNodeBufferSize(slabLayers) * sizeof(double), mesher.getConnectivityBufferSize(slabLayers) * sizeof(int64_t));
+  for(size_t i = 0; i < tags.size() && err >= 0; i++)
+  {
+    for(size_t s = 0; s < tags[i].size() && err >= 0 && !reuseMesh; s++)
+    {
+      const ExportTag& tag = tags[i][s];
+      err = writers[tag.file]->createDenseTag(tag.name, tag.hdf5Type, tag.numComponents);
+      if(err >= 0)
+      {
+        err = writers[tag.file]->createDenseTagData(hexGroupPath, tag.name, numElements);
+      }
+    }
+    if(!region.isLayerContiguous() || reordered)
+    {
+      bufferBytes = std::max(bufferBytes, slabLayers * elementsPerLayer * tags[i][0].tupleBytes * tags[i].size());
+    }
+  }
+
+  // The progress counts the blocks as they are queued; the writer thread is at most the queue
+  // depth behind
+  double totalBytes = reuseMesh ? 0.0 : writers.size() * (3.0 * sizeof(double) * mesher.getNumberOfNodes() + 8.0 * sizeof(int64_t) * numElements);
+  for(const std::vector<ExportTag>& stepTags : tags)
+  {
+    totalBytes += static_cast<double>(stepTags.size() * numElements * stepTags[0].tupleBytes);
+  }
+  ExportProgress progress(m_Filter, totalBytes);
+
+  // Each block is generated by the worker threads while the previous blocks are written. A
+  // block of topology is written to the file of every step, and a block of tag values holds
+  // the slab of one array from every step, gathered in parallel.
+  // A reused file is only changed once its first block of tag values is queued
+  bool started = false;
+  bool finished = false;
+  if(err >= 0)
+  {
+    BackgroundWriter pipeline(WriteQueueDepth, bufferBytes);
+    auto produceBlocks = [&] {
+      bool queued = !getCancel();
+      started = queued;
+
+      size_t nodesPerLayer = mesher.getNodesPerLayer();
+      size_t numNodeLayers = mesher.getNumberOfNodeLayers();
+      for(size_t z = 0; z < numNodeLayers && queued && !reuseMesh; z += slabLayers)
+      {
+        size_t zEnd = std::min(z + slabLayers, numNodeLayers);
+        size_t offset = z * nodesPerLayer;
+        size_t count = (zEnd - z) * nodesPerLayer;
+        double* xyz = static_cast<double*>(pipeline.getBuffer());
+        if(reordered)
+        {
+          mesher.generateNodeList(nodeOrder + offset, count, xyz);
+        }
+        else
+        {
+          mesher.generateNodes(z, zEnd, xyz);
+        }
+        queued = pipeline.submit([&writers, offset, count, xyz] {
+          int result = 0;
+          for(size_t w = 0; w < writers.size() && result >= 0; w++)
+          {
+            result = writers[w]->writeNodes(offset, count, xyz);
+          }
+          return result;
+        });
+        queued = queued && progress.advance(QObject::tr("Writing nodes"), static_cast<double>(writers.size() * count * 3 * sizeof(double)));
+      }
+
+      int64_t firstNodeId = writers[0]->getNodeStartId();
+      for(size_t z = 0; z < numLayers && queued && !reuseMesh; z += slabLayers)
+      {
+        size_t zEnd = std::min(z + slabLayers, numLayers);
+        size_t offset = z * elementsPerLayer;
+        size_t count = (zEnd - z) * elementsPerLayer;
+        int64_t* connectivity = static_cast<int64_t*>(pipeline.getBuffer());
+        if(reordered)
+        {
+          mesher.generateElementConnectivity(elementOrder + offset, count, firstNodeId, connectivity, nodeIds);
+        }
+        else
+        {
+          mesher.generateConnectivity(z, zEnd, firstNodeId, connectivity);
+        }
+        queued = pipeline.submit([&writers, &hexGroup, offset, count, connectivity] {
+          int result = 0;
+          for(size_t w = 0; w < writers.size() && result >= 0; w++)
+          {
+            result = writers[w]->writeConnectivity(hexGroup, offset, count, connectivity);
+          }
+          return result;
+        });
+        queued = queued && progress.advance(QObject::tr("Writing connectivity"), static_cast<double>(writers.size() * count * 8 * sizeof(int64_t)));
+      }
+
+      for(size_t i = 0; i < tags.size() && queued; i++)
+      {
+        const std::vector<ExportTag>& stepTags = tags[i];
+        size_t stepBytes = slabLayers * elementsPerLayer * stepTags[0].tupleBytes;
+        QString stage = QObject::tr("Writing %1").arg(m_Settings.selectedArrayPaths[static_cast<int>(i)].getDataArrayName());
+
+        for(size_t z = 0; z < numLayers && queued; z += slabLayers)
+        {
+          size_t zEnd = std::min(z + slabLayers, numLayers);
+          size_t offset = z * elementsPerLayer;
+          size_t count = (zEnd - z) * elementsPerLayer;
+          uint8_t* buffer = static_cast<uint8_t*>(pipeline.getBuffer());
+          std::vector<const void*> values(stepTags.size(), nullptr);
+          if(reordered)
+          {
+            for(size_t s = 0; s < stepTags.size(); s++)
+            {
+              values[s] = GatherCells(region, stepTags[s].array->getVoidPointer(0), stepTags[s].tupleBytes, elementOrder + offset, count, buffer + s * stepBytes);
+            }
+          }
+          else
+          {
+            GatherStepsImpl impl(region, stepTags, z, zEnd, buffer, stepBytes, values);
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+            tbb::parallel_for(tbb::blocked_range<size_t>(0, stepTags.size()), impl);
+#else
+            impl.convert(0, stepTags.size());
+#endif
+          }
+          queued = pipeline.submit([&writers, &stepTags, &hexGroupPath, offset, count, values] {
+            int result = 0;
+            for(size_t s = 0; s < stepTags.size() && result >= 0; s++)
+            {
+              result = writers[stepTags[s].file]->writeDenseTagData(hexGroupPath, stepTags[s].name, offset, count, values[s]);
+            }
+            return result;
+          });
+          queued = queued && progress.advance(stage, static_cast<double>(stepTags.size() * count * stepTags[0].tupleBytes));
+        }
+      }
+      finished = queued;
+    };
+
+    // A batch may be held to fewer worker threads so several exports can share a node
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+    int numThreads = (m_Settings.exportBatch && m_Settings.batchThreadLimit > 0) ? m_Settings.batchThreadLimit : static_cast<int>(tbb::task_arena::automatic);
+    tbb::task_arena arena(numThreads);
+    arena.execute(produceBlocks);
+#else
+    produceBlocks();
+#endif
+
+    err = pipeline.finish();
+  }
+
+  // A cancelled export only closes its files, which execute() then removes
+  m_StoppedEarly = !finished && getCancel() && (started || !reuseMesh);
+  for(size_t w = 0; w < writers.size() && err >= 0 && !reuseMesh && finished; w++)
+  {
+    if(m_Settings.writeFeatureSets || m_Settings.writePartitionSets)
+    {
+      err = writeElementSets(*writers[w], getSetGroups(featureSorter, partSorter), writers[w]->getElementStartId(hexGroup));
+    }
+  }
+
+  // The fingerprint goes in last, so a file whose export failed is never reused
+  for(size_t w = 0; w < writers.size() && err >= 0 && m_Settings.reuseUnchangedMesh && finished; w++)
+  {
+    err = writers[w]->writeFingerprint(fingerprint);
+  }
+
+  bool closed = true;
+  for(std::unique_ptr<MoabH5mWriter>& writer : writers)
+  {
+    closed = (writer->closeFile() >= 0) && closed;
+  }
+  if(!closed || err < 0)
+  {
+    QString ss = QObject::tr("Unable to write MOAB mesh to the specified file.");
+    setErrorCondition(-101004, ss);
+    return;
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+uint64_t NativeH5mExporter::getMeshFingerprint(const ImageRegion& region, const float res[3], const float origin[3], const int32_t* featureIds) const
+{
+  size_t dims[3] = {0, 0, 0};
+  region.getDimensions(dims);
+
+  MeshFingerprint fingerprint;
+  fingerprint.add(k_MeshFingerprintVersion);
+  fingerprint.add(dims, sizeof(dims));
+  fingerprint.add(res, 3 * sizeof(float));
+  fingerprint.add(origin, 3 * sizeof(float));
+
+  // The storage settings apply to every dataset, and the sets follow the partition settings
+  // and the Feature Ids
+  fingerprint.add(m_Settings.compressOutput);
+  fingerprint.add(m_Settings.chunkSize);
+  fingerprint.add(m_Settings.shuffle);
+  fingerprint.add(m_Settings.deflateLevel);
+  fingerprint.add(m_Settings.hdf5FilterId);
+  fingerprint.add(m_Settings.writeFeatureSets);
+  fingerprint.add(m_Settings.writePartitionSets);
+  fingerprint.add(m_Settings.partitionCount);
+  fingerprint.add(m_Settings.partitionStrategy);
+  fingerprint.add(m_Settings.meshOrdering);
+  if(featureIds != nullptr)
+  {
+    fingerprint.add(HashArray(featureIds, region.getNumberOfCells() * sizeof(int32_t)));
+  }
+  return fingerprint.getValue();
+}
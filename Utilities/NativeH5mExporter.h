@@ -0,0 +1,75 @@
+/* ============================================================================
+* Copyright (c) 2018 BlueQuartz Software, LLC
+*
+* Redistribution and use in source and binary forms, with or without modification,
+* are permitted provided that the following conditions are met:
+*
+* Redistributions of source code must retain the above copyright notice, this
+* list of conditions and the following disclaimer.
+*
+* Redistributions in binary form must reproduce the above copyright notice, this
+* list of conditions and the following disclaimer in the documentation and/or
+* other materials provided with the distribution.
+*
+* Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+* contributors may be used to endorse or promote products derived from this software
+* without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+* DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+* FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+* DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+* OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+* USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*
+* ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#pragma once
+
+#include "MeshExporter.h"
+
+/**
+ * @brief The NativeH5mExporter class writes an ImageGeom as explicit Hex8 elements in the MOAB
+ * HDF5 layout through MoabH5mWriter, without going through VTK, SMTK or MOAB. The nodes and
+ * connectivity are generated in Z slabs on the calling thread and written by a writer thread,
+ * and the tag values are written straight from the selected arrays. In batch mode the topology
+ * is generated once and written with the tags of every step. When the output files already
+ * hold the same mesh, only the tag values are rewritten.
+ */
+class NativeH5mExporter : public MeshExporter
+{
+public:
+  NativeH5mExporter(AbstractFilter* filter, const MeshExportSettings& settings);
+  ~NativeH5mExporter() override;
+
+  /**
+   * @brief Writes the ImageGeom as explicit Hex8 elements with the Feature and partition sets
+   * @param image ImageGeom that holds the selected array
+   * @param streaming Generate the nodes and connectivity one Z slab at a time within the
+   * memory budget instead of all at once
+   */
+  void write(const ImageGeom::Pointer& image, bool streaming);
+
+protected:
+  /**
+   * @brief getMeshFingerprint Returns a hash of everything the nodes, elements and sets of a
+   * native h5m file depend on: the grid of the region, the storage settings, the set settings
+   * and the Feature Ids when the sets follow them
+   * @param region
+   * @param res Cell spacing
+   * @param origin Position of the first node of the region
+   * @param featureIds Feature Ids of the region cells, or nullptr when no sets depend on them
+   * @return
+   */
+  uint64_t getMeshFingerprint(const ImageRegion& region, const float res[3], const float origin[3], const int32_t* featureIds) const;
+
+public:
+  NativeH5mExporter(const NativeH5mExporter&) = delete;            // Copy Constructor Not Implemented
+  NativeH5mExporter(NativeH5mExporter&&) = delete;                 // Move Constructor Not Implemented
+  NativeH5mExporter& operator=(const NativeH5mExporter&) = delete; // Copy Assignment Not Implemented
+  NativeH5mExporter& operator=(NativeH5mExporter&&) = delete;      // Move Assignment Not Implemented
+};
@@ -0,0 +1,512 @@
+/* ============================================================================
+* Copyright (c) 2018 BlueQuartz Software, LLC
+*
+* Redistribution and use in source and binary forms, with or without modification,
+* are permitted provided that the following conditions are met:
+*
+* Redistributions of source code must retain the above copyright notice, this
+* list of conditions and the following disclaimer.
+*
+* Redistributions in binary form must reproduce the above copyright notice, this
+* list of conditions and the following disclaimer in the documentation and/or
+* other materials provided with the distribution.
+*
+* Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+* contributors may be used to endorse or promote products derived from this software
+* without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+* DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+* FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+* DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+* OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+* USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*
+* ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+
+#include "OctreeCoarsener.h"
+
+#include <algorithm>
+#include <limits>
+
+#include "SIMPLib/SIMPLib.h"
+
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+#include <tbb/parallel_sort.h>
+#endif
+
+namespace
+{
+const int32_t k_MixedLabel = std::numeric_limits<int32_t>::min();
+
+/**
+ * @brief The dimensions of a grid of aligned blocks
+ */
+struct BlockGrid
+{
+  size_t dims[3] = {0, 0, 0};
+
+  size_t size() const
+  {
+    return dims[0] * dims[1] * dims[2];
+  }
+
+  bool contains(size_t x, size_t y, size_t z) const
+  {
+    return x < dims[0] && y < dims[1] && z < dims[2];
+  }
+
+  size_t index(size_t x, size_t y, size_t z) const
+  {
+    return (z * dims[1] + y) * dims[0] + x;
+  }
+};
+
+/**
+ * @brief Corner offsets of a hexahedron in VTK/MOAB order, in units of the leaf size
+ */
+const int64_t k_HexCorners[8][3] = {{0, 0, 0}, {1, 0, 0}, {1, 1, 0}, {0, 1, 0}, {0, 0, 1}, {1, 0, 1}, {1, 1, 1}, {0, 1, 1}};
+} // namespace
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+OctreeCoarsener::OctreeCoarsener(const size_t dims[3], const float resolution[3], const float origin[3])
+{
+  for(size_t i = 0; i < 3; i++)
+  {
+    m_Dims[i] = dims[i];
+    m_Resolution[i] = resolution[i];
+    m_Origin[i] = origin[i];
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+OctreeCoarsener::~OctreeCoarsener() = default;
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void OctreeCoarsener::execute(const int32_t* labels, int maxLevel)
+{
+  m_Leaves.clear();
+  m_NodeIds.clear();
+  m_HangingNodes.clear();
+  m_HangingNodeParents.clear();
+
+  if(m_Dims[0] == 0 || m_Dims[1] == 0 || m_Dims[2] == 0)
+  {
+    return;
+  }
+
+  // Only blocks that fit entirely inside the volume are merged, so the deepest level is limited
+  // by the smallest dimension
+  int numLevels = 0;
+  while(numLevels < maxLevel && numLevels < 31 && (m_Dims[0] >> (numLevels + 1)) > 0 && (m_Dims[1] >> (numLevels + 1)) > 0 && (m_Dims[2] >> (numLevels + 1)) > 0)
+  {
+    numLevels++;
+  }
+
+  // The label of every aligned block that holds a single label, k_MixedLabel otherwise
+  std::vector<BlockGrid> grids(numLevels + 1);
+  std::vector<std::vector<int32_t>> blockLabels(numLevels + 1);
+  for(int k = 1; k <= numLevels; k++)
+  {
+    BlockGrid& grid = grids[k];
+    for(size_t i = 0; i < 3; i++)
+    {
+      grid.dims[i] = m_Dims[i] >> k;
+    }
+    blockLabels[k].resize(grid.size());
+    for(size_t z = 0; z < grid.dims[2]; z++)
+    {
+      for(size_t y = 0; y < grid.dims[1]; y++)
+      {
+        for(size_t x = 0; x < grid.dims[0]; x++)
+        {
+          int32_t label = 0;
+          for(size_t child = 0; child < 8; child++)
+          {
+            size_t cx = 2 * x + (child & 1);
+            size_t cy = 2 * y + ((child >> 1) & 1);
+            size_t cz = 2 * z + (child >> 2);
+            int32_t childLabel = (k == 1) ? labels[(cz * m_Dims[1] + cy) * m_Dims[0] + cx] : blockLabels[k - 1][grids[k - 1].index(cx, cy, cz)];
+            if(child == 0)
+            {
+              label = childLabel;
+            }
+            else if(childLabel != label)
+            {
+              label = k_MixedLabel;
+            }
+          }
+          blockLabels[k][grid.index(x, y, z)] = label;
+        }
+      }
+    }
+  }
+
+  // Levels are tracked on the grid of 2x2x2 blocks, including the partial blocks on the upper
+  // boundary. Level 0 means the block is meshed with individual cells. maxLevels starts as the
+  // deepest uniform ancestor of each block and is lowered until the leaves are balanced.
+  BlockGrid cover;
+  for(size_t i = 0; i < 3; i++)
+  {
+    cover.dims[i] = (m_Dims[i] + 1) / 2;
+  }
+  std::vector<uint8_t> maxLevels(cover.size(), 0);
+  for(size_t z = 0; z < cover.dims[2]; z++)
+  {
+    for(size_t y = 0; y < cover.dims[1]; y++)
+    {
+      for(size_t x = 0; x < cover.dims[0]; x++)
+      {
+        uint8_t level = 0;
+        for(int k = 1; k <= numLevels; k++)
+        {
+          size_t ax = x >> (k - 1);
+          size_t ay = y >> (k - 1);
+          size_t az = z >> (k - 1);
+          if(!grids[k].contains(ax, ay, az) || blockLabels[k][grids[k].index(ax, ay, az)] == k_MixedLabel)
+          {
+            break;
+          }
+          level = static_cast<uint8_t>(k);
+        }
+        maxLevels[cover.index(x, y, z)] = level;
+      }
+    }
+  }
+  blockLabels.clear();
+
+  // A block becomes part of a level k leaf when every block of that leaf allows level k
+  std::vector<std::vector<uint8_t>> minLevels(numLevels + 1);
+  for(int k = 1; k <= numLevels; k++)
+  {
+    minLevels[k].resize(grids[k].size());
+  }
+  std::vector<uint8_t> levels(cover.size(), 0);
+  auto updateLevels = [&]() {
+    for(int k = 1; k <= numLevels; k++)
+    {
+      const BlockGrid& grid = grids[k];
+      for(size_t z = 0; z < grid.dims[2]; z++)
+      {
+        for(size_t y = 0; y < grid.dims[1]; y++)
+        {
+          for(size_t x = 0; x < grid.dims[0]; x++)
+          {
+            // The level 1 blocks are the full blocks of the cover grid
+            if(k == 1)
+            {
+              minLevels[k][grid.index(x, y, z)] = maxLevels[cover.index(x, y, z)];
+              continue;
+            }
+            uint8_t level = std::numeric_limits<uint8_t>::max();
+            for(size_t child = 0; child < 8; child++)
+            {
+              size_t cx = 2 * x + (child & 1);
+              size_t cy = 2 * y + ((child >> 1) & 1);
+              size_t cz = 2 * z + (child >> 2);
+              level = std::min(level, minLevels[k - 1][grids[k - 1].index(cx, cy, cz)]);
+            }
+            minLevels[k][grid.index(x, y, z)] = level;
+          }
+        }
+      }
+    }
+    for(size_t z = 0; z < cover.dims[2]; z++)
+    {
+      for(size_t y = 0; y < cover.dims[1]; y++)
+      {
+        for(size_t x = 0; x < cover.dims[0]; x++)
+        {
+          uint8_t level = 0;
+          for(int k = 1; k <= numLevels; k++)
+          {
+            size_t ax = x >> (k - 1);
+            size_t ay = y >> (k - 1);
+            size_t az = z >> (k - 1);
+            if(!grids[k].contains(ax, ay, az) || minLevels[k][grids[k].index(ax, ay, az)] < k)
+            {
+              break;
+            }
+            level = static_cast<uint8_t>(k);
+          }
+          levels[cover.index(x, y, z)] = level;
+        }
+      }
+    }
+  };
+
+  // Enforce the 2:1 balance: a block may not sit more than one level above any of its 26
+  // neighbors. Lowering a block splits its whole leaf, which can ripple into further neighbors,
+  // so repeat until nothing changes. Levels only decrease, which guarantees termination.
+  updateLevels();
+  bool changed = true;
+  while(changed)
+  {
+    changed = false;
+    for(size_t z = 0; z < cover.dims[2]; z++)
+    {
+      for(size_t y = 0; y < cover.dims[1]; y++)
+      {
+        for(size_t x = 0; x < cover.dims[0]; x++)
+        {
+          uint8_t& maxLevel = maxLevels[cover.index(x, y, z)];
+          if(maxLevel <= 1)
+          {
+            continue;
+          }
+          uint8_t limit = maxLevel;
+          for(size_t nz = (z > 0 ? z - 1 : z); nz <= z + 1 && nz < cover.dims[2]; nz++)
+          {
+            for(size_t ny = (y > 0 ? y - 1 : y); ny <= y + 1 && ny < cover.dims[1]; ny++)
+            {
+              for(size_t nx = (x > 0 ? x - 1 : x); nx <= x + 1 && nx < cover.dims[0]; nx++)
+              {
+                limit = std::min<uint8_t>(limit, levels[cover.index(nx, ny, nz)] + 1);
+              }
+            }
+          }
+          if(limit < maxLevel)
+          {
+            maxLevel = limit;
+            changed = true;
+          }
+        }
+      }
+    }
+    if(changed)
+    {
+      updateLevels();
+    }
+  }
+  maxLevels.clear();
+  minLevels.clear();
+
+  // Each leaf is emitted by the block at its lower corner; level 0 blocks emit their cells
+  for(size_t z = 0; z < cover.dims[2]; z++)
+  {
+    for(size_t y = 0; y < cover.dims[1]; y++)
+    {
+      for(size_t x = 0; x < cover.dims[0]; x++)
+      {
+        uint8_t level = levels[cover.index(x, y, z)];
+        if(level == 0)
+        {
+          for(size_t child = 0; child < 8; child++)
+          {
+            size_t cx = 2 * x + (child & 1);
+            size_t cy = 2 * y + ((child >> 1) & 1);
+            size_t cz = 2 * z + (child >> 2);
+            if(cx < m_Dims[0] && cy < m_Dims[1] && cz < m_Dims[2])
+            {
+              m_Leaves.push_back({static_cast<uint32_t>(cx), static_cast<uint32_t>(cy), static_cast<uint32_t>(cz), 0});
+            }
+          }
+          continue;
+        }
+        size_t mask = (size_t(1) << (level - 1)) - 1;
+        if((x & mask) == 0 && (y & mask) == 0 && (z & mask) == 0)
+        {
+          m_Leaves.push_back({static_cast<uint32_t>(2 * x), static_cast<uint32_t>(2 * y), static_cast<uint32_t>(2 * z), level});
+        }
+      }
+    }
+  }
+  levels.clear();
+  m_Leaves.shrink_to_fit();
+
+  // Merge the corners shared by neighboring leaves
+  m_NodeIds.reserve(m_Leaves.size() * 8);
+  for(const Leaf& leaf : m_Leaves)
+  {
+    int64_t size = int64_t(1) << leaf.level;
+    for(const auto& corner : k_HexCorners)
+    {
+      m_NodeIds.push_back(gridNode(leaf.x + corner[0] * size, leaf.y + corner[1] * size, leaf.z + corner[2] * size));
+    }
+  }
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+  tbb::parallel_sort(m_NodeIds.begin(), m_NodeIds.end());
+#else
+  std::sort(m_NodeIds.begin(), m_NodeIds.end());
+#endif
+  m_NodeIds.erase(std::unique(m_NodeIds.begin(), m_NodeIds.end()), m_NodeIds.end());
+  m_NodeIds.shrink_to_fit();
+
+  findHangingNodes();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void OctreeCoarsener::findHangingNodes()
+{
+  // With 2:1 balance a smaller neighbor can only place a node at the middle of an edge or at the
+  // center of a face of a leaf. Any used node found there is hanging.
+  struct Constraint
+  {
+    int64_t node;
+    int64_t parents[4];
+  };
+  std::vector<Constraint> constraints;
+
+  for(const Leaf& leaf : m_Leaves)
+  {
+    if(leaf.level == 0)
+    {
+      continue;
+    }
+    const int64_t size = int64_t(1) << leaf.level;
+    const int64_t half = size / 2;
+    const int64_t anchor[3] = {leaf.x, leaf.y, leaf.z};
+    for(int axis = 0; axis < 3; axis++)
+    {
+      const int a1 = (axis + 1) % 3;
+      const int a2 = (axis + 2) % 3;
+      auto gridPoint = [&](int64_t alongAxis, int64_t along1, int64_t along2) {
+        int64_t p[3];
+        p[axis] = anchor[axis] + alongAxis;
+        p[a1] = anchor[a1] + along1;
+        p[a2] = anchor[a2] + along2;
+        return gridNode(p[0], p[1], p[2]);
+      };
+
+      // The four edges parallel to this axis
+      for(int edge = 0; edge < 4; edge++)
+      {
+        int64_t o1 = (edge & 1) * size;
+        int64_t o2 = (edge >> 1) * size;
+        int64_t node = nodeIndex(gridPoint(half, o1, o2));
+        if(node >= 0)
+        {
+          constraints.push_back({node, {nodeIndex(gridPoint(0, o1, o2)), nodeIndex(gridPoint(size, o1, o2)), -1, -1}});
+        }
+      }
+
+      // The two faces normal to this axis
+      for(int side = 0; side < 2; side++)
+      {
+        int64_t o = side * size;
+        int64_t node = nodeIndex(gridPoint(o, half, half));
+        if(node >= 0)
+        {
+          constraints.push_back({node, {nodeIndex(gridPoint(o, 0, 0)), nodeIndex(gridPoint(o, size, 0)), nodeIndex(gridPoint(o, size, size)), nodeIndex(gridPoint(o, 0, size))}});
+        }
+      }
+    }
+  }
+
+  // A node in the middle of an edge is seen by every large leaf sharing that edge
+  std::sort(constraints.begin(), constraints.end(), [](const Constraint& a, const Constraint& b) { return a.node < b.node; });
+  auto last = std::unique(constraints.begin(), constraints.end(), [](const Constraint& a, const Constraint& b) { return a.node == b.node; });
+  constraints.erase(last, constraints.end());
+
+  m_HangingNodes.reserve(constraints.size());
+  m_HangingNodeParents.reserve(constraints.size() * 4);
+  for(const Constraint& constraint : constraints)
+  {
+    m_HangingNodes.push_back(constraint.node);
+    m_HangingNodeParents.insert(m_HangingNodeParents.end(), constraint.parents, constraint.parents + 4);
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int64_t OctreeCoarsener::gridNode(int64_t x, int64_t y, int64_t z) const
+{
+  const int64_t nodeRow = static_cast<int64_t>(m_Dims[0]) + 1;
+  const int64_t nodeLayer = nodeRow * (static_cast<int64_t>(m_Dims[1]) + 1);
+  return z * nodeLayer + y * nodeRow + x;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int64_t OctreeCoarsener::nodeIndex(int64_t gridNodeId) const
+{
+  auto iter = std::lower_bound(m_NodeIds.begin(), m_NodeIds.end(), gridNodeId);
+  if(iter == m_NodeIds.end() || *iter != gridNodeId)
+  {
+    return -1;
+  }
+  return static_cast<int64_t>(iter - m_NodeIds.begin());
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+const std::vector<OctreeCoarsener::Leaf>& OctreeCoarsener::getLeaves() const
+{
+  return m_Leaves;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+size_t OctreeCoarsener::getNumberOfNodes() const
+{
+  return m_NodeIds.size();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void OctreeCoarsener::generateNodes(size_t offset, size_t count, double* xyz) const
+{
+  const int64_t nodeRow = static_cast<int64_t>(m_Dims[0]) + 1;
+  const int64_t nodeLayer = nodeRow * (static_cast<int64_t>(m_Dims[1]) + 1);
+  for(size_t i = 0; i < count; i++)
+  {
+    int64_t nodeId = m_NodeIds[offset + i];
+    int64_t z = nodeId / nodeLayer;
+    int64_t y = (nodeId - z * nodeLayer) / nodeRow;
+    int64_t x = nodeId - z * nodeLayer - y * nodeRow;
+    xyz[3 * i] = m_Origin[0] + x * m_Resolution[0];
+    xyz[3 * i + 1] = m_Origin[1] + y * m_Resolution[1];
+    xyz[3 * i + 2] = m_Origin[2] + z * m_Resolution[2];
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void OctreeCoarsener::generateConnectivity(size_t offset, size_t count, int64_t firstNodeId, int64_t* connectivity) const
+{
+  for(size_t i = 0; i < count; i++)
+  {
+    const Leaf& leaf = m_Leaves[offset + i];
+    int64_t size = int64_t(1) << leaf.level;
+    for(size_t c = 0; c < 8; c++)
+    {
+      int64_t node = gridNode(leaf.x + k_HexCorners[c][0] * size, leaf.y + k_HexCorners[c][1] * size, leaf.z + k_HexCorners[c][2] * size);
+      connectivity[8 * i + c] = firstNodeId + nodeIndex(node);
+    }
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+const std::vector<int64_t>& OctreeCoarsener::getHangingNodes() const
+{
+  return m_HangingNodes;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+const std::vector<int64_t>& OctreeCoarsener::getHangingNodeParents() const
+{
+  return m_HangingNodeParents;
+}
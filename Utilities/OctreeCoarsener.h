@@ -0,0 +1,150 @@
+/* ============================================================================
+* Copyright (c) 2018 BlueQuartz Software, LLC
+*
+* Redistribution and use in source and binary forms, with or without modification,
+* are permitted provided that the following conditions are met:
+*
+* Redistributions of source code must retain the above copyright notice, this
+* list of conditions and the following disclaimer.
+*
+* Redistributions in binary form must reproduce the above copyright notice, this
+* list of conditions and the following disclaimer in the documentation and/or
+* other materials provided with the distribution.
+*
+* Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+* contributors may be used to endorse or promote products derived from this software
+* without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+* DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+* FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+* DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+* OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+* USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*
+* ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+/**
+ * @brief The OctreeCoarsener class covers a labeled ImageGeom with hexahedra whose edges are
+ * 2^level cells long. Aligned blocks of 2^level cells that carry a single label are merged into
+ * one hexahedron, and the result is balanced so that leaves touching at a face, edge or corner
+ * differ by at most one level (2:1 balance). Fine cells are therefore kept only near the label
+ * boundaries while the interiors of the features are meshed coarsely.
+ *
+ * Because neighboring leaves may differ by one level, a corner of a small leaf can lie at the
+ * middle of an edge or face of a larger leaf. Those hanging nodes are reported together with the
+ * corners of the large leaf that constrain them, so a solver can tie them to the coarse side.
+ */
+class OctreeCoarsener
+{
+public:
+  /**
+   * @brief One hexahedron of the coarsened mesh
+   */
+  struct Leaf
+  {
+    uint32_t x; //!< Cell index of the lower corner along X
+    uint32_t y; //!< Cell index of the lower corner along Y
+    uint32_t z; //!< Cell index of the lower corner along Z
+    uint8_t level; //!< The leaf spans 2^level cells along each axis
+  };
+
+  /**
+   * @brief Constructor
+   * @param dims Number of cells along X, Y and Z
+   * @param resolution Cell spacing
+   * @param origin Position of the first grid node
+   */
+  OctreeCoarsener(const size_t dims[3], const float resolution[3], const float origin[3]);
+  virtual ~OctreeCoarsener();
+
+  /**
+   * @brief Builds the balanced leaves
+   * @param labels One label per cell, X varying fastest
+   * @param maxLevel Largest allowed leaf level. Level 0 keeps every cell.
+   */
+  void execute(const int32_t* labels, int maxLevel);
+
+  /**
+   * @brief Returns the leaves in Z, Y, X order of their lower corner block
+   * @return
+   */
+  const std::vector<Leaf>& getLeaves() const;
+
+  /**
+   * @brief Returns the number of distinct nodes the leaves use
+   * @return
+   */
+  size_t getNumberOfNodes() const;
+
+  /**
+   * @brief Fills the interleaved XYZ coordinates of nodes [offset, offset + count)
+   * @param offset
+   * @param count
+   * @param xyz
+   */
+  void generateNodes(size_t offset, size_t count, double* xyz) const;
+
+  /**
+   * @brief Fills the eight node ids of leaves [offset, offset + count) using the VTK/MOAB
+   * hexahedron ordering. Node ids start at firstNodeId.
+   * @param offset
+   * @param count
+   * @param firstNodeId
+   * @param connectivity
+   */
+  void generateConnectivity(size_t offset, size_t count, int64_t firstNodeId, int64_t* connectivity) const;
+
+  /**
+   * @brief Returns the indices of the nodes that lie inside an edge or face of a larger leaf
+   * @return
+   */
+  const std::vector<int64_t>& getHangingNodes() const;
+
+  /**
+   * @brief Returns four node indices per hanging node: the two ends of the edge or the four
+   * corners of the face it lies on. Edge constraints are padded with -1.
+   * @return
+   */
+  const std::vector<int64_t>& getHangingNodeParents() const;
+
+protected:
+  /**
+   * @brief Returns the grid node index of the node at (x, y, z)
+   */
+  int64_t gridNode(int64_t x, int64_t y, int64_t z) const;
+
+  /**
+   * @brief Returns the position of a grid node among the used nodes
+   */
+  int64_t nodeIndex(int64_t gridNodeId) const;
+
+  void findHangingNodes();
+
+private:
+  size_t m_Dims[3] = {0, 0, 0};
+  float m_Resolution[3] = {0.0f, 0.0f, 0.0f};
+  float m_Origin[3] = {0.0f, 0.0f, 0.0f};
+
+  std::vector<Leaf> m_Leaves;
+  std::vector<int64_t> m_NodeIds; //!< Sorted grid node indices of the used nodes
+  std::vector<int64_t> m_HangingNodes;
+  std::vector<int64_t> m_HangingNodeParents;
+
+public:
+  OctreeCoarsener(const OctreeCoarsener&) = delete;            // Copy Constructor Not Implemented
+  OctreeCoarsener(OctreeCoarsener&&) = delete;                 // Move Constructor Not Implemented
+  OctreeCoarsener& operator=(const OctreeCoarsener&) = delete; // Copy Assignment Not Implemented
+  OctreeCoarsener& operator=(OctreeCoarsener&&) = delete;      // Move Assignment Not Implemented
+};
@@ -0,0 +1,241 @@
+/* ============================================================================
+* Copyright (c) 2018 BlueQuartz Software, LLC
+*
+* Redistribution and use in source and binary forms, with or without modification,
+* are permitted provided that the following conditions are met:
+*
+* Redistributions of source code must retain the above copyright notice, this
+* list of conditions and the following disclaimer.
+*
+* Redistributions in binary form must reproduce the above copyright notice, this
+* list of conditions and the following disclaimer in the documentation and/or
+* other materials provided with the distribution.
+*
+* Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+* contributors may be used to endorse or promote products derived from this software
+* without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+* DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+* FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+* DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+* OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+* USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*
+* ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#include "OctreeExporter.h"
+
+#include <algorithm>
+#include <cstring>
+
+#include "LabelCountingSort.h"
+#include "MeshPartitioner.h"
+#include "OctreeCoarsener.h"
+
+namespace
+{
+// Sparse tag on the hanging nodes of an octree mesh holding the file ids of the two or four
+// nodes that constrain each one; unused entries are 0
+const char* const k_HangingNodeTagName = "HangingNodeParents";
+} // namespace
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+OctreeExporter::OctreeExporter(AbstractFilter* filter, const MeshExportSettings& settings)
+: MeshExporter(filter, settings)
+{
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+OctreeExporter::~OctreeExporter() = default;
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void OctreeExporter::write(const ImageGeom::Pointer& image)
+{
+  size_t dims[3] = {0, 0, 0};
+  float res[3] = {0.0f, 0.0f, 0.0f};
+  float origin[3] = {0.0f, 0.0f, 0.0f};
+
+  ImageRegion region = getRegion(image, dims, res, origin);
+
+  OctreeCoarsener coarsener(dims, res, origin);
+  const std::vector<OctreeCoarsener::Leaf>& leaves = coarsener.getLeaves();
+  LabelCountingSort featureSorter;
+  LabelCountingSort partSorter;
+  {
+    std::vector<int32_t> buffer;
+    const int32_t* labels = gatherFeatureIds(region, buffer);
+    notifyStatusMessage(QObject::tr("Coarsening %1 cells").arg(region.getNumberOfCells()));
+    coarsener.execute(labels, m_Settings.maxOctreeLevel);
+    if(getCancel())
+    {
+      return;
+    }
+
+    // Every cell of a leaf carries the same Feature Id, so the sets group whole leaves
+    std::vector<int32_t> leafLabels(leaves.size());
+    for(size_t i = 0; i < leaves.size(); i++)
+    {
+      leafLabels[i] = labels[(leaves[i].z * dims[1] + leaves[i].y) * dims[0] + leaves[i].x];
+    }
+    if(m_Settings.writeFeatureSets && !sortFeatureIds(featureSorter, leafLabels.data(), leafLabels.size()))
+    {
+      return;
+    }
+
+    // Each leaf counts as one element at its center, whatever its size
+    if(m_Settings.writePartitionSets)
+    {
+      std::vector<float> centers(leaves.size() * 3);
+      for(size_t i = 0; i < leaves.size(); i++)
+      {
+        float halfSize = 0.5f * static_cast<float>(1u << leaves[i].level);
+        centers[3 * i] = static_cast<float>(leaves[i].x) + halfSize;
+        centers[3 * i + 1] = static_cast<float>(leaves[i].y) + halfSize;
+        centers[3 * i + 2] = static_cast<float>(leaves[i].z) + halfSize;
+      }
+      MeshPartitioner partitioner(static_cast<MeshPartitioner::Strategy>(m_Settings.partitionStrategy), static_cast<size_t>(m_Settings.partitionCount));
+      if(!sortPartitions(partSorter, partitioner.getParts(), partitioner.executeElements(centers, leafLabels.data())))
+      {
+        return;
+      }
+    }
+  }
+
+  MoabH5mWriter writer;
+  applyCompression(writer);
+  if(writer.openFile(m_Settings.outputFile.toStdString()) < 0)
+  {
+    QString ss = QObject::tr("Unable to create the output file '%1'.").arg(m_Settings.outputFile);
+    setErrorCondition(-101014, ss);
+    return;
+  }
+
+  const size_t k_EntitiesPerBlock = 65536;
+  size_t numNodes = coarsener.getNumberOfNodes();
+  size_t numElements = leaves.size();
+  double totalBytes = 3.0 * sizeof(double) * numNodes + 8.0 * sizeof(int64_t) * numElements;
+  for(const IDataArray::WeakPointer& weakPtr : m_Settings.selectedWeakPtrVector)
+  {
+    IDataArray::Pointer selectedArray = weakPtr.lock();
+    ExportTypeInfo typeInfo;
+    GetExportTypeInfo(selectedArray->getTypeAsString(), typeInfo);
+    totalBytes += static_cast<double>(numElements * typeInfo.size * static_cast<size_t>(selectedArray->getNumberOfComponents()));
+  }
+  ExportProgress progress(m_Filter, totalBytes);
+  bool running = true;
+
+  int err = writer.createNodes(numNodes);
+  if(err >= 0)
+  {
+    std::vector<double> xyz(k_EntitiesPerBlock * 3);
+    for(size_t offset = 0; offset < numNodes && err >= 0 && running; offset += k_EntitiesPerBlock)
+    {
+      size_t count = std::min(k_EntitiesPerBlock, numNodes - offset);
+      coarsener.generateNodes(offset, count, xyz.data());
+      err = writer.writeNodes(offset, count, xyz.data());
+      running = progress.advance(QObject::tr("Writing nodes"), static_cast<double>(count * 3 * sizeof(double)));
+    }
+  }
+
+  std::string hexGroup;
+  if(err >= 0 && running)
+  {
+    hexGroup = writer.createElements(MoabH5mWriter::EntityType::Hex, 8, numElements);
+    err = hexGroup.empty() ? -1 : 0;
+  }
+  if(err >= 0)
+  {
+    std::vector<int64_t> connectivity(k_EntitiesPerBlock * 8);
+    for(size_t offset = 0; offset < numElements && err >= 0 && running; offset += k_EntitiesPerBlock)
+    {
+      size_t count = std::min(k_EntitiesPerBlock, numElements - offset);
+      coarsener.generateConnectivity(offset, count, writer.getNodeStartId(), connectivity.data());
+      err = writer.writeConnectivity(hexGroup, offset, count, connectivity.data());
+      running = progress.advance(QObject::tr("Writing connectivity"), static_cast<double>(count * 8 * sizeof(int64_t)));
+    }
+  }
+
+  // A merged element takes the values of the first cell it covers. Arrays that follow the
+  // Feature Ids are preserved exactly; arrays that vary inside a Feature are sampled.
+  std::string hexGroupPath = MoabH5mWriter::ElementGroupPath(hexGroup);
+  for(int i = 0; i < m_Settings.selectedArrayPaths.size() && err >= 0 && running; i++)
+  {
+    IDataArray::Pointer selectedArray = m_Settings.selectedWeakPtrVector[i].lock();
+    ExportTypeInfo typeInfo;
+    GetExportTypeInfo(selectedArray->getTypeAsString(), typeInfo);
+    size_t numComps = static_cast<size_t>(selectedArray->getNumberOfComponents());
+
+    std::string tagName = m_Settings.selectedArrayPaths[i].getDataArrayName().toStdString() + "_";
+    err = writer.createDenseTag(tagName, typeInfo.hdf5Type, static_cast<int>(numComps));
+    if(err >= 0)
+    {
+      err = writer.createDenseTagData(hexGroupPath, tagName, numElements);
+    }
+
+    size_t tupleBytes = typeInfo.size * numComps;
+    QString stage = QObject::tr("Writing %1").arg(m_Settings.selectedArrayPaths[i].getDataArrayName());
+    std::vector<uint8_t> values(k_EntitiesPerBlock * tupleBytes);
+    for(size_t offset = 0; offset < numElements && err >= 0 && running; offset += k_EntitiesPerBlock)
+    {
+      size_t count = std::min(k_EntitiesPerBlock, numElements - offset);
+      for(size_t j = 0; j < count; j++)
+      {
+        const OctreeCoarsener::Leaf& leaf = leaves[offset + j];
+        std::memcpy(values.data() + j * tupleBytes, region.getCellPointer(selectedArray->getVoidPointer(0), tupleBytes, leaf.x, leaf.y, leaf.z), tupleBytes);
+      }
+      err = writer.writeDenseTagData(hexGroupPath, tagName, offset, count, values.data());
+      running = progress.advance(stage, static_cast<double>(count * tupleBytes));
+    }
+  }
+
+  const std::vector<int64_t>& hangingNodes = coarsener.getHangingNodes();
+  if(m_Settings.writeHangingNodes && !hangingNodes.empty() && err >= 0 && running)
+  {
+    const std::vector<int64_t>& parents = coarsener.getHangingNodeParents();
+    int64_t nodeStartId = writer.getNodeStartId();
+    std::vector<int64_t> nodeIds(hangingNodes.size());
+    std::vector<int64_t> parentIds(parents.size());
+    for(size_t i = 0; i < hangingNodes.size(); i++)
+    {
+      nodeIds[i] = nodeStartId + hangingNodes[i];
+    }
+    for(size_t i = 0; i < parents.size(); i++)
+    {
+      parentIds[i] = (parents[i] < 0) ? 0 : nodeStartId + parents[i];
+    }
+    err = writer.createSparseTag(k_HangingNodeTagName, H5T_NATIVE_INT64, 4, hangingNodes.size());
+    if(err >= 0)
+    {
+      err = writer.writeSparseTagData(k_HangingNodeTagName, 0, hangingNodes.size(), nodeIds.data(), parentIds.data());
+    }
+  }
+
+  if((m_Settings.writeFeatureSets || m_Settings.writePartitionSets) && err >= 0 && running)
+  {
+    err = writeElementSets(writer, getSetGroups(featureSorter, partSorter), writer.getElementStartId(hexGroup));
+  }
+
+  bool closed = (writer.closeFile() >= 0);
+  m_StoppedEarly = !running;
+  if(m_StoppedEarly)
+  {
+    return;
+  }
+  if(!closed || err < 0)
+  {
+    QString ss = QObject::tr("Unable to write MOAB mesh to the specified file.");
+    setErrorCondition(-101004, ss);
+    return;
+  }
+}
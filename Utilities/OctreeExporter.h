@@ -0,0 +1,58 @@
+/* ============================================================================
+* Copyright (c) 2018 BlueQuartz Software, LLC
+*
+* Redistribution and use in source and binary forms, with or without modification,
+* are permitted provided that the following conditions are met:
+*
+* Redistributions of source code must retain the above copyright notice, this
+* list of conditions and the following disclaimer.
+*
+* Redistributions in binary form must reproduce the above copyright notice, this
+* list of conditions and the following disclaimer in the documentation and/or
+* other materials provided with the distribution.
+*
+* Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+* contributors may be used to endorse or promote products derived from this software
+* without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+* DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+* FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+* DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+* OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+* USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*
+* ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#pragma once
+
+#include "MeshExporter.h"
+
+/**
+ * @brief The OctreeExporter class writes an ImageGeom as Hex8 elements that each cover an
+ * aligned block of cells with a single Feature Id, as found by OctreeCoarsener. Neighboring
+ * elements differ by at most one octree level, and the nodes left hanging on the larger
+ * elements can be written with the nodes that constrain them.
+ */
+class OctreeExporter : public MeshExporter
+{
+public:
+  OctreeExporter(AbstractFilter* filter, const MeshExportSettings& settings);
+  ~OctreeExporter() override;
+
+  /**
+   * @brief Writes the coarsened octree mesh of the ImageGeom to a native h5m file
+   * @param image ImageGeom that holds the selected array
+   */
+  void write(const ImageGeom::Pointer& image);
+
+public:
+  OctreeExporter(const OctreeExporter&) = delete;            // Copy Constructor Not Implemented
+  OctreeExporter(OctreeExporter&&) = delete;                 // Move Constructor Not Implemented
+  OctreeExporter& operator=(const OctreeExporter&) = delete; // Copy Assignment Not Implemented
+  OctreeExporter& operator=(OctreeExporter&&) = delete;      // Move Assignment Not Implemented
+};
@@ -63,12 +63,103 @@
 #include <vtkUnstructuredGrid.h>
 #include <vtkVertexGlyphFilter.h>
 
+#include "Utilities/ImageRegion.h"
+#include "Utilities/VtkHexahedralGeom.h"
 #include "Utilities/VtkTetrahedralGeom.h"
 #include "Utilities/VtkTriangleGeom.h"
 #include "Utilities/VtkEdgeGeom.h"
 #include "Utilities/VtkVertexGeom.h"
 #include "Utilities/VtkQuadGeom.h"
 
+namespace
+{
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool CanWrapAttributeMatrix(const AttributeMatrix::Pointer& attrMat, vtkDataSet* dataSet)
+{
+  if(!attrMat)
+  {
+    return false;
+  }
+
+  // For now, only support Cell, Edge, and Vertex AttributeMatrices
+  if(attrMat->getType() != AttributeMatrix::Type::Cell
+     && attrMat->getType() != AttributeMatrix::Type::Edge
+     && attrMat->getType() != AttributeMatrix::Type::Face
+     && attrMat->getType() != AttributeMatrix::Type::Vertex)
+  {
+    return false;
+  }
+
+  // If the attribute matrix is of type cell but the elements and tuples do not
+  // match up, skip it; this really should never happen!
+  return attrMat->getNumberOfTuples() == dataSet->GetNumberOfCells();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void AddSelectedCellArrays(const DataContainer::Pointer& dc, const QVector<DataArrayPath>& arrayPaths, vtkDataSet* dataSet)
+{
+  for(const DataArrayPath& path : arrayPaths)
+  {
+    if(path.getDataContainerName() != dc->getName())
+    {
+      continue;
+    }
+
+    AttributeMatrix::Pointer attrMat = dc->getAttributeMatrix(path.getAttributeMatrixName());
+    if(!CanWrapAttributeMatrix(attrMat, dataSet))
+    {
+      continue;
+    }
+
+    IDataArray::Pointer array = attrMat->getAttributeArray(path.getDataArrayName());
+    if(!array)
+    {
+      continue;
+    }
+
+    VTK_PTR(vtkDataArray) vtkArray = SIMPLVtkBridge::WrapIDataArray(array);
+    if(!vtkArray)
+    {
+      continue;
+    }
+
+    vtkArray->SetName(array->getName().toStdString().c_str());
+    dataSet->GetCellData()->AddArray(vtkArray);
+  }
+
+  vtkCellData* cellData = dataSet->GetCellData();
+  if(cellData->GetNumberOfArrays() > 0)
+  {
+    cellData->SetActiveScalars(cellData->GetArray(0)->GetName());
+  }
+}
+
+// -----------------------------------------------------------------------------
+// Builds a vtkUnstructuredGrid that shares the vertices of the geometry and holds
+// its cells in a vtkCellArray filled in bulk from the shared element list
+// -----------------------------------------------------------------------------
+template <typename VtkGeomT, typename GeomT>
+VTK_PTR(vtkDataSet) CreateUnstructuredGrid(const std::shared_ptr<GeomT>& geom)
+{
+  VTK_NEW(VtkGeomT, wrapper);
+  wrapper->SetGeometry(geom);
+
+  VTK_NEW(vtkUnstructuredGrid, dataSet);
+  VTK_NEW(vtkPoints, points);
+  VTK_PTR(vtkDataArray) vertexArray = SIMPLVtkBridge::WrapVertices(geom->getVertices());
+  points->SetDataTypeToFloat();
+  points->SetData(vertexArray);
+  dataSet->SetPoints(points);
+  dataSet->SetCells(wrapper->GetCellType(0), wrapper->GetCellArray());
+
+  return dataSet;
+}
+} // namespace
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -110,28 +201,12 @@ VTK_PTR(vtkDataSet) SIMPLVtkBridge::WrapDataContainerAsVtkDataset(DataContainer:
 
     for(DataContainer::AttributeMatrixMap_t::Iterator attrMat = attrMats.begin(); attrMat != attrMats.end(); ++attrMat)
     {
-      if(!(*attrMat))
-      {
-        continue;
-      }
-
-      // For now, only support Cell, Edge, and Vertex AttributeMatrices
-      if((*attrMat)->getType() != AttributeMatrix::Type::Cell
-         && (*attrMat)->getType() != AttributeMatrix::Type::Edge
-         && (*attrMat)->getType() != AttributeMatrix::Type::Face
-         && (*attrMat)->getType() != AttributeMatrix::Type::Vertex)
+      if(!CanWrapAttributeMatrix(*attrMat, dataSet))
       {
         continue;
       }
       else
       {
-        // If the attribute matrix is of type cell but the elements and tuples do not
-        // match up, just continue ; this really should never happen!
-        if((*attrMat)->getNumberOfTuples() != dataSet->GetNumberOfCells())
-        {
-          continue;
-        }
-
         QStringList arrayNames = (*attrMat)->getAttributeArrayNames();
 
         for(QStringList::Iterator arrayName = arrayNames.begin(); arrayName != arrayNames.end(); ++arrayName)
@@ -171,6 +246,147 @@ VTK_PTR(vtkDataSet) SIMPLVtkBridge::WrapDataContainerAsVtkDataset(DataContainer:
   return dataSet;
 }
 
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+VTK_PTR(vtkDataSet) SIMPLVtkBridge::WrapDataContainerAsVtkDataset(DataContainer::Pointer dc, const QVector<DataArrayPath>& arrayPaths)
+{
+  VTK_PTR(vtkDataSet) dataSet;
+
+  if(!dc || !dc->getGeometry())
+  {
+    return dataSet;
+  }
+
+  dataSet = WrapGeometry(dc->getGeometry());
+  if(!dataSet)
+  {
+    return dataSet;
+  }
+
+  AddSelectedCellArrays(dc, arrayPaths, dataSet);
+  return dataSet;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+VTK_PTR(vtkDataSet) SIMPLVtkBridge::WrapDataContainerForExport(DataContainer::Pointer dc, const QVector<DataArrayPath>& arrayPaths)
+{
+  VTK_PTR(vtkDataSet) dataSet;
+
+  if(!dc || !dc->getGeometry())
+  {
+    return dataSet;
+  }
+
+  dataSet = WrapGeometryAsUnstructuredGrid(dc->getGeometry());
+  if(!dataSet)
+  {
+    return dataSet;
+  }
+
+  AddSelectedCellArrays(dc, arrayPaths, dataSet);
+  return dataSet;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+VTK_PTR(vtkDataSet) SIMPLVtkBridge::WrapImageRegionAsVtkDataset(DataContainer::Pointer dc, const QVector<DataArrayPath>& arrayPaths, const ImageRegion& region)
+{
+  VTK_PTR(vtkDataSet) dataSet;
+
+  if(!dc)
+  {
+    return dataSet;
+  }
+
+  ImageGeom::Pointer image = dc->getGeometryAs<ImageGeom>();
+  if(!image)
+  {
+    return dataSet;
+  }
+
+  size_t dims[3] = {0, 0, 0};
+  float res[3] = {0.0f, 0.0f, 0.0f};
+  float imageOrigin[3] = {0.0f, 0.0f, 0.0f};
+  float origin[3] = {0.0f, 0.0f, 0.0f};
+
+  region.getDimensions(dims);
+  image->getResolution(res);
+  image->getOrigin(imageOrigin);
+  region.getOrigin(imageOrigin, res, origin);
+
+  VTK_NEW(vtkImageData, vtkImage);
+  vtkImage->SetExtent(0, dims[0], 0, dims[1], 0, dims[2]);
+  vtkImage->SetDimensions(dims[0] + 1, dims[1] + 1, dims[2] + 1);
+  vtkImage->SetSpacing(res[0], res[1], res[2]);
+  vtkImage->SetOrigin(origin[0], origin[1], origin[2]);
+  dataSet = vtkImage;
+
+  size_t numImageCells = image->getNumberOfElements();
+  vtkIdType numRegionCells = static_cast<vtkIdType>(region.getNumberOfCells());
+  for(const DataArrayPath& path : arrayPaths)
+  {
+    if(path.getDataContainerName() != dc->getName())
+    {
+      continue;
+    }
+
+    // The arrays index the cells of the whole image, so they are checked against it
+    AttributeMatrix::Pointer attrMat = dc->getAttributeMatrix(path.getAttributeMatrixName());
+    if(!attrMat || attrMat->getType() != AttributeMatrix::Type::Cell || attrMat->getNumberOfTuples() != numImageCells)
+    {
+      continue;
+    }
+
+    IDataArray::Pointer array = attrMat->getAttributeArray(path.getDataArrayName());
+    if(!array)
+    {
+      continue;
+    }
+
+    // The wrapped array only provides the VTK type and component names; the region gets its own array
+    VTK_PTR(vtkDataArray) sourceArray = WrapIDataArray(array);
+    if(!sourceArray)
+    {
+      continue;
+    }
+
+    int numComps = sourceArray->GetNumberOfComponents();
+    size_t tupleBytes = static_cast<size_t>(sourceArray->GetDataTypeSize()) * numComps;
+    VTK_PTR(vtkDataArray) vtkArray;
+    vtkArray.TakeReference(vtkDataArray::CreateDataArray(sourceArray->GetDataType()));
+    vtkArray->SetNumberOfComponents(numComps);
+    if(region.isLayerContiguous())
+    {
+      void* values = const_cast<void*>(region.getLayerPointer(array->getVoidPointer(0), tupleBytes, 0));
+      vtkArray->SetVoidArray(values, numRegionCells * numComps, 1);
+    }
+    else
+    {
+      vtkArray->SetNumberOfTuples(numRegionCells);
+      region.copyLayers(array->getVoidPointer(0), tupleBytes, 0, dims[2], vtkArray->GetVoidPointer(0));
+    }
+
+    for(int i = 0; i < numComps; i++)
+    {
+      vtkArray->SetComponentName(i, sourceArray->GetComponentName(i));
+    }
+    vtkArray->SetName(array->getName().toStdString().c_str());
+    dataSet->GetCellData()->AddArray(vtkArray);
+  }
+
+  vtkCellData* cellData = dataSet->GetCellData();
+  if(cellData->GetNumberOfArrays() > 0)
+  {
+    cellData->SetActiveScalars(cellData->GetArray(0)->GetName());
+  }
+
+  return dataSet;
+}
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -203,6 +419,24 @@ VTK_PTR(vtkDataSet) SIMPLVtkBridge::WrapGeometry(EdgeGeom::Pointer geom)
   return dataSet;
 }
 
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+VTK_PTR(vtkDataSet) SIMPLVtkBridge::WrapGeometry(HexahedralGeom::Pointer geom)
+{
+  VTK_NEW(VtkHexahedralGrid, dataSet);
+  VtkHexahedralGeom* hexGeom = dataSet->GetImplementation();
+  hexGeom->SetGeometry(geom);
+
+  VTK_NEW(vtkPoints, points);
+  VTK_PTR(vtkDataArray) vertexArray = WrapVertices(geom->getVertices());
+  points->SetDataTypeToFloat();
+  points->SetData(vertexArray);
+  dataSet->SetPoints(points);
+
+  return dataSet;
+}
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -331,6 +565,10 @@ VTK_PTR(vtkDataSet) SIMPLVtkBridge::WrapGeometry(IGeometry::Pointer geom)
   {
     return WrapGeometry(std::dynamic_pointer_cast<EdgeGeom>(geom));
   }
+  else if(std::dynamic_pointer_cast<HexahedralGeom>(geom))
+  {
+    return WrapGeometry(std::dynamic_pointer_cast<HexahedralGeom>(geom));
+  }
   else if(std::dynamic_pointer_cast<ImageGeom>(geom))
   {
     return WrapGeometry(std::dynamic_pointer_cast<ImageGeom>(geom));
@@ -360,6 +598,39 @@ VTK_PTR(vtkDataSet) SIMPLVtkBridge::WrapGeometry(IGeometry::Pointer geom)
   return nullptr;
 }
 
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+VTK_PTR(vtkDataSet) SIMPLVtkBridge::WrapGeometryAsUnstructuredGrid(IGeometry::Pointer geom)
+{
+  if(EdgeGeom::Pointer edgeGeom = std::dynamic_pointer_cast<EdgeGeom>(geom))
+  {
+    return CreateUnstructuredGrid<VtkEdgeGeom>(edgeGeom);
+  }
+  else if(HexahedralGeom::Pointer hexGeom = std::dynamic_pointer_cast<HexahedralGeom>(geom))
+  {
+    return CreateUnstructuredGrid<VtkHexahedralGeom>(hexGeom);
+  }
+  else if(QuadGeom::Pointer quadGeom = std::dynamic_pointer_cast<QuadGeom>(geom))
+  {
+    return CreateUnstructuredGrid<VtkQuadGeom>(quadGeom);
+  }
+  else if(TetrahedralGeom::Pointer tetGeom = std::dynamic_pointer_cast<TetrahedralGeom>(geom))
+  {
+    return CreateUnstructuredGrid<VtkTetrahedralGeom>(tetGeom);
+  }
+  else if(TriangleGeom::Pointer triGeom = std::dynamic_pointer_cast<TriangleGeom>(geom))
+  {
+    return CreateUnstructuredGrid<VtkTriangleGeom>(triGeom);
+  }
+  else if(VertexGeom::Pointer vertGeom = std::dynamic_pointer_cast<VertexGeom>(geom))
+  {
+    return CreateUnstructuredGrid<VtkVertexGeom>(vertGeom);
+  }
+
+  return WrapGeometry(geom);
+}
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
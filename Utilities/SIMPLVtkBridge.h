@@ -44,6 +44,7 @@
 #include "SIMPLib/DataArrays/DataArray.hpp"
 #include "SIMPLib/DataContainers/DataContainerArray.h"
 #include "SIMPLib/Geometry/EdgeGeom.h"
+#include "SIMPLib/Geometry/HexahedralGeom.h"
 #include "SIMPLib/Geometry/ImageGeom.h"
 #include "SIMPLib/Geometry/QuadGeom.h"
 #include "SIMPLib/Geometry/RectGridGeom.h"
@@ -59,6 +60,7 @@
 #define VTK_PTR(type) vtkSmartPointer<type>
 
 class vtkImageData;
+class ImageRegion;
 class vtkDataArray;
 class vtkScalarsToColors;
 class vtkScalarBarActor;
@@ -73,9 +75,40 @@ public:
 
   static VTK_PTR(vtkDataSet) WrapDataContainerAsVtkDataset(DataContainer::Pointer dc);
 
+  /**
+   * @brief Wraps the geometry of the DataContainer and only the listed arrays. Paths that
+   * point outside the DataContainer or to arrays that cannot be wrapped are skipped.
+   * @param dc
+   * @param arrayPaths
+   * @return
+   */
+  static VTK_PTR(vtkDataSet) WrapDataContainerAsVtkDataset(DataContainer::Pointer dc, const QVector<DataArrayPath>& arrayPaths);
+
+  /**
+   * @brief Wraps the DataContainer like WrapDataContainerAsVtkDataset but for an importer
+   * that copies the whole mesh: geometries with an element list become a vtkUnstructuredGrid
+   * whose cells are built in bulk, instead of a mapped grid read one cell at a time.
+   * @param dc
+   * @param arrayPaths
+   * @return
+   */
+  static VTK_PTR(vtkDataSet) WrapDataContainerForExport(DataContainer::Pointer dc, const QVector<DataArrayPath>& arrayPaths);
+
+  /**
+   * @brief Creates an image covering a region of the DataContainer's ImageGeom and adds the
+   * listed cell arrays restricted to that region. The values are used in place when the region
+   * spans whole XY layers and gathered row by row otherwise; the rest of the arrays is never copied.
+   * @param dc DataContainer holding an ImageGeom
+   * @param arrayPaths
+   * @param region
+   * @return
+   */
+  static VTK_PTR(vtkDataSet) WrapImageRegionAsVtkDataset(DataContainer::Pointer dc, const QVector<DataArrayPath>& arrayPaths, const ImageRegion& region);
+
   static VTK_PTR(vtkDataSet) WrapImageGeomAsVtkImageData(ImageGeom::Pointer image, Int32ArrayType::Pointer data);
 
   static VTK_PTR(vtkDataSet) WrapGeometry(EdgeGeom::Pointer geom);
+  static VTK_PTR(vtkDataSet) WrapGeometry(HexahedralGeom::Pointer geom);
   static VTK_PTR(vtkDataSet) WrapGeometry(ImageGeom::Pointer image);
   static VTK_PTR(vtkDataSet) WrapGeometry(QuadGeom::Pointer geom);
   static VTK_PTR(vtkDataSet) WrapGeometry(RectGridGeom::Pointer geom);
@@ -84,6 +117,15 @@ public:
   static VTK_PTR(vtkDataSet) WrapGeometry(VertexGeom::Pointer geom);
   static VTK_PTR(vtkDataSet) WrapGeometry(IGeometry::Pointer geom);
 
+  /**
+   * @brief Returns a vtkUnstructuredGrid for the geometries with an element list, which shares
+   * their vertices and holds a vtkCellArray filled from the element list in one parallel pass.
+   * Other geometries are wrapped as by WrapGeometry.
+   * @param geom
+   * @return
+   */
+  static VTK_PTR(vtkDataSet) WrapGeometryAsUnstructuredGrid(IGeometry::Pointer geom);
+
   static VTK_PTR(vtkDataArray) WrapVertices(SharedVertexList::Pointer vertexArray);
   static VTK_PTR(vtkDataArray) WrapIDataArray(IDataArray::Pointer array);
   static VTK_PTR(vtkDataArray) WrapRectGridCoords(IDataArray::Pointer array);
@@ -96,15 +138,12 @@ public:
 
     vtkArray->SetVoidArray(array->getVoidPointer(0), array->getSize(), 1);
 
+    // SetComponentName() copies the string
+    std::string arrayName = array->getName().toStdString() + "_";
     for(int i = 0; i < vtkArray->GetNumberOfComponents(); i++)
     {
-      int strlen = std::strlen(array->getName().toStdString().c_str()) + ((i + 1) / 10 + 1) + 2;
-      char* componentName = new char[strlen];
-      std::strcpy(componentName, array->getName().toStdString().c_str());
-      std::strcat(componentName, "_");
-      std::strcat(componentName, std::to_string(i).c_str());
-
-      vtkArray->SetComponentName(i, componentName);
+      std::string componentName = arrayName + std::to_string(i);
+      vtkArray->SetComponentName(i, componentName.c_str());
     }
 
     return vtkArray;
@@ -0,0 +1,149 @@
+/* ============================================================================
+* Copyright (c) 2018 BlueQuartz Software, LLC
+*
+* Redistribution and use in source and binary forms, with or without modification,
+* are permitted provided that the following conditions are met:
+*
+* Redistributions of source code must retain the above copyright notice, this
+* list of conditions and the following disclaimer.
+*
+* Redistributions in binary form must reproduce the above copyright notice, this
+* list of conditions and the following disclaimer in the documentation and/or
+* other materials provided with the distribution.
+*
+* Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+* contributors may be used to endorse or promote products derived from this software
+* without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+* DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+* FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+* DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+* OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+* USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*
+* ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#include "SmtkMeshExporter.h"
+
+#include <QtCore/QFileInfo>
+
+#include "smtk/extension/vtk/io/mesh/ExportVTKData.h"
+#include "smtk/extension/vtk/io/mesh/ImportVTKData.h"
+
+#ifdef DEBUG
+#undef DEBUG
+#define DEBUG_SmtkMeshExporter
+#endif
+
+#include "smtk/mesh/core/Collection.h"
+#include "smtk/mesh/core/Manager.h"
+#include "smtk/mesh/core/CellField.h"
+#include "smtk/io/WriteMesh.h"
+#include "smtk/io/ExportMesh.h"
+
+#ifdef DEBUG_SmtkMeshExporter
+#define DEBUG
+#endif
+
+#include "SIMPLVtkBridge.h"
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+SmtkMeshExporter::SmtkMeshExporter(AbstractFilter* filter, const MeshExportSettings& settings)
+: MeshExporter(filter, settings)
+{
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+SmtkMeshExporter::~SmtkMeshExporter() = default;
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void SmtkMeshExporter::write(const DataContainer::Pointer& dc)
+{
+  // Only the selected arrays are wrapped; the rest of the DataContainer is never touched. A
+  // region of interest gets its own geometry and only the cells inside it are gathered.
+  VTK_PTR(vtkDataSet) imageDataPtr;
+  if(m_Settings.cropToRegion)
+  {
+    size_t dims[3] = {0, 0, 0};
+    float res[3] = {0.0f, 0.0f, 0.0f};
+    float origin[3] = {0.0f, 0.0f, 0.0f};
+    ImageRegion region = getRegion(dc->getGeometryAs<ImageGeom>(), dims, res, origin);
+    imageDataPtr = SIMPLVtkBridge::WrapImageRegionAsVtkDataset(dc, m_Settings.selectedArrayPaths, region);
+  }
+  else
+  {
+    imageDataPtr = SIMPLVtkBridge::WrapDataContainerForExport(dc, m_Settings.selectedArrayPaths);
+  }
+  vtkDataSet* dataSet = imageDataPtr.Get();
+
+  if (!dataSet)
+  {
+    QString ss = QObject::tr("Could not encapsulate the selected data array inside a VTK dataset.");
+    setErrorCondition(-20002, ss);
+    return;
+  }
+
+  // SMTK imports and writes the mesh in one call each, so the export can only be cancelled
+  // between them
+  if(getCancel())
+  {
+    return;
+  }
+
+  // Construct a mesh manager.
+  smtk::mesh::ManagerPtr manager = smtk::mesh::Manager::create();
+
+  // Import the vtkImageData into smtk::mesh.
+  notifyStatusMessage(QObject::tr("Importing %1 cells into SMTK").arg(dataSet->GetNumberOfCells()));
+  smtk::extension::vtk::io::mesh::ImportVTKData imprt;
+  smtk::mesh::CollectionPtr collection = imprt(dataSet, manager, m_Settings.selectedArrayPaths[0].getDataArrayName().toStdString());
+
+  if (!collection)
+  {
+    QString ss = QObject::tr("Unable to import the selected data array into an SMTK collection.");
+    setErrorCondition(-101003, ss);
+    return;
+  }
+
+  // The collection holds a full copy of the mesh; release it before returning to the pipeline
+  if(getCancel())
+  {
+    collection.reset();
+    manager.reset();
+    return;
+  }
+
+  notifyStatusMessage(QObject::tr("Writing the SMTK collection to '%1'").arg(m_Settings.outputFile));
+  bool didWrite = false;
+  QFileInfo outFi(m_Settings.outputFile);
+  if (outFi.completeSuffix() == "vtk" || outFi.completeSuffix() == "vtu")
+  {
+    smtk::io::ExportMesh exporter;
+    smtk::model::ManagerPtr manager = smtk::model::Manager::create();
+    didWrite = exporter(m_Settings.outputFile.toStdString(), collection);
+  }
+  else
+  {
+    smtk::io::WriteMesh writer;
+    didWrite = writer(m_Settings.outputFile.toStdString(), collection);
+  }
+
+  if (didWrite == false)
+  {
+    QString ss = QObject::tr("Unable to write MOAB mesh to the specified file.");
+    setErrorCondition(-101004, ss);
+    return;
+  }
+
+}
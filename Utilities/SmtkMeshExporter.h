@@ -0,0 +1,61 @@
+/* ============================================================================
+* Copyright (c) 2018 BlueQuartz Software, LLC
+*
+* Redistribution and use in source and binary forms, with or without modification,
+* are permitted provided that the following conditions are met:
+*
+* Redistributions of source code must retain the above copyright notice, this
+* list of conditions and the following disclaimer.
+*
+* Redistributions in binary form must reproduce the above copyright notice, this
+* list of conditions and the following disclaimer in the documentation and/or
+* other materials provided with the distribution.
+*
+* Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+* contributors may be used to endorse or promote products derived from this software
+* without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+* DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+* FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+* DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+* OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+* USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*
+* ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#pragma once
+
+#include "SIMPLib/DataContainers/DataContainer.h"
+
+#include "MeshExporter.h"
+
+/**
+ * @brief The SmtkMeshExporter class writes the selected arrays of a Data Container through
+ * SMTK: the geometry and the arrays are wrapped as a VTK dataset without copying them,
+ * imported into an SMTK mesh collection and written with the SMTK mesh writers. It handles
+ * the formats and geometries the native writers do not, at the cost of a full copy of the mesh.
+ */
+class SmtkMeshExporter : public MeshExporter
+{
+public:
+  SmtkMeshExporter(AbstractFilter* filter, const MeshExportSettings& settings);
+  ~SmtkMeshExporter() override;
+
+  /**
+   * @brief Imports the wrapped DataContainer into an SMTK collection and writes it with the
+   * SMTK mesh writers
+   * @param dc DataContainer that holds the selected array
+   */
+  void write(const DataContainer::Pointer& dc);
+
+public:
+  SmtkMeshExporter(const SmtkMeshExporter&) = delete;            // Copy Constructor Not Implemented
+  SmtkMeshExporter(SmtkMeshExporter&&) = delete;                 // Move Constructor Not Implemented
+  SmtkMeshExporter& operator=(const SmtkMeshExporter&) = delete; // Copy Assignment Not Implemented
+  SmtkMeshExporter& operator=(SmtkMeshExporter&&) = delete;      // Move Assignment Not Implemented
+};
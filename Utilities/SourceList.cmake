@@ -5,21 +5,66 @@ set(${PLUGIN_NAME}_Utilities_UIS "")
 
 
 set(${PLUGIN_NAME}_Utilities_HDRS
+  ${${PLUGIN_NAME}_SOURCE_DIR}/Utilities/BackgroundWriter.h
+  ${${PLUGIN_NAME}_SOURCE_DIR}/Utilities/ElementListH5mExporter.h
+  ${${PLUGIN_NAME}_SOURCE_DIR}/Utilities/ElementListMesher.h
+  ${${PLUGIN_NAME}_SOURCE_DIR}/Utilities/ExodusExporter.h
+  ${${PLUGIN_NAME}_SOURCE_DIR}/Utilities/ExodusStreamWriter.h
+  ${${PLUGIN_NAME}_SOURCE_DIR}/Utilities/FeatureBoundaryExporter.h
+  ${${PLUGIN_NAME}_SOURCE_DIR}/Utilities/FeatureBoundaryExtractor.h
+  ${${PLUGIN_NAME}_SOURCE_DIR}/Utilities/ImageRegion.h
+  ${${PLUGIN_NAME}_SOURCE_DIR}/Utilities/ImageSlabMesher.h
+  ${${PLUGIN_NAME}_SOURCE_DIR}/Utilities/LabelCountingSort.h
+  ${${PLUGIN_NAME}_SOURCE_DIR}/Utilities/MeshExporter.h
+  ${${PLUGIN_NAME}_SOURCE_DIR}/Utilities/MeshPartitioner.h
+  ${${PLUGIN_NAME}_SOURCE_DIR}/Utilities/MeshReorderer.h
+  ${${PLUGIN_NAME}_SOURCE_DIR}/Utilities/MoabH5mWriter.h
+  ${${PLUGIN_NAME}_SOURCE_DIR}/Utilities/NativeH5mExporter.h
+  ${${PLUGIN_NAME}_SOURCE_DIR}/Utilities/OctreeCoarsener.h
+  ${${PLUGIN_NAME}_SOURCE_DIR}/Utilities/OctreeExporter.h
   ${${PLUGIN_NAME}_SOURCE_DIR}/Utilities/SIMPLVtkBridge.h
+  ${${PLUGIN_NAME}_SOURCE_DIR}/Utilities/SmtkMeshExporter.h
+  ${${PLUGIN_NAME}_SOURCE_DIR}/Utilities/StreamingVtuExporter.h
+  ${${PLUGIN_NAME}_SOURCE_DIR}/Utilities/StructuredBoxExporter.h
   ${${PLUGIN_NAME}_SOURCE_DIR}/Utilities/VtkEdgeGeom.h
+  ${${PLUGIN_NAME}_SOURCE_DIR}/Utilities/VtkFixedCellGeom.h
+  ${${PLUGIN_NAME}_SOURCE_DIR}/Utilities/VtkHexahedralGeom.h
   ${${PLUGIN_NAME}_SOURCE_DIR}/Utilities/VtkQuadGeom.h
   ${${PLUGIN_NAME}_SOURCE_DIR}/Utilities/VtkTetrahedralGeom.h
   ${${PLUGIN_NAME}_SOURCE_DIR}/Utilities/VtkTriangleGeom.h
   ${${PLUGIN_NAME}_SOURCE_DIR}/Utilities/VtkVertexGeom.h
+  ${${PLUGIN_NAME}_SOURCE_DIR}/Utilities/VtuStreamWriter.h
 )
 
 set(${PLUGIN_NAME}_Utilities_SRCS
+  ${${PLUGIN_NAME}_SOURCE_DIR}/Utilities/BackgroundWriter.cpp
+  ${${PLUGIN_NAME}_SOURCE_DIR}/Utilities/ElementListH5mExporter.cpp
+  ${${PLUGIN_NAME}_SOURCE_DIR}/Utilities/ElementListMesher.cpp
+  ${${PLUGIN_NAME}_SOURCE_DIR}/Utilities/ExodusExporter.cpp
+  ${${PLUGIN_NAME}_SOURCE_DIR}/Utilities/ExodusStreamWriter.cpp
+  ${${PLUGIN_NAME}_SOURCE_DIR}/Utilities/FeatureBoundaryExporter.cpp
+  ${${PLUGIN_NAME}_SOURCE_DIR}/Utilities/FeatureBoundaryExtractor.cpp
+  ${${PLUGIN_NAME}_SOURCE_DIR}/Utilities/ImageRegion.cpp
+  ${${PLUGIN_NAME}_SOURCE_DIR}/Utilities/ImageSlabMesher.cpp
+  ${${PLUGIN_NAME}_SOURCE_DIR}/Utilities/LabelCountingSort.cpp
+  ${${PLUGIN_NAME}_SOURCE_DIR}/Utilities/MeshExporter.cpp
+  ${${PLUGIN_NAME}_SOURCE_DIR}/Utilities/MeshPartitioner.cpp
+  ${${PLUGIN_NAME}_SOURCE_DIR}/Utilities/MeshReorderer.cpp
+  ${${PLUGIN_NAME}_SOURCE_DIR}/Utilities/MoabH5mWriter.cpp
+  ${${PLUGIN_NAME}_SOURCE_DIR}/Utilities/NativeH5mExporter.cpp
+  ${${PLUGIN_NAME}_SOURCE_DIR}/Utilities/OctreeCoarsener.cpp
+  ${${PLUGIN_NAME}_SOURCE_DIR}/Utilities/OctreeExporter.cpp
   ${${PLUGIN_NAME}_SOURCE_DIR}/Utilities/SIMPLVtkBridge.cpp
+  ${${PLUGIN_NAME}_SOURCE_DIR}/Utilities/SmtkMeshExporter.cpp
+  ${${PLUGIN_NAME}_SOURCE_DIR}/Utilities/StreamingVtuExporter.cpp
+  ${${PLUGIN_NAME}_SOURCE_DIR}/Utilities/StructuredBoxExporter.cpp
   ${${PLUGIN_NAME}_SOURCE_DIR}/Utilities/VtkEdgeGeom.cpp
+  ${${PLUGIN_NAME}_SOURCE_DIR}/Utilities/VtkHexahedralGeom.cpp
   ${${PLUGIN_NAME}_SOURCE_DIR}/Utilities/VtkQuadGeom.cpp
   ${${PLUGIN_NAME}_SOURCE_DIR}/Utilities/VtkTetrahedralGeom.cpp
   ${${PLUGIN_NAME}_SOURCE_DIR}/Utilities/VtkTriangleGeom.cpp
   ${${PLUGIN_NAME}_SOURCE_DIR}/Utilities/VtkVertexGeom.cpp
+  ${${PLUGIN_NAME}_SOURCE_DIR}/Utilities/VtuStreamWriter.cpp
 )
 
 # Organize the Source files for things like Visual Studio and Xcode
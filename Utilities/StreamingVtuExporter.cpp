@@ -0,0 +1,229 @@
+/* ============================================================================
+* Copyright (c) 2018 BlueQuartz Software, LLC
+*
+* Redistribution and use in source and binary forms, with or without modification,
+* are permitted provided that the following conditions are met:
+*
+* Redistributions of source code must retain the above copyright notice, this
+* list of conditions and the following disclaimer.
+*
+* Redistributions in binary form must reproduce the above copyright notice, this
+* list of conditions and the following disclaimer in the documentation and/or
+* other materials provided with the distribution.
+*
+* Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+* contributors may be used to endorse or promote products derived from this software
+* without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+* DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+* FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+* DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+* OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+* USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*
+* ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#include "StreamingVtuExporter.h"
+
+#include <algorithm>
+
+#include "BackgroundWriter.h"
+#include "ImageSlabMesher.h"
+#include "MeshReorderer.h"
+#include "VtuStreamWriter.h"
+
+#include "vtkCellType.h"
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+StreamingVtuExporter::StreamingVtuExporter(AbstractFilter* filter, const MeshExportSettings& settings)
+: MeshExporter(filter, settings)
+{
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+StreamingVtuExporter::~StreamingVtuExporter() = default;
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void StreamingVtuExporter::write(const ImageGeom::Pointer& image)
+{
+  size_t dims[3] = {0, 0, 0};
+  float res[3] = {0.0f, 0.0f, 0.0f};
+  float origin[3] = {0.0f, 0.0f, 0.0f};
+
+  ImageRegion region = getRegion(image, dims, res, origin);
+
+  ImageSlabMesher mesher(dims, res, origin);
+  size_t slabLayers = getSlabLayers(mesher, true, 1);
+  if(slabLayers == 0)
+  {
+    return;
+  }
+
+  std::vector<VtuStreamWriter::DataArrayInfo> arrayInfos;
+  for(int i = 0; i < m_Settings.selectedArrayPaths.size(); i++)
+  {
+    IDataArray::Pointer selectedArray = m_Settings.selectedWeakPtrVector[i].lock();
+    ExportTypeInfo typeInfo;
+    GetExportTypeInfo(selectedArray->getTypeAsString(), typeInfo);
+
+    VtuStreamWriter::DataArrayInfo arrayInfo;
+    arrayInfo.name = m_Settings.selectedArrayPaths[i].getDataArrayName().toStdString();
+    arrayInfo.vtkType = typeInfo.vtkType;
+    arrayInfo.numComponents = selectedArray->getNumberOfComponents();
+    arrayInfo.componentSize = typeInfo.size;
+    arrayInfos.push_back(arrayInfo);
+  }
+
+  VtuStreamWriter writer;
+  if(writer.openFile(m_Settings.outputFile.toStdString(), mesher.getNumberOfNodes(), mesher.getNumberOfElements(), VTK_HEXAHEDRON, 8, arrayInfos) < 0)
+  {
+    QString ss = QObject::tr("Unable to create the output file '%1'.").arg(m_Settings.outputFile);
+    setErrorCondition(-101014, ss);
+    return;
+  }
+
+  MeshReorderer reorderer(static_cast<MeshReorderer::Ordering>(m_Settings.meshOrdering));
+  orderMesh(reorderer, dims);
+  bool reordered = !reorderer.isNatural();
+  const size_t* elementOrder = reorderer.getElementOrder().data();
+
+  size_t elementsPerLayer = mesher.getElementsPerLayer();
+  size_t numLayers = mesher.getNumberOfElementLayers();
+
+  size_t bufferBytes = std::max(mesher.getNodeBufferSize(slabLayers) * sizeof(double), mesher.getConnectivityBufferSize(slabLayers) * sizeof(int64_t));
+  for(const VtuStreamWriter::DataArrayInfo& arrayInfo : arrayInfos)
+  {
+    if(!region.isLayerContiguous() || reordered)
+    {
+      bufferBytes = std::max(bufferBytes, slabLayers * elementsPerLayer * arrayInfo.componentSize * static_cast<size_t>(arrayInfo.numComponents));
+    }
+  }
+
+  // The appended blocks have to be written in the order the header lists them. Each slab is
+  // generated by the worker threads while the writer thread appends the previous ones.
+  double totalBytes = (3.0 * sizeof(double)) * mesher.getNumberOfNodes() + (9.0 * sizeof(int64_t) + 1.0) * mesher.getNumberOfElements();
+  for(const VtuStreamWriter::DataArrayInfo& arrayInfo : arrayInfos)
+  {
+    totalBytes += static_cast<double>(mesher.getNumberOfElements() * arrayInfo.componentSize * static_cast<size_t>(arrayInfo.numComponents));
+  }
+  ExportProgress progress(m_Filter, totalBytes);
+
+  BackgroundWriter pipeline(WriteQueueDepth, bufferBytes);
+  auto beginBlock = [&writer] { return writer.beginBlock(); };
+
+  bool queued = pipeline.submit(beginBlock);
+  size_t numNodeLayers = mesher.getNumberOfNodeLayers();
+  for(size_t z = 0; z < numNodeLayers && queued; z += slabLayers)
+  {
+    size_t zEnd = std::min(z + slabLayers, numNodeLayers);
+    double* xyz = static_cast<double*>(pipeline.getBuffer());
+    if(reordered)
+    {
+      mesher.generateNodeList(reorderer.getNodeOrder().data() + z * mesher.getNodesPerLayer(), (zEnd - z) * mesher.getNodesPerLayer(), xyz);
+    }
+    else
+    {
+      mesher.generateNodes(z, zEnd, xyz);
+    }
+    size_t numBytes = mesher.getNodeBufferSize(zEnd - z) * sizeof(double);
+    queued = pipeline.submit([&writer, xyz, numBytes] { return writer.writeData(xyz, numBytes); });
+    queued = queued && progress.advance(QObject::tr("Writing nodes"), static_cast<double>(numBytes));
+  }
+
+  for(size_t i = 0; i < arrayInfos.size() && queued; i++)
+  {
+    const VtuStreamWriter::DataArrayInfo& arrayInfo = arrayInfos[i];
+    IDataArray::Pointer selectedArray = m_Settings.selectedWeakPtrVector[static_cast<int>(i)].lock();
+    size_t tupleBytes = arrayInfo.componentSize * static_cast<size_t>(arrayInfo.numComponents);
+    QString stage = QObject::tr("Writing %1").arg(m_Settings.selectedArrayPaths[static_cast<int>(i)].getDataArrayName());
+    queued = pipeline.submit(beginBlock);
+    for(size_t z = 0; z < numLayers && queued; z += slabLayers)
+    {
+      size_t zEnd = std::min(z + slabLayers, numLayers);
+      const void* values = nullptr;
+      if(reordered)
+      {
+        values = GatherCells(region, selectedArray->getVoidPointer(0), tupleBytes, elementOrder + z * elementsPerLayer, (zEnd - z) * elementsPerLayer, pipeline.getBuffer());
+      }
+      else
+      {
+        values = region.gatherLayers(selectedArray->getVoidPointer(0), tupleBytes, z, zEnd, pipeline.getBuffer());
+      }
+      size_t numBytes = (zEnd - z) * elementsPerLayer * tupleBytes;
+      queued = pipeline.submit([&writer, values, numBytes] { return writer.writeData(values, numBytes); });
+      queued = queued && progress.advance(stage, static_cast<double>(numBytes));
+    }
+  }
+
+  queued = queued && pipeline.submit(beginBlock);
+  for(size_t z = 0; z < numLayers && queued; z += slabLayers)
+  {
+    size_t zEnd = std::min(z + slabLayers, numLayers);
+    int64_t* connectivity = static_cast<int64_t*>(pipeline.getBuffer());
+    if(reordered)
+    {
+      mesher.generateElementConnectivity(elementOrder + z * elementsPerLayer, (zEnd - z) * elementsPerLayer, 0, connectivity, reorderer.getNodeIds().data());
+    }
+    else
+    {
+      mesher.generateConnectivity(z, zEnd, 0, connectivity);
+    }
+    size_t numBytes = mesher.getConnectivityBufferSize(zEnd - z) * sizeof(int64_t);
+    queued = pipeline.submit([&writer, connectivity, numBytes] { return writer.writeData(connectivity, numBytes); });
+    queued = queued && progress.advance(QObject::tr("Writing connectivity"), static_cast<double>(numBytes));
+  }
+
+  queued = queued && pipeline.submit(beginBlock);
+  for(size_t z = 0; z < numLayers && queued; z += slabLayers)
+  {
+    size_t zEnd = std::min(z + slabLayers, numLayers);
+    size_t count = (zEnd - z) * elementsPerLayer;
+    int64_t* offsets = static_cast<int64_t*>(pipeline.getBuffer());
+    int64_t cellOffset = static_cast<int64_t>(z * elementsPerLayer) * 8;
+    for(size_t c = 0; c < count; c++)
+    {
+      cellOffset += 8;
+      offsets[c] = cellOffset;
+    }
+    queued = pipeline.submit([&writer, offsets, count] { return writer.writeData(offsets, count * sizeof(int64_t)); });
+    queued = queued && progress.advance(QObject::tr("Writing offsets"), static_cast<double>(count * sizeof(int64_t)));
+  }
+
+  queued = queued && pipeline.submit(beginBlock);
+  for(size_t z = 0; z < numLayers && queued; z += slabLayers)
+  {
+    size_t zEnd = std::min(z + slabLayers, numLayers);
+    size_t count = (zEnd - z) * elementsPerLayer;
+    uint8_t* types = static_cast<uint8_t*>(pipeline.getBuffer());
+    std::fill_n(types, count, static_cast<uint8_t>(VTK_HEXAHEDRON));
+    queued = pipeline.submit([&writer, types, count] { return writer.writeData(types, count); });
+    queued = queued && progress.advance(QObject::tr("Writing cell types"), static_cast<double>(count));
+  }
+
+  int err = pipeline.finish();
+
+  // A cancelled file lacks its last blocks, so the writer reports it as incomplete
+  bool closed = (writer.closeFile() >= 0);
+  m_StoppedEarly = !queued && getCancel();
+  if(m_StoppedEarly)
+  {
+    return;
+  }
+  if(!closed || err < 0)
+  {
+    QString ss = QObject::tr("Unable to write the VTK unstructured grid to the specified file.");
+    setErrorCondition(-101004, ss);
+    return;
+  }
+}
@@ -0,0 +1,57 @@
+/* ============================================================================
+* Copyright (c) 2018 BlueQuartz Software, LLC
+*
+* Redistribution and use in source and binary forms, with or without modification,
+* are permitted provided that the following conditions are met:
+*
+* Redistributions of source code must retain the above copyright notice, this
+* list of conditions and the following disclaimer.
+*
+* Redistributions in binary form must reproduce the above copyright notice, this
+* list of conditions and the following disclaimer in the documentation and/or
+* other materials provided with the distribution.
+*
+* Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+* contributors may be used to endorse or promote products derived from this software
+* without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+* DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+* FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+* DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+* OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+* USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*
+* ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#pragma once
+
+#include "MeshExporter.h"
+
+/**
+ * @brief The StreamingVtuExporter class writes an ImageGeom as an appended VTK XML unstructured
+ * grid through VtuStreamWriter, generating the nodes and connectivity one Z slab at a time
+ * within the memory budget.
+ */
+class StreamingVtuExporter : public MeshExporter
+{
+public:
+  StreamingVtuExporter(AbstractFilter* filter, const MeshExportSettings& settings);
+  ~StreamingVtuExporter() override;
+
+  /**
+   * @brief Writes the ImageGeom as Hex8 cells with one cell array per selected array
+   * @param image ImageGeom that holds the selected array
+   */
+  void write(const ImageGeom::Pointer& image);
+
+public:
+  StreamingVtuExporter(const StreamingVtuExporter&) = delete;            // Copy Constructor Not Implemented
+  StreamingVtuExporter(StreamingVtuExporter&&) = delete;                 // Move Constructor Not Implemented
+  StreamingVtuExporter& operator=(const StreamingVtuExporter&) = delete; // Copy Assignment Not Implemented
+  StreamingVtuExporter& operator=(StreamingVtuExporter&&) = delete;      // Move Assignment Not Implemented
+};
@@ -0,0 +1,251 @@
+/* ============================================================================
+* Copyright (c) 2018 BlueQuartz Software, LLC
+*
+* Redistribution and use in source and binary forms, with or without modification,
+* are permitted provided that the following conditions are met:
+*
+* Redistributions of source code must retain the above copyright notice, this
+* list of conditions and the following disclaimer.
+*
+* Redistributions in binary form must reproduce the above copyright notice, this
+* list of conditions and the following disclaimer in the documentation and/or
+* other materials provided with the distribution.
+*
+* Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+* contributors may be used to endorse or promote products derived from this software
+* without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+* DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+* FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+* DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+* OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+* USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*
+* ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#include "StructuredBoxExporter.h"
+
+#include <algorithm>
+#include <string>
+#include <vector>
+
+#ifdef DEBUG
+#undef DEBUG
+#define DEBUG_StructuredBoxExporter
+#endif
+
+#include "moab/Core.hpp"
+#include "moab/ScdInterface.hpp"
+
+#ifdef DEBUG_StructuredBoxExporter
+#define DEBUG
+#endif
+
+#include "LabelCountingSort.h"
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+StructuredBoxExporter::StructuredBoxExporter(AbstractFilter* filter, const MeshExportSettings& settings)
+: MeshExporter(filter, settings)
+{
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+StructuredBoxExporter::~StructuredBoxExporter() = default;
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void StructuredBoxExporter::write(const ImageGeom::Pointer& image)
+{
+  size_t dims[3] = {0, 0, 0};
+  float res[3] = {0.0f, 0.0f, 0.0f};
+  float origin[3] = {0.0f, 0.0f, 0.0f};
+
+  ImageRegion region = getRegion(image, dims, res, origin);
+
+  moab::Core mbCore;
+  moab::ScdInterface* scdIface = nullptr;
+  if(mbCore.query_interface(scdIface) != moab::MB_SUCCESS || nullptr == scdIface)
+  {
+    QString ss = QObject::tr("Unable to obtain the MOAB structured mesh interface.");
+    setErrorCondition(-101007, ss);
+    return;
+  }
+
+  // The box stores its element connectivity implicitly; only the vertex coordinates are allocated
+  moab::ScdBox* box = nullptr;
+  moab::HomCoord low(0, 0, 0);
+  moab::HomCoord high(static_cast<int>(dims[0]), static_cast<int>(dims[1]), static_cast<int>(dims[2]));
+  if(scdIface->construct_box(low, high, nullptr, 0, box) != moab::MB_SUCCESS || nullptr == box)
+  {
+    QString ss = QObject::tr("Unable to create a MOAB structured box for the selected ImageGeom.");
+    setErrorCondition(-101008, ss);
+    return;
+  }
+
+  // Fill the vertex coordinates in place. Box vertices are ordered with X varying fastest.
+  moab::Range verts(box->start_vertex(), box->start_vertex() + box->num_vertices() - 1);
+  double* xCoords = nullptr;
+  double* yCoords = nullptr;
+  double* zCoords = nullptr;
+  int count = 0;
+  if(mbCore.coords_iterate(verts.begin(), verts.end(), xCoords, yCoords, zCoords, count) != moab::MB_SUCCESS || count != box->num_vertices())
+  {
+    QString ss = QObject::tr("Unable to access the vertex coordinates of the MOAB structured box.");
+    setErrorCondition(-101009, ss);
+    return;
+  }
+
+  // MOAB writes the whole box in one call at the end, so the progress covers building it
+  double totalBytes = 3.0 * sizeof(double) * box->num_vertices();
+  for(const IDataArray::WeakPointer& weakPtr : m_Settings.selectedWeakPtrVector)
+  {
+    IDataArray::Pointer selectedArray = weakPtr.lock();
+    ExportTypeInfo typeInfo;
+    GetExportTypeInfo(selectedArray->getTypeAsString(), typeInfo);
+    totalBytes += static_cast<double>(region.getNumberOfCells() * typeInfo.size * static_cast<size_t>(selectedArray->getNumberOfComponents()));
+  }
+  ExportProgress progress(m_Filter, totalBytes);
+  double nodeLayerBytes = 3.0 * sizeof(double) * (dims[0] + 1) * (dims[1] + 1);
+
+  size_t index = 0;
+  bool running = true;
+  for(size_t z = 0; z <= dims[2] && running; z++)
+  {
+    for(size_t y = 0; y <= dims[1]; y++)
+    {
+      for(size_t x = 0; x <= dims[0]; x++)
+      {
+        xCoords[index] = origin[0] + x * res[0];
+        yCoords[index] = origin[1] + y * res[1];
+        zCoords[index] = origin[2] + z * res[2];
+        index++;
+      }
+    }
+    running = progress.advance(QObject::tr("Building nodes"), nodeLayerBytes);
+  }
+
+  // Box elements share the X fastest ordering of the SIMPL cell arrays, so each tag is set in one call
+  // unless a region of interest has to be gathered layer by layer. The tag names match the ones the
+  // SMTK import path produces so all modes write interchangeable files.
+  size_t cellsPerLayer = region.getCellsPerLayer();
+  size_t layersPerCall = region.isLayerContiguous() ? dims[2] : 1;
+  std::vector<hid_t> hdf5TypeHints;
+  for(int i = 0; i < m_Settings.selectedArrayPaths.size() && getErrorCondition() >= 0 && running; i++)
+  {
+    IDataArray::Pointer selectedArray = m_Settings.selectedWeakPtrVector[i].lock();
+    ExportTypeInfo typeInfo;
+    GetExportTypeInfo(selectedArray->getTypeAsString(), typeInfo);
+    int numComps = selectedArray->getNumberOfComponents();
+
+    // Arrays without a native MOAB tag type are stored as opaque bytes of the same width. The
+    // __hdf5_tag_type_ hint tells MOAB's HDF5 writer which element type the bytes hold.
+    std::string tagName = m_Settings.selectedArrayPaths[i].getDataArrayName().toStdString() + "_";
+    int tagSize = (typeInfo.moabType == moab::MB_TYPE_OPAQUE) ? static_cast<int>(typeInfo.size) * numComps : numComps;
+    moab::Tag tag = nullptr;
+    bool tagged = mbCore.tag_get_handle(tagName.c_str(), tagSize, typeInfo.moabType, tag, moab::MB_TAG_DENSE | moab::MB_TAG_CREAT) == moab::MB_SUCCESS;
+
+    size_t tupleBytes = typeInfo.size * static_cast<size_t>(numComps);
+    std::vector<uint8_t> layerBuffer(region.isLayerContiguous() ? 0 : cellsPerLayer * tupleBytes);
+    QString stage = QObject::tr("Tagging %1").arg(m_Settings.selectedArrayPaths[i].getDataArrayName());
+    for(size_t z = 0; z < dims[2] && tagged && running; z += layersPerCall)
+    {
+      size_t zEnd = std::min(z + layersPerCall, dims[2]);
+      moab::Range cells(box->start_element() + z * cellsPerLayer, box->start_element() + zEnd * cellsPerLayer - 1);
+      tagged = mbCore.tag_set_data(tag, cells, region.gatherLayers(selectedArray->getVoidPointer(0), tupleBytes, z, zEnd, layerBuffer.data())) == moab::MB_SUCCESS;
+      running = progress.advance(stage, static_cast<double>((zEnd - z) * cellsPerLayer * tupleBytes));
+    }
+
+    if(tagged && typeInfo.moabType == moab::MB_TYPE_OPAQUE)
+    {
+      hsize_t arrayDims[1] = {static_cast<hsize_t>(numComps)};
+      hid_t hdf5Type = (numComps > 1) ? H5Tarray_create2(typeInfo.hdf5Type, 1, arrayDims) : H5Tcopy(typeInfo.hdf5Type);
+      hdf5TypeHints.push_back(hdf5Type);
+
+      std::string hintName = "__hdf5_tag_type_" + tagName;
+      moab::Tag hintTag = nullptr;
+      moab::EntityHandle root = 0;
+      tagged = mbCore.tag_get_handle(hintName.c_str(), sizeof(hid_t), moab::MB_TYPE_OPAQUE, hintTag, moab::MB_TAG_SPARSE | moab::MB_TAG_CREAT) == moab::MB_SUCCESS &&
+               mbCore.tag_set_data(hintTag, &root, 1, &hdf5Type) == moab::MB_SUCCESS;
+    }
+
+    if(!tagged)
+    {
+      QString ss = QObject::tr("Unable to store the data array '%1' as a tag on the MOAB structured box.").arg(m_Settings.selectedArrayPaths[i].getDataArrayName());
+      setErrorCondition(-101010, ss);
+    }
+  }
+
+  if(m_Settings.writeFeatureSets && getErrorCondition() >= 0 && running)
+  {
+    LabelCountingSort sorter;
+    std::vector<int32_t> buffer;
+    if(!sortFeatureIds(sorter, gatherFeatureIds(region, buffer), region.getNumberOfCells()))
+    {
+      return;
+    }
+
+    // One MESHSET_SET per Feature. Its cells are added as ranges of consecutive hexes, which
+    // MOAB stores compactly, so sets of well connected Features stay small.
+    const std::vector<int32_t>& featureIds = sorter.getLabels();
+    const std::vector<size_t>& offsets = sorter.getOffsets();
+    const std::vector<size_t>& order = sorter.getOrder();
+    moab::Tag materialTag = nullptr;
+    bool tagged = mbCore.tag_get_handle(MaterialSetTagName, 1, moab::MB_TYPE_INTEGER, materialTag, moab::MB_TAG_SPARSE | moab::MB_TAG_CREAT) == moab::MB_SUCCESS;
+    for(size_t f = 0; f < featureIds.size() && tagged; f++)
+    {
+      moab::Range cells;
+      for(size_t i = offsets[f]; i < offsets[f + 1];)
+      {
+        size_t runEnd = i + 1;
+        while(runEnd < offsets[f + 1] && order[runEnd] == order[runEnd - 1] + 1)
+        {
+          runEnd++;
+        }
+        cells.insert(box->start_element() + order[i], box->start_element() + order[runEnd - 1]);
+        i = runEnd;
+      }
+
+      moab::EntityHandle featureSet = 0;
+      tagged = mbCore.create_meshset(moab::MESHSET_SET, featureSet) == moab::MB_SUCCESS && mbCore.add_entities(featureSet, cells) == moab::MB_SUCCESS &&
+               mbCore.tag_set_data(materialTag, &featureSet, 1, &featureIds[f]) == moab::MB_SUCCESS;
+    }
+
+    if(!tagged)
+    {
+      QString ss = QObject::tr("Unable to create the Feature meshsets on the MOAB structured box.");
+      setErrorCondition(-101021, ss);
+    }
+  }
+
+  running = running && !getCancel();
+  if(running && getErrorCondition() >= 0)
+  {
+    notifyStatusMessage(QObject::tr("Writing the structured box to '%1'").arg(m_Settings.outputFile));
+  }
+  bool didWrite = running && getErrorCondition() >= 0 && mbCore.write_file(m_Settings.outputFile.toStdString().c_str()) == moab::MB_SUCCESS;
+  for(hid_t hdf5Type : hdf5TypeHints)
+  {
+    H5Tclose(hdf5Type);
+  }
+  if(getErrorCondition() < 0 || !running)
+  {
+    return;
+  }
+
+  if(!didWrite)
+  {
+    QString ss = QObject::tr("Unable to write MOAB mesh to the specified file.");
+    setErrorCondition(-101004, ss);
+    return;
+  }
+}
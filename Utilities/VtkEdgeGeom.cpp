@@ -33,15 +33,10 @@
 *
 * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
 
-#include "VtkEdgeGeom.h"
-
-#include <cmath>
 
-#include <vtkIdTypeArray.h>
-#include <vtkCellType.h>
-#include <vtkCellTypes.h>
+#include "VtkEdgeGeom.h"
 
-const int CELL_TYPE = VTK_LINE;
+template class VtkFixedCellGeom<EdgeGeom, VTK_LINE, 2>;
 
 // -----------------------------------------------------------------------------
 //
@@ -50,183 +45,3 @@ VtkEdgeGrid* VtkEdgeGrid::New()
 {
   return new VtkEdgeGrid();
 }
-
-// -----------------------------------------------------------------------------
-//
-// -----------------------------------------------------------------------------
-VtkEdgeGeom* VtkEdgeGeom::New()
-{
-  return new VtkEdgeGeom();
-}
-
-// -----------------------------------------------------------------------------
-//
-// -----------------------------------------------------------------------------
-void VtkEdgeGeom::PrintSelf(ostream &os, vtkIndent indent)
-{
-  this->Superclass::PrintSelf(os, indent);
-  os << indent << "Elements: " << GetNumberOfCells() << endl;
-  os << indent << "CellType: "
-    << vtkCellTypes::GetClassNameFromTypeId(CELL_TYPE) << endl;
-  os << indent << "CellSize: " << GetMaxCellSize() << endl;
-  os << indent << "NumberOfCells: " << GetNumberOfCells() << endl;
-}
-
-// -----------------------------------------------------------------------------
-//
-// -----------------------------------------------------------------------------
-VtkEdgeGeom::VtkEdgeGeom()
-  : vtkObject()
-{
-}
-
-// -----------------------------------------------------------------------------
-//
-// -----------------------------------------------------------------------------
-void VtkEdgeGeom::SetGeometry(EdgeGeom::Pointer geom)
-{
-  m_Geom = geom;
-}
-
-// -----------------------------------------------------------------------------
-//
-// -----------------------------------------------------------------------------
-vtkIdType VtkEdgeGeom::GetNumberOfCells()
-{
-  if(nullptr == m_Geom)
-  {
-    vtkErrorMacro("Wrapper Geometry missing a Geometry object");
-    return -1;
-  }
-
-  return m_Geom->getNumberOfElements();
-}
-
-// -----------------------------------------------------------------------------
-//
-// -----------------------------------------------------------------------------
-int VtkEdgeGeom::GetCellType(vtkIdType cellId)
-{
-  if(0 == GetNumberOfCells())
-  {
-    return VTK_EMPTY_CELL;
-  }
-
-  return CELL_TYPE;
-}
-
-// -----------------------------------------------------------------------------
-//
-// -----------------------------------------------------------------------------
-void VtkEdgeGeom::GetCellPoints(vtkIdType cellId, vtkIdList *ptIds)
-{
-  const int numVerts = 2;
-
-  int64_t verts[numVerts];
-  m_Geom->getVertsAtEdge(cellId, verts);
-
-  ptIds->SetNumberOfIds(numVerts);
-  for(int i = 0; i < numVerts; i++)
-  {
-    ptIds->SetId(i, verts[i]);
-  }
-
-}
-
-// -----------------------------------------------------------------------------
-//
-// -----------------------------------------------------------------------------
-void VtkEdgeGeom::GetPointCells(vtkIdType ptId, vtkIdList *cellIds)
-{
-  ElementDynamicList::Pointer elementsContainingList = m_Geom->getElementsContainingVert();
-
-  DynamicListArray<uint16_t, int64_t>::ElementList listArray = elementsContainingList->getElementList(ptId);
-
-  cellIds->SetNumberOfIds(listArray.ncells);
-  for(int i = 0; i < listArray.ncells; i++)
-  {
-    cellIds->SetId(i, listArray.cells[i]);
-  }
-}
-
-// -----------------------------------------------------------------------------
-//
-// -----------------------------------------------------------------------------
-int VtkEdgeGeom::GetMaxCellSize()
-{
-  return std::ceil(m_MaxCellSize);
-}
-
-// -----------------------------------------------------------------------------
-//
-// -----------------------------------------------------------------------------
-void VtkEdgeGeom::GetIdsOfCellsOfType(int type, vtkIdTypeArray *array)
-{
-  if(CELL_TYPE == type)
-  {
-    int numValues = GetNumberOfCells();
-
-    array = vtkIdTypeArray::New();
-    array->SetNumberOfTuples(numValues);
-    array->SetNumberOfComponents(1);
-
-    vtkIdType* arrayValues = new vtkIdType[numValues];
-    for(int i = 0; i < numValues; i++)
-    {
-      arrayValues[i] = i;
-    }
-
-    array->SetVoidArray(arrayValues, numValues, 0);
-  }
-}
-
-// -----------------------------------------------------------------------------
-//
-// -----------------------------------------------------------------------------
-int VtkEdgeGeom::IsHomogeneous()
-{
-  return 1;
-}
-
-// -----------------------------------------------------------------------------
-//
-// -----------------------------------------------------------------------------
-void VtkEdgeGeom::Allocate(vtkIdType numCells, int extSize)
-{
-  vtkErrorMacro("Read only container.");
-}
-
-// -----------------------------------------------------------------------------
-//
-// -----------------------------------------------------------------------------
-vtkIdType VtkEdgeGeom::InsertNextCell(int type, vtkIdList *ptIds)
-{
-  vtkErrorMacro("Read only container.");
-  return -1;
-}
-
-// -----------------------------------------------------------------------------
-//
-// -----------------------------------------------------------------------------
-vtkIdType VtkEdgeGeom::InsertNextCell(int type, vtkIdType npts, vtkIdType *ptIds)
-{
-  vtkErrorMacro("Read only container.");
-  return -1;
-}
-
-// -----------------------------------------------------------------------------
-//
-// -----------------------------------------------------------------------------
-vtkIdType VtkEdgeGeom::InsertNextCell(int type, vtkIdType npts, vtkIdType *ptIds, vtkIdType nfaces, vtkIdType *faces)
-{
-  vtkErrorMacro("Read only container.");
-  return -1;
-}
-
-// -----------------------------------------------------------------------------
-//
-// -----------------------------------------------------------------------------
-void VtkEdgeGeom::ReplaceCell(vtkIdType cellId, int npts, vtkIdType *pts)
-{
-  vtkErrorMacro("Read only container.");
-}
@@ -0,0 +1,764 @@
+/* ============================================================================
+* Copyright (c) 2009-2016 BlueQuartz Software, LLC
+*
+* Redistribution and use in source and binary forms, with or without modification,
+* are permitted provided that the following conditions are met:
+*
+* Redistributions of source code must retain the above copyright notice, this
+* list of conditions and the following disclaimer.
+*
+* Redistributions in binary form must reproduce the above copyright notice, this
+* list of conditions and the following disclaimer in the documentation and/or
+* other materials provided with the distribution.
+*
+* Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+* contributors may be used to endorse or promote products derived from this software
+* without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+* DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+* FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+* DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+* OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+* USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*
+* The code contained herein was partially funded by the followig contracts:
+*    United States Air Force Prime Contract FA8650-07-D-5800
+*    United States Air Force Prime Contract FA8650-10-D-5210
+*    United States Prime Contract Navy N00173-07-C-2068
+*
+* ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <numeric>
+#include <vector>
+
+#include <vtkCellArray.h>
+#include <vtkCellType.h>
+#include <vtkCellTypes.h>
+#include <vtkIdList.h>
+#include <vtkIdTypeArray.h>
+#include <vtkMappedUnstructuredGrid.h>
+#include <vtkSmartPointer.h>
+
+#include "SIMPLib/SIMPLib.h"
+
+#include "SIMPLib/Geometry/EdgeGeom.h"
+#include "SIMPLib/Geometry/HexahedralGeom.h"
+#include "SIMPLib/Geometry/QuadGeom.h"
+#include "SIMPLib/Geometry/TetrahedralGeom.h"
+#include "SIMPLib/Geometry/TriangleGeom.h"
+#include "SIMPLib/Geometry/VertexGeom.h"
+
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_for.h>
+#include <tbb/partitioner.h>
+#endif
+
+namespace VtkFixedCell
+{
+/**
+ * @brief Returns the shared element list of the geometry. A VertexGeom has none because
+ * each of its vertices is a cell.
+ */
+inline Int64ArrayType::Pointer GetElementList(VertexGeom& /*geom*/)
+{
+  return Int64ArrayType::NullPointer();
+}
+inline Int64ArrayType::Pointer GetElementList(EdgeGeom& geom)
+{
+  return geom.getEdges();
+}
+inline Int64ArrayType::Pointer GetElementList(TriangleGeom& geom)
+{
+  return geom.getTriangles();
+}
+inline Int64ArrayType::Pointer GetElementList(QuadGeom& geom)
+{
+  return geom.getQuads();
+}
+inline Int64ArrayType::Pointer GetElementList(TetrahedralGeom& geom)
+{
+  return geom.getTetrahedra();
+}
+inline Int64ArrayType::Pointer GetElementList(HexahedralGeom& geom)
+{
+  return geom.getHexahedra();
+}
+
+/**
+ * @brief Writes a range of cells in the vtkCellArray layout, the point count of each cell
+ * followed by its point IDs
+ */
+template <int NVerts>
+class CellArrayImpl
+{
+public:
+  CellArrayImpl(const int64_t* connectivity, vtkIdType* cells)
+  : m_Connectivity(connectivity)
+  , m_Cells(cells)
+  {
+  }
+
+  void convert(vtkIdType start, vtkIdType end) const
+  {
+    for(vtkIdType cellId = start; cellId < end; cellId++)
+    {
+      vtkIdType* cell = m_Cells + cellId * (NVerts + 1);
+      cell[0] = NVerts;
+      if(nullptr == m_Connectivity)
+      {
+        cell[1] = cellId;
+        continue;
+      }
+      const int64_t* verts = m_Connectivity + cellId * NVerts;
+      for(int i = 0; i < NVerts; i++)
+      {
+        cell[i + 1] = static_cast<vtkIdType>(verts[i]);
+      }
+    }
+  }
+
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+  void operator()(const tbb::blocked_range<vtkIdType>& r) const
+  {
+    convert(r.begin(), r.end());
+  }
+#endif
+
+private:
+  const int64_t* m_Connectivity;
+  vtkIdType* m_Cells;
+};
+
+/**
+ * @brief Point to cell links of a geometry, built at most once. When the geometry already
+ * holds its elements containing each vertex those are read instead; otherwise the cells of
+ * vertex v are cells[offsets[v]] to cells[offsets[v + 1] - 1], in ascending order.
+ */
+struct PointCellLinks
+{
+  std::once_flag built;
+  ElementDynamicList::Pointer geomLinks;
+  std::vector<int64_t> offsets;
+  std::vector<int64_t> cells;
+};
+
+/**
+ * @brief Counts the cells that use each vertex over a range of cells
+ */
+template <int NVerts>
+class CountPointCellsImpl
+{
+public:
+  CountPointCellsImpl(const int64_t* connectivity, std::atomic<int64_t>* counts)
+  : m_Connectivity(connectivity)
+  , m_Counts(counts)
+  {
+  }
+
+  void convert(int64_t start, int64_t end) const
+  {
+    for(int64_t i = start * NVerts; i < end * NVerts; i++)
+    {
+      m_Counts[m_Connectivity[i]].fetch_add(1, std::memory_order_relaxed);
+    }
+  }
+
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+  void operator()(const tbb::blocked_range<int64_t>& r) const
+  {
+    convert(r.begin(), r.end());
+  }
+#endif
+
+private:
+  const int64_t* m_Connectivity;
+  std::atomic<int64_t>* m_Counts;
+};
+
+/**
+ * @brief Writes each cell of a range into the slots of its vertices. The cursors start at
+ * the offsets of the vertices and are advanced atomically.
+ */
+template <int NVerts>
+class FillPointCellsImpl
+{
+public:
+  FillPointCellsImpl(const int64_t* connectivity, std::atomic<int64_t>* cursors, int64_t* cells)
+  : m_Connectivity(connectivity)
+  , m_Cursors(cursors)
+  , m_Cells(cells)
+  {
+  }
+
+  void convert(int64_t start, int64_t end) const
+  {
+    for(int64_t cellId = start; cellId < end; cellId++)
+    {
+      const int64_t* verts = m_Connectivity + cellId * NVerts;
+      for(int i = 0; i < NVerts; i++)
+      {
+        m_Cells[m_Cursors[verts[i]].fetch_add(1, std::memory_order_relaxed)] = cellId;
+      }
+    }
+  }
+
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+  void operator()(const tbb::blocked_range<int64_t>& r) const
+  {
+    convert(r.begin(), r.end());
+  }
+#endif
+
+private:
+  const int64_t* m_Connectivity;
+  std::atomic<int64_t>* m_Cursors;
+  int64_t* m_Cells;
+};
+
+/**
+ * @brief Sorts the cells of each vertex of a range, since the parallel fill leaves them in
+ * the order the threads reached them
+ */
+class SortPointCellsImpl
+{
+public:
+  SortPointCellsImpl(const int64_t* offsets, int64_t* cells)
+  : m_Offsets(offsets)
+  , m_Cells(cells)
+  {
+  }
+
+  void convert(int64_t start, int64_t end) const
+  {
+    for(int64_t v = start; v < end; v++)
+    {
+      std::sort(m_Cells + m_Offsets[v], m_Cells + m_Offsets[v + 1]);
+    }
+  }
+
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+  void operator()(const tbb::blocked_range<int64_t>& r) const
+  {
+    convert(r.begin(), r.end());
+  }
+#endif
+
+private:
+  const int64_t* m_Offsets;
+  int64_t* m_Cells;
+};
+
+/**
+ * @brief Writes consecutive cell IDs starting at a given ID
+ */
+class IdRangeImpl
+{
+public:
+  IdRangeImpl(vtkIdType first, vtkIdType* ids)
+  : m_First(first)
+  , m_Ids(ids)
+  {
+  }
+
+  void convert(vtkIdType start, vtkIdType end) const
+  {
+    std::iota(m_Ids + start, m_Ids + end, m_First + start);
+  }
+
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+  void operator()(const tbb::blocked_range<vtkIdType>& r) const
+  {
+    convert(r.begin(), r.end());
+  }
+#endif
+
+private:
+  vtkIdType m_First;
+  vtkIdType* m_Ids;
+};
+} // namespace VtkFixedCell
+
+/**
+* @class VtkFixedCellGeom VtkFixedCellGeom.h SMTKPlugin/Utilities/VtkFixedCellGeom.h
+* @brief This class is used as an implementation class for vtkMappedUnstructuredGrid to
+* be used with the DREAM.3D geometries whose cells all have the same type and vertex count.
+* The implementation maps the cell and point IDs from the DREAM.3D geometry but the vertex
+* points must be copied into the unstructured grid separately.
+*
+* The cell point IDs are read straight from the shared element list of the geometry, with
+* the vertex count known at compile time, instead of through the virtual getVertsAt*
+* functions of the geometry. The list is looked up when the geometry is set, so replacing
+* the element list of the geometry afterwards requires calling SetGeometry again.
+*/
+template <typename GeomT, int VtkCellType, int NVerts>
+class VtkFixedCellGeom : public vtkObject
+{
+public:
+  using SelfType = VtkFixedCellGeom<GeomT, VtkCellType, NVerts>;
+
+  static SelfType* New();
+  void PrintSelf(ostream &os, vtkIndent indent) override;
+  vtkTemplateTypeMacro(SelfType, vtkObject)
+
+  /**
+  * @brief Sets the DREAM.3D geometry
+  * @param geom
+  */
+  void SetGeometry(typename GeomT::Pointer geom);
+
+  /**
+  * @brief Returns the number of cells in the geometry
+  * @return
+  */
+  vtkIdType GetNumberOfCells();
+
+  /**
+  * @brief Returns the cell type for the given cell ID
+  * @param cellId
+  * @return
+  */
+  int GetCellType(vtkIdType cellId);
+
+  /**
+  * @brief Gets a list of point IDs used by the cell ID
+  * @param cellId
+  * @param ptIds
+  */
+  void GetCellPoints(vtkIdType cellId, vtkIdList *ptIds);
+
+  /**
+  * @brief Copies the point IDs of the cells [begin, end) into out, GetMaxCellSize() IDs per
+  * cell with no point count in between, so that exporters can take the connectivity in blocks
+  * instead of one vtkIdList per cell
+  * @param begin First cell ID
+  * @param end One past the last cell ID
+  * @param out Buffer of at least (end - begin) * GetMaxCellSize() values
+  */
+  void GetCellPointsRange(vtkIdType begin, vtkIdType end, vtkIdType* out);
+
+  /**
+  * @brief Returns a vtkCellArray holding every cell of the geometry, built from the shared
+  * element list in one parallel pass. The vtkCellArray layout puts the point count before
+  * the point IDs of each cell, so the list cannot be used in place.
+  * @return
+  */
+  vtkSmartPointer<vtkCellArray> GetCellArray();
+
+  /**
+  * @brief Gets a list of cell IDs that use the given point ID. The links are built on the
+  * first call, once even when several threads call it together, and only read afterwards.
+  * @param ptId
+  * @param cellIds
+  */
+  void GetPointCells(vtkIdType ptId, vtkIdList *cellIds);
+
+  /**
+  * @brief Returns the maximum cell size
+  * @return
+  */
+  int GetMaxCellSize();
+
+  /**
+  * @brief Gets a list of all cell IDs of a given type. The array is reset, then filled in
+  * parallel when the type is the cell type of the geometry.
+  * @param type
+  * @param array
+  */
+  void GetIdsOfCellsOfType(int type, vtkIdTypeArray *array);
+
+  /**
+  * @brief Returns whether or not all cells are of the same type
+  * @return
+  */
+  int IsHomogeneous();
+
+  /**
+  * @brief Required by vtkMappedUnstructuredGrid but should not be called on this read-only implementation
+  * @param numCells
+  * @param extSize
+  */
+  void Allocate(vtkIdType numCells, int extSize = 1000);
+
+  /**
+  * @brief Required by vtkMappedUnstructuredGrid but should not be called on this read-only implementation
+  * @param type
+  * @param ptIds
+  * @return
+  */
+  vtkIdType InsertNextCell(int type, vtkIdList *ptIds);
+
+  /**
+  * @brief Required by vtkMappedUnstructuredGrid but should not be called on this read-only implementation
+  * @param type
+  * @param npts
+  * @param ptIds
+  * @return
+  */
+  vtkIdType InsertNextCell(int type, vtkIdType npts, vtkIdType *ptIds);
+
+  /**
+  * @brief Required by vtkMappedUnstructuredGrid but should not be called on this read-only implementation
+  * @param type
+  * @param npts
+  * @param ptIds
+  * @param nfaces
+  * @param faces
+  * @return
+  */
+  vtkIdType InsertNextCell(int type, vtkIdType npts, vtkIdType *ptIds, vtkIdType nfaces, vtkIdType *faces);
+
+  /**
+  * @brief Required by vtkMappedUnstructuredGrid but should not be called on this read-only implementation
+  * @param cellId
+  * @param npts
+  * @param pts
+  */
+  void ReplaceCell(vtkIdType cellId, int npts, vtkIdType *pts);
+
+protected:
+  /**
+  * @brief Constructor
+  */
+  VtkFixedCellGeom();
+
+private:
+  typename GeomT::Pointer m_Geom = nullptr;
+  Int64ArrayType::Pointer m_Elements = Int64ArrayType::NullPointer();
+  const int64_t* m_Connectivity = nullptr;
+  std::unique_ptr<VtkFixedCell::PointCellLinks> m_Links;
+
+  /**
+  * @brief Builds the point to cell links with a parallel count pass, a prefix sum and a
+  * parallel fill pass, unless the geometry already holds them
+  */
+  void buildPointCellLinks();
+};
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+template <typename GeomT, int VtkCellType, int NVerts>
+VtkFixedCellGeom<GeomT, VtkCellType, NVerts>* VtkFixedCellGeom<GeomT, VtkCellType, NVerts>::New()
+{
+  return new SelfType();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+template <typename GeomT, int VtkCellType, int NVerts>
+void VtkFixedCellGeom<GeomT, VtkCellType, NVerts>::PrintSelf(ostream &os, vtkIndent indent)
+{
+  this->Superclass::PrintSelf(os, indent);
+  os << indent << "Elements: " << GetNumberOfCells() << endl;
+  os << indent << "CellType: "
+    << vtkCellTypes::GetClassNameFromTypeId(VtkCellType) << endl;
+  os << indent << "CellSize: " << GetMaxCellSize() << endl;
+  os << indent << "NumberOfCells: " << GetNumberOfCells() << endl;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+template <typename GeomT, int VtkCellType, int NVerts>
+VtkFixedCellGeom<GeomT, VtkCellType, NVerts>::VtkFixedCellGeom()
+  : vtkObject()
+  , m_Links(new VtkFixedCell::PointCellLinks())
+{
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+template <typename GeomT, int VtkCellType, int NVerts>
+void VtkFixedCellGeom<GeomT, VtkCellType, NVerts>::SetGeometry(typename GeomT::Pointer geom)
+{
+  m_Geom = geom;
+  m_Elements = (nullptr != geom) ? VtkFixedCell::GetElementList(*geom) : Int64ArrayType::NullPointer();
+  m_Connectivity = (nullptr != m_Elements) ? m_Elements->getPointer(0) : nullptr;
+  m_Links.reset(new VtkFixedCell::PointCellLinks());
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+template <typename GeomT, int VtkCellType, int NVerts>
+vtkIdType VtkFixedCellGeom<GeomT, VtkCellType, NVerts>::GetNumberOfCells()
+{
+  if(nullptr == m_Geom)
+  {
+    vtkErrorMacro("Wrapper Geometry missing a Geometry object");
+    return -1;
+  }
+
+  return m_Geom->getNumberOfElements();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+template <typename GeomT, int VtkCellType, int NVerts>
+int VtkFixedCellGeom<GeomT, VtkCellType, NVerts>::GetCellType(vtkIdType cellId)
+{
+  if(0 == GetNumberOfCells())
+  {
+    return VTK_EMPTY_CELL;
+  }
+
+  return VtkCellType;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+template <typename GeomT, int VtkCellType, int NVerts>
+void VtkFixedCellGeom<GeomT, VtkCellType, NVerts>::GetCellPoints(vtkIdType cellId, vtkIdList *ptIds)
+{
+  ptIds->SetNumberOfIds(NVerts);
+  vtkIdType* ids = ptIds->GetPointer(0);
+
+  // The cells of a VertexGeom are its vertices
+  if(nullptr == m_Connectivity)
+  {
+    ids[0] = cellId;
+    return;
+  }
+
+  const int64_t* verts = m_Connectivity + cellId * NVerts;
+  for(int i = 0; i < NVerts; i++)
+  {
+    ids[i] = static_cast<vtkIdType>(verts[i]);
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+template <typename GeomT, int VtkCellType, int NVerts>
+void VtkFixedCellGeom<GeomT, VtkCellType, NVerts>::GetCellPointsRange(vtkIdType begin, vtkIdType end, vtkIdType* out)
+{
+  if(nullptr == m_Connectivity)
+  {
+    std::iota(out, out + (end - begin), begin);
+    return;
+  }
+
+  std::copy(m_Connectivity + begin * NVerts, m_Connectivity + end * NVerts, out);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+template <typename GeomT, int VtkCellType, int NVerts>
+vtkSmartPointer<vtkCellArray> VtkFixedCellGeom<GeomT, VtkCellType, NVerts>::GetCellArray()
+{
+  vtkSmartPointer<vtkCellArray> cellArray = vtkSmartPointer<vtkCellArray>::New();
+  vtkIdType numCells = GetNumberOfCells();
+  if(numCells <= 0)
+  {
+    return cellArray;
+  }
+
+  vtkSmartPointer<vtkIdTypeArray> cells = vtkSmartPointer<vtkIdTypeArray>::New();
+  cells->SetNumberOfValues(numCells * (NVerts + 1));
+
+  VtkFixedCell::CellArrayImpl<NVerts> impl(m_Connectivity, cells->GetPointer(0));
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+  tbb::parallel_for(tbb::blocked_range<vtkIdType>(0, numCells), impl, tbb::auto_partitioner());
+#else
+  impl.convert(0, numCells);
+#endif
+
+  cellArray->SetCells(numCells, cells);
+  return cellArray;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+template <typename GeomT, int VtkCellType, int NVerts>
+void VtkFixedCellGeom<GeomT, VtkCellType, NVerts>::GetPointCells(vtkIdType ptId, vtkIdList *cellIds)
+{
+  if(nullptr == m_Connectivity)
+  {
+    cellIds->SetNumberOfIds(1);
+    cellIds->SetId(0, ptId);
+    return;
+  }
+
+  std::call_once(m_Links->built, &SelfType::buildPointCellLinks, this);
+  const VtkFixedCell::PointCellLinks& links = *m_Links;
+
+  if(nullptr != links.geomLinks)
+  {
+    DynamicListArray<uint16_t, int64_t>::ElementList listArray = links.geomLinks->getElementList(ptId);
+
+    cellIds->SetNumberOfIds(listArray.ncells);
+    vtkIdType* ids = cellIds->GetPointer(0);
+    for(int i = 0; i < listArray.ncells; i++)
+    {
+      ids[i] = static_cast<vtkIdType>(listArray.cells[i]);
+    }
+    return;
+  }
+
+  const int64_t begin = links.offsets[ptId];
+  const int64_t end = links.offsets[ptId + 1];
+  cellIds->SetNumberOfIds(end - begin);
+  std::copy(links.cells.data() + begin, links.cells.data() + end, cellIds->GetPointer(0));
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+template <typename GeomT, int VtkCellType, int NVerts>
+void VtkFixedCellGeom<GeomT, VtkCellType, NVerts>::buildPointCellLinks()
+{
+  VtkFixedCell::PointCellLinks& links = *m_Links;
+  links.geomLinks = m_Geom->getElementsContainingVert();
+  if(nullptr != links.geomLinks)
+  {
+    return;
+  }
+
+  const int64_t numVerts = m_Geom->getNumberOfVertices();
+  const int64_t numCells = GetNumberOfCells();
+
+  // Count the cells of each vertex, turn the counts into offsets and then use the offsets
+  // as the cursors of the fill pass
+  std::unique_ptr<std::atomic<int64_t>[]> counters(new std::atomic<int64_t>[numVerts]);
+  for(int64_t v = 0; v < numVerts; v++)
+  {
+    counters[v].store(0, std::memory_order_relaxed);
+  }
+
+  VtkFixedCell::CountPointCellsImpl<NVerts> countImpl(m_Connectivity, counters.get());
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+  tbb::parallel_for(tbb::blocked_range<int64_t>(0, numCells), countImpl, tbb::auto_partitioner());
+#else
+  countImpl.convert(0, numCells);
+#endif
+
+  links.offsets.resize(numVerts + 1);
+  links.offsets[0] = 0;
+  for(int64_t v = 0; v < numVerts; v++)
+  {
+    links.offsets[v + 1] = links.offsets[v] + counters[v].load(std::memory_order_relaxed);
+    counters[v].store(links.offsets[v], std::memory_order_relaxed);
+  }
+  links.cells.resize(links.offsets[numVerts]);
+
+  VtkFixedCell::FillPointCellsImpl<NVerts> fillImpl(m_Connectivity, counters.get(), links.cells.data());
+  VtkFixedCell::SortPointCellsImpl sortImpl(links.offsets.data(), links.cells.data());
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+  tbb::parallel_for(tbb::blocked_range<int64_t>(0, numCells), fillImpl, tbb::auto_partitioner());
+  tbb::parallel_for(tbb::blocked_range<int64_t>(0, numVerts), sortImpl, tbb::auto_partitioner());
+#else
+  fillImpl.convert(0, numCells);
+  sortImpl.convert(0, numVerts);
+#endif
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+template <typename GeomT, int VtkCellType, int NVerts>
+int VtkFixedCellGeom<GeomT, VtkCellType, NVerts>::GetMaxCellSize()
+{
+  return NVerts;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+template <typename GeomT, int VtkCellType, int NVerts>
+void VtkFixedCellGeom<GeomT, VtkCellType, NVerts>::GetIdsOfCellsOfType(int type, vtkIdTypeArray *array)
+{
+  // Every cell has the same type, so the IDs are either all of the cells or none
+  vtkIdType numIds = 0;
+  if(VtkCellType == type && nullptr != m_Geom)
+  {
+    numIds = GetNumberOfCells();
+  }
+
+  // SetNumberOfTuples only reallocates when the array is too small
+  array->SetNumberOfComponents(1);
+  array->SetNumberOfTuples(numIds);
+
+  VtkFixedCell::IdRangeImpl impl(0, array->GetPointer(0));
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+  tbb::parallel_for(tbb::blocked_range<vtkIdType>(0, numIds), impl, tbb::auto_partitioner());
+#else
+  impl.convert(0, numIds);
+#endif
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+template <typename GeomT, int VtkCellType, int NVerts>
+int VtkFixedCellGeom<GeomT, VtkCellType, NVerts>::IsHomogeneous()
+{
+  return 1;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+template <typename GeomT, int VtkCellType, int NVerts>
+void VtkFixedCellGeom<GeomT, VtkCellType, NVerts>::Allocate(vtkIdType numCells, int extSize)
+{
+  vtkErrorMacro("Read only container.");
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+template <typename GeomT, int VtkCellType, int NVerts>
+vtkIdType VtkFixedCellGeom<GeomT, VtkCellType, NVerts>::InsertNextCell(int type, vtkIdList *ptIds)
+{
+  vtkErrorMacro("Read only container.");
+  return -1;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+template <typename GeomT, int VtkCellType, int NVerts>
+vtkIdType VtkFixedCellGeom<GeomT, VtkCellType, NVerts>::InsertNextCell(int type, vtkIdType npts, vtkIdType *ptIds)
+{
+  vtkErrorMacro("Read only container.");
+  return -1;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+template <typename GeomT, int VtkCellType, int NVerts>
+vtkIdType VtkFixedCellGeom<GeomT, VtkCellType, NVerts>::InsertNextCell(int type, vtkIdType npts, vtkIdType *ptIds, vtkIdType nfaces, vtkIdType *faces)
+{
+  vtkErrorMacro("Read only container.");
+  return -1;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+template <typename GeomT, int VtkCellType, int NVerts>
+void VtkFixedCellGeom<GeomT, VtkCellType, NVerts>::ReplaceCell(vtkIdType cellId, int npts, vtkIdType *pts)
+{
+  vtkErrorMacro("Read only container.");
+}
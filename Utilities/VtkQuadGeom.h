@@ -33,129 +33,19 @@
 *
 * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
 
-#pragma once
 
-#include <vtkMappedUnstructuredGrid.h>
-#include <vtkIdTypeArray.h>
+#pragma once
 
 #include "SIMPLib/Geometry/QuadGeom.h"
 
+#include "Utilities/VtkFixedCellGeom.h"
+
 /**
-* @class VtkQuadGeom VtkQuadGeom.h SIMPLView/VtkSIMPL/VtkSupport/VtkQuadGeom.h
-* @brief This class is used as an implementation class for vtkMappedUnstructuredGrid to
-* be used with DREAM.3D's QuadGeom.  The implementation maps the cell and point IDs
-* from the DREAM.3D geometry but the vertex points must be copied into the
-* unstructured grid separately.
+* @brief VtkFixedCellGeom implementation for DREAM.3D's QuadGeom, where every cell is a quadrilateral
+* with 4 points.
 */
-class VtkQuadGeom : public vtkObject
-{
-public:
-  static VtkQuadGeom* New();
-  void 	PrintSelf(ostream &os, vtkIndent indent) override;
-  vtkTypeMacro(VtkQuadGeom, vtkObject)
-
-  /**
-  * @brief Sets the DREAM.3D geometry
-  * @param geom
-  */
-  void SetGeometry(QuadGeom::Pointer geom);
-
-  /**
-  * @brief Returns the number of cells in the geometry
-  * @return
-  */
-  vtkIdType GetNumberOfCells();
-
-  /**
-  * @brief Returns the cell type for the given cell ID
-  * @param cellId
-  * @return
-  */
-  int GetCellType(vtkIdType cellId);
-
-  /**
-  * @brief Gets a list of point IDs used by the cell ID
-  * @param cellId
-  * @param ptIds
-  */
-  void GetCellPoints(vtkIdType cellId, vtkIdList *ptIds);
-
-  /**
-  * @brief Gets a list of cell IDs that use the given point ID
-  * @param ptId
-  * @param cellIds
-  */
-  void GetPointCells(vtkIdType ptId, vtkIdList *cellIds);
-
-  /**
-  * @brief Returns the maximum cell size
-  * @return
-  */
-  int GetMaxCellSize();
+using VtkQuadGeom = VtkFixedCellGeom<QuadGeom, VTK_QUAD, 4>;
 
-  /**
-  * @brief Gets a list of all cell IDs of a given type
-  * @param type
-  * @param array
-  */
-  void GetIdsOfCellsOfType(int type, vtkIdTypeArray *array);
-
-  /**
-  * @brief Returns whether or not all cells are of the same type
-  * @return
-  */
-  int IsHomogeneous();
-
-  /**
-  * @brief Required by vtkMappedUnstructuredGrid but should not be called on this read-only implementation
-  * @param numCells
-  * @param extSize
-  */
-  void Allocate(vtkIdType numCells, int extSize = 1000);
-
-  /**
-  * @brief Required by vtkMappedUnstructuredGrid but should not be called on this read-only implementation
-  * @param type
-  * @param ptIds
-  * @return
-  */
-  vtkIdType InsertNextCell(int type, vtkIdList *ptIds);
-
-  /**
-  * @brief Required by vtkMappedUnstructuredGrid but should not be called on this read-only implementation
-  * @param type
-  * @param npts
-  * @param ptIds
-  * @return
-  */
-  vtkIdType InsertNextCell(int type, vtkIdType npts, vtkIdType *ptIds);
-
-  /**
-  * @brief Required by vtkMappedUnstructuredGrid but should not be called on this read-only implementation
-  * @param type
-  * @param npts
-  * @param ptIds
-  * @param nfaces
-  * @param faces
-  * @return
-  */
-  vtkIdType InsertNextCell(int type, vtkIdType npts, vtkIdType *ptIds, vtkIdType nfaces, vtkIdType *faces);
-
-  /**
-  * @brief Required by vtkMappedUnstructuredGrid but should not be called on this read-only implementation
-  * @param cellId
-  * @param npts
-  * @param pts
-  */
-  void ReplaceCell(vtkIdType cellId, int npts, vtkIdType *pts);
-
-protected:
-  VtkQuadGeom();
-
-private:
-  QuadGeom::Pointer m_Geom = nullptr;
-  float m_MaxCellSize = 0.0f;
-};
+extern template class VtkFixedCellGeom<QuadGeom, VTK_QUAD, 4>;
 
 vtkMakeMappedUnstructuredGrid(VtkQuadGrid, VtkQuadGeom)
-
@@ -33,13 +33,10 @@
 *
 * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
 
-#include "VtkTetrahedralGeom.h"
 
-#include <cmath>
+#include "VtkTetrahedralGeom.h"
 
-#include <vtkIdTypeArray.h>
-#include <vtkCellTypes.h>
-#include <vtkPoints.h>
+template class VtkFixedCellGeom<TetrahedralGeom, VTK_TETRA, 4>;
 
 // -----------------------------------------------------------------------------
 //
@@ -48,183 +45,3 @@ VtkTetrahedralGrid* VtkTetrahedralGrid::New()
 {
   return new VtkTetrahedralGrid();
 }
-
-// -----------------------------------------------------------------------------
-//
-// -----------------------------------------------------------------------------
-VtkTetrahedralGeom* VtkTetrahedralGeom::New()
-{
-  return new VtkTetrahedralGeom();
-}
-
-// -----------------------------------------------------------------------------
-//
-// -----------------------------------------------------------------------------
-void VtkTetrahedralGeom::PrintSelf(ostream &os, vtkIndent indent)
-{
-  this->Superclass::PrintSelf(os, indent);
-  os << indent << "Elements: " << GetNumberOfCells() << endl;
-  os << indent << "CellType: "
-    << vtkCellTypes::GetClassNameFromTypeId(CELL_TYPE) << endl;
-  os << indent << "CellSize: " << GetMaxCellSize() << endl;
-  os << indent << "NumberOfCells: " << GetNumberOfCells() << endl;
-}
-
-// -----------------------------------------------------------------------------
-//
-// -----------------------------------------------------------------------------
-VtkTetrahedralGeom::VtkTetrahedralGeom()
-  : vtkObject()
-{
-}
-
-// -----------------------------------------------------------------------------
-//
-// -----------------------------------------------------------------------------
-void VtkTetrahedralGeom::SetGeometry(TetrahedralGeom::Pointer geom)
-{
-  m_Geom = geom;
-}
-
-// -----------------------------------------------------------------------------
-//
-// -----------------------------------------------------------------------------
-vtkIdType VtkTetrahedralGeom::GetNumberOfCells()
-{
-  if(nullptr == m_Geom)
-  {
-    vtkErrorMacro("Wrapper Geometry missing a Geometry object");
-    return -1;
-  }
-
-  return m_Geom->getNumberOfElements();
-}
-
-// -----------------------------------------------------------------------------
-//
-// -----------------------------------------------------------------------------
-int VtkTetrahedralGeom::GetCellType(vtkIdType cellId)
-{
-  if(0 == GetNumberOfCells())
-  {
-    return VTK_EMPTY_CELL;
-  }
-
-  return CELL_TYPE;
-}
-
-// -----------------------------------------------------------------------------
-//
-// -----------------------------------------------------------------------------
-void VtkTetrahedralGeom::GetCellPoints(vtkIdType cellId, vtkIdList *ptIds)
-{
-  const int numVerts = 4;
-
-  int64_t verts[numVerts];
-  m_Geom->getVertsAtTet(cellId, verts);
-
-  ptIds->SetNumberOfIds(numVerts);
-  for(int i = 0; i < numVerts; i++)
-  {
-    ptIds->SetId(i, verts[i]);
-  }
-  
-}
-
-// -----------------------------------------------------------------------------
-//
-// -----------------------------------------------------------------------------
-void VtkTetrahedralGeom::GetPointCells(vtkIdType ptId, vtkIdList *cellIds)
-{
-  ElementDynamicList::Pointer elementsContainingList = m_Geom->getElementsContainingVert();
-
-  DynamicListArray<uint16_t, int64_t>::ElementList listArray = elementsContainingList->getElementList(ptId);
-
-  cellIds->SetNumberOfIds(listArray.ncells);
-  for(int i = 0; i < listArray.ncells; i++)
-  {
-    cellIds->SetId(i, listArray.cells[i]);
-  }
-}
-
-// -----------------------------------------------------------------------------
-//
-// -----------------------------------------------------------------------------
-int VtkTetrahedralGeom::GetMaxCellSize()
-{
-  return std::ceil(m_MaxCellSize);
-}
-
-// -----------------------------------------------------------------------------
-//
-// -----------------------------------------------------------------------------
-void VtkTetrahedralGeom::GetIdsOfCellsOfType(int type, vtkIdTypeArray *array)
-{
-  if(CELL_TYPE == type)
-  {
-    int numValues = GetNumberOfCells();
-
-    array = vtkIdTypeArray::New();
-    array->SetNumberOfTuples(numValues);
-    array->SetNumberOfComponents(1);
-
-    vtkIdType* arrayValues = new vtkIdType[numValues];
-    for(int i = 0; i < numValues; i++)
-    {
-      arrayValues[i] = i;
-    }
-
-    array->SetVoidArray(arrayValues, numValues, 0);
-  }
-}
-
-// -----------------------------------------------------------------------------
-//
-// -----------------------------------------------------------------------------
-int VtkTetrahedralGeom::IsHomogeneous()
-{
-  return 1;
-}
-
-// -----------------------------------------------------------------------------
-//
-// -----------------------------------------------------------------------------
-void VtkTetrahedralGeom::Allocate(vtkIdType numCells, int extSize)
-{
-  vtkErrorMacro("Read only container.");
-}
-
-// -----------------------------------------------------------------------------
-//
-// -----------------------------------------------------------------------------
-vtkIdType VtkTetrahedralGeom::InsertNextCell(int type, vtkIdList *ptIds)
-{
-  vtkErrorMacro("Read only container.");
-  return -1;
-}
-
-// -----------------------------------------------------------------------------
-//
-// -----------------------------------------------------------------------------
-vtkIdType VtkTetrahedralGeom::InsertNextCell(int type, vtkIdType npts, vtkIdType *ptIds)
-{
-  vtkErrorMacro("Read only container.");
-  return -1;
-}
-
-// -----------------------------------------------------------------------------
-//
-// -----------------------------------------------------------------------------
-vtkIdType VtkTetrahedralGeom::InsertNextCell(int type, vtkIdType npts, vtkIdType *ptIds, vtkIdType nfaces, vtkIdType *faces)
-{
-  vtkErrorMacro("Read only container.");
-  return -1;
-}
-
-// -----------------------------------------------------------------------------
-//
-// -----------------------------------------------------------------------------
-void VtkTetrahedralGeom::ReplaceCell(vtkIdType cellId, int npts, vtkIdType *pts)
-{
-  vtkErrorMacro("Read only container.");
-}
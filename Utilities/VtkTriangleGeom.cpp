@@ -33,15 +33,10 @@
 *
 * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
 
-#include "VtkTriangleGeom.h"
-
-#include <cmath>
 
-#include <vtkIdTypeArray.h>
-#include <vtkCellType.h>
-#include <vtkCellTypes.h>
+#include "VtkTriangleGeom.h"
 
-const int CELL_TYPE = VTK_TRIANGLE;
+template class VtkFixedCellGeom<TriangleGeom, VTK_TRIANGLE, 3>;
 
 // -----------------------------------------------------------------------------
 //
@@ -50,188 +45,3 @@ VtkTriangleGrid* VtkTriangleGrid::New()
 {
   return new VtkTriangleGrid();
 }
-
-// -----------------------------------------------------------------------------
-//
-// -----------------------------------------------------------------------------
-VtkTriangleGeom* VtkTriangleGeom::New()
-{
-  VtkTriangleGeom* geom = new VtkTriangleGeom();
-  return geom;
-}
-
-// -----------------------------------------------------------------------------
-//
-// -----------------------------------------------------------------------------
-void VtkTriangleGeom::PrintSelf(ostream &os, vtkIndent indent)
-{
-  this->Superclass::PrintSelf(os, indent);
-  os << indent << "Elements: " << GetNumberOfCells() << endl;
-  os << indent << "CellType: "
-    << vtkCellTypes::GetClassNameFromTypeId(CELL_TYPE) << endl;
-  os << indent << "CellSize: " << GetMaxCellSize() << endl;
-  os << indent << "NumberOfCells: " << GetNumberOfCells() << endl;
-}
-
-// -----------------------------------------------------------------------------
-//
-// -----------------------------------------------------------------------------
-VtkTriangleGeom::VtkTriangleGeom()
-  : vtkObject()
-{
-}
-
-// -----------------------------------------------------------------------------
-//
-// -----------------------------------------------------------------------------
-void VtkTriangleGeom::SetGeometry(TriangleGeom::Pointer geom)
-{
-  m_Geom = geom;
-  geom->findElementsContainingVert();
-  geom->findElementSizes();
-}
-
-// -----------------------------------------------------------------------------
-//
-// -----------------------------------------------------------------------------
-vtkIdType VtkTriangleGeom::GetNumberOfCells()
-{
-  if(nullptr == m_Geom)
-  {
-    vtkErrorMacro("Wrapper Geometry missing a Geometry object");
-    return -1;
-  }
-
-  return m_Geom->getNumberOfElements();
-}
-
-// -----------------------------------------------------------------------------
-//
-// -----------------------------------------------------------------------------
-int VtkTriangleGeom::GetCellType(vtkIdType cellId)
-{
-  if(0 == GetNumberOfCells())
-  {
-    return VTK_EMPTY_CELL;
-  }
-
-  return CELL_TYPE;
-}
-
-// -----------------------------------------------------------------------------
-//
-// -----------------------------------------------------------------------------
-void VtkTriangleGeom::GetCellPoints(vtkIdType cellId, vtkIdList *ptIds)
-{
-  const int numVerts = 3;
-
-  int64_t verts[numVerts];
-  m_Geom->getVertsAtTri(cellId, verts);
-
-  ptIds->SetNumberOfIds(numVerts);
-  for(int i = 0; i < numVerts; i++)
-  {
-    ptIds->SetId(i, verts[i]);
-  }
-
-}
-
-// -----------------------------------------------------------------------------
-//
-// -----------------------------------------------------------------------------
-void VtkTriangleGeom::GetPointCells(vtkIdType ptId, vtkIdList *cellIds)
-{
-  ElementDynamicList::Pointer elementsContainingList = m_Geom->getElementsContainingVert();
-
-  DynamicListArray<uint16_t, int64_t>::ElementList listArray = elementsContainingList->getElementList(ptId);
-
-  cellIds->SetNumberOfIds(listArray.ncells);
-  for(int i = 0; i < listArray.ncells; i++)
-  {
-    cellIds->SetId(i, listArray.cells[i]);
-  }
-}
-
-// -----------------------------------------------------------------------------
-//
-// -----------------------------------------------------------------------------
-int VtkTriangleGeom::GetMaxCellSize()
-{
-  return std::ceil(m_MaxCellSize);
-}
-
-// -----------------------------------------------------------------------------
-//
-// -----------------------------------------------------------------------------
-void VtkTriangleGeom::GetIdsOfCellsOfType(int type, vtkIdTypeArray *array)
-{
-  if(CELL_TYPE == type)
-  {
-    int numValues = GetNumberOfCells();
-
-    array = vtkIdTypeArray::New();
-    array->SetNumberOfTuples(numValues);
-    array->SetNumberOfComponents(1);
-
-    vtkIdType* arrayValues = new vtkIdType[numValues];
-    for(int i = 0; i < numValues; i++)
-    {
-      arrayValues[i] = i;
-    }
-
-    array->SetVoidArray(arrayValues, numValues, 0);
-  }
-}
-
-// -----------------------------------------------------------------------------
-//
-// -----------------------------------------------------------------------------
-int VtkTriangleGeom::IsHomogeneous()
-{
-  return 1;
-}
-
-// -----------------------------------------------------------------------------
-//
-// -----------------------------------------------------------------------------
-void VtkTriangleGeom::Allocate(vtkIdType numCells, int extSize)
-{
-  vtkErrorMacro("Read only container.");
-}
-
-// -----------------------------------------------------------------------------
-//
-// -----------------------------------------------------------------------------
-vtkIdType VtkTriangleGeom::InsertNextCell(int type, vtkIdList *ptIds)
-{
-  vtkErrorMacro("Read only container.");
-  return -1;
-}
-
-// -----------------------------------------------------------------------------
-//
-// -----------------------------------------------------------------------------
-vtkIdType VtkTriangleGeom::InsertNextCell(int type, vtkIdType npts, vtkIdType *ptIds)
-{
-  vtkErrorMacro("Read only container.");
-  return -1;
-}
-
-// -----------------------------------------------------------------------------
-//
-// -----------------------------------------------------------------------------
-vtkIdType VtkTriangleGeom::InsertNextCell(int type, vtkIdType npts, vtkIdType *ptIds, vtkIdType nfaces, vtkIdType *faces)
-{
-  // TriangleGeometry should probably not be modified by VTK calls
-  // Do nothing
-  vtkErrorMacro("Read only container.");
-  return -1;
-}
-
-// -----------------------------------------------------------------------------
-//
-// -----------------------------------------------------------------------------
-void VtkTriangleGeom::ReplaceCell(vtkIdType cellId, int npts, vtkIdType *pts)
-{
-  vtkErrorMacro("Read only container.");
-}
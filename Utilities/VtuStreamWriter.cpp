@@ -0,0 +1,232 @@
+/* ============================================================================
+* Copyright (c) 2018 BlueQuartz Software, LLC
+*
+* Redistribution and use in source and binary forms, with or without modification,
+* are permitted provided that the following conditions are met:
+*
+* Redistributions of source code must retain the above copyright notice, this
+* list of conditions and the following disclaimer.
+*
+* Redistributions in binary form must reproduce the above copyright notice, this
+* list of conditions and the following disclaimer in the documentation and/or
+* other materials provided with the distribution.
+*
+* Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+* contributors may be used to endorse or promote products derived from this software
+* without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+* DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+* FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+* DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+* OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+* USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*
+* ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+
+#include "VtuStreamWriter.h"
+
+#include <sstream>
+
+namespace
+{
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+std::string EscapeXml(const std::string& value)
+{
+  std::string escaped;
+  escaped.reserve(value.size());
+  for(char c : value)
+  {
+    switch(c)
+    {
+    case '&':
+      escaped += "&amp;";
+      break;
+    case '<':
+      escaped += "&lt;";
+      break;
+    case '>':
+      escaped += "&gt;";
+      break;
+    case '"':
+      escaped += "&quot;";
+      break;
+    default:
+      escaped += c;
+    }
+  }
+  return escaped;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool IsLittleEndian()
+{
+  const uint16_t value = 1;
+  return *reinterpret_cast<const uint8_t*>(&value) == 1;
+}
+} // namespace
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+VtuStreamWriter::VtuStreamWriter() = default;
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+VtuStreamWriter::~VtuStreamWriter()
+{
+  if(m_Out.is_open())
+  {
+    m_Out.close();
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int VtuStreamWriter::openFile(const std::string& filePath, size_t numPoints, size_t numCells, int cellType, int nodesPerCell, const std::vector<DataArrayInfo>& cellArrays)
+{
+  m_Out.open(filePath, std::ios::out | std::ios::binary | std::ios::trunc);
+  if(!m_Out.is_open())
+  {
+    return -1;
+  }
+
+  m_CellType = cellType;
+  m_BlockSizes.clear();
+  m_CurrentBlock = 0;
+  m_Remaining = 0;
+  m_InBlock = false;
+
+  // Each appended block is preceded by its UInt64 byte count, and the offsets in the
+  // header are measured from the start of the appended data to that count
+  uint64_t offset = 0;
+  auto addBlock = [this, &offset](uint64_t numBytes) {
+    uint64_t blockOffset = offset;
+    m_BlockSizes.push_back(numBytes);
+    offset += sizeof(uint64_t) + numBytes;
+    return blockOffset;
+  };
+
+  std::stringstream header;
+  header << "<?xml version=\"1.0\"?>\n";
+  header << "<VTKFile type=\"UnstructuredGrid\" version=\"1.0\" byte_order=\"" << (IsLittleEndian() ? "LittleEndian" : "BigEndian") << "\" header_type=\"UInt64\">\n";
+  header << "  <UnstructuredGrid>\n";
+  header << "    <Piece NumberOfPoints=\"" << numPoints << "\" NumberOfCells=\"" << numCells << "\">\n";
+
+  uint64_t pointsOffset = addBlock(static_cast<uint64_t>(numPoints) * 3 * sizeof(double));
+
+  header << "      <CellData>\n";
+  for(const DataArrayInfo& info : cellArrays)
+  {
+    uint64_t arrayOffset = addBlock(static_cast<uint64_t>(numCells) * info.numComponents * info.componentSize);
+    header << "        <DataArray type=\"" << info.vtkType << "\" Name=\"" << EscapeXml(info.name) << "\" NumberOfComponents=\"" << info.numComponents << "\" format=\"appended\" offset=\""
+           << arrayOffset << "\"/>\n";
+  }
+  header << "      </CellData>\n";
+
+  header << "      <Points>\n";
+  header << "        <DataArray type=\"Float64\" Name=\"Points\" NumberOfComponents=\"3\" format=\"appended\" offset=\"" << pointsOffset << "\"/>\n";
+  header << "      </Points>\n";
+
+  uint64_t connectivityOffset = addBlock(static_cast<uint64_t>(numCells) * nodesPerCell * sizeof(int64_t));
+  uint64_t offsetsOffset = addBlock(static_cast<uint64_t>(numCells) * sizeof(int64_t));
+  uint64_t typesOffset = addBlock(static_cast<uint64_t>(numCells) * sizeof(uint8_t));
+
+  header << "      <Cells>\n";
+  header << "        <DataArray type=\"Int64\" Name=\"connectivity\" format=\"appended\" offset=\"" << connectivityOffset << "\"/>\n";
+  header << "        <DataArray type=\"Int64\" Name=\"offsets\" format=\"appended\" offset=\"" << offsetsOffset << "\"/>\n";
+  header << "        <DataArray type=\"UInt8\" Name=\"types\" format=\"appended\" offset=\"" << typesOffset << "\"/>\n";
+  header << "      </Cells>\n";
+  header << "    </Piece>\n";
+  header << "  </UnstructuredGrid>\n";
+  header << "  <AppendedData encoding=\"raw\">\n   _";
+
+  std::string headerString = header.str();
+  m_Out.write(headerString.data(), static_cast<std::streamsize>(headerString.size()));
+
+  return m_Out.good() ? 0 : -2;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int VtuStreamWriter::beginBlock()
+{
+  if(!m_Out.is_open() || m_Remaining != 0)
+  {
+    return -1;
+  }
+
+  size_t nextBlock = m_InBlock ? m_CurrentBlock + 1 : 0;
+  if(nextBlock >= m_BlockSizes.size())
+  {
+    return -2;
+  }
+
+  m_CurrentBlock = nextBlock;
+  m_InBlock = true;
+  m_Remaining = m_BlockSizes[m_CurrentBlock];
+  m_Out.write(reinterpret_cast<const char*>(&m_Remaining), sizeof(uint64_t));
+
+  return m_Out.good() ? 0 : -3;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int VtuStreamWriter::writeData(const void* data, size_t numBytes)
+{
+  if(!m_InBlock || numBytes > m_Remaining)
+  {
+    return -1;
+  }
+
+  m_Out.write(static_cast<const char*>(data), static_cast<std::streamsize>(numBytes));
+  m_Remaining -= numBytes;
+
+  return m_Out.good() ? 0 : -2;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int VtuStreamWriter::closeFile()
+{
+  if(!m_Out.is_open())
+  {
+    return 0;
+  }
+
+  bool complete = (m_Remaining == 0) && (m_BlockSizes.empty() || (m_InBlock && m_CurrentBlock + 1 == m_BlockSizes.size()));
+
+  const std::string footer = "\n  </AppendedData>\n</VTKFile>\n";
+  m_Out.write(footer.data(), static_cast<std::streamsize>(footer.size()));
+  bool good = m_Out.good();
+  m_Out.close();
+  m_InBlock = false;
+
+  if(!complete)
+  {
+    return -1;
+  }
+  return good ? 0 : -2;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int VtuStreamWriter::getCellType() const
+{
+  return m_CellType;
+}
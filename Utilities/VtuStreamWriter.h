@@ -0,0 +1,121 @@
+/* ============================================================================
+* Copyright (c) 2018 BlueQuartz Software, LLC
+*
+* Redistribution and use in source and binary forms, with or without modification,
+* are permitted provided that the following conditions are met:
+*
+* Redistributions of source code must retain the above copyright notice, this
+* list of conditions and the following disclaimer.
+*
+* Redistributions in binary form must reproduce the above copyright notice, this
+* list of conditions and the following disclaimer in the documentation and/or
+* other materials provided with the distribution.
+*
+* Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+* contributors may be used to endorse or promote products derived from this software
+* without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+* DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+* FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+* DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+* OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+* USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*
+* ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+
+#pragma once
+
+#include <cstdint>
+#include <fstream>
+#include <string>
+#include <vector>
+
+/**
+ * @brief The VtuStreamWriter class writes a VTK XML unstructured grid (.vtu) whose array
+ * data is stored in raw appended form. The sizes of every array are fixed when the file is
+ * opened, which lets the XML header be written first and the array data be streamed after it
+ * in pieces of any size, so a mesh never has to be held in memory in full.
+ *
+ * The appended blocks are written in this order, each one opened with beginBlock():
+ *
+ *   1. Points (Float64, 3 components)
+ *   2. Each cell data array, in the order given to openFile()
+ *   3. Cell connectivity (Int64)
+ *   4. Cell offsets (Int64)
+ *   5. Cell types (UInt8)
+ */
+class VtuStreamWriter
+{
+public:
+  /**
+   * @brief Describes one cell data array
+   */
+  struct DataArrayInfo
+  {
+    std::string name;
+    std::string vtkType; //!< VTK XML type name such as "Float64" or "Int32"
+    int numComponents = 1;
+    size_t componentSize = 0; //!< Size of one component in bytes
+  };
+
+  VtuStreamWriter();
+  virtual ~VtuStreamWriter();
+
+  /**
+   * @brief Creates the file and writes the XML header
+   * @param filePath
+   * @param numPoints
+   * @param numCells
+   * @param cellType VTK cell type id shared by every cell
+   * @param nodesPerCell
+   * @param cellArrays
+   * @return Negative value on error
+   */
+  int openFile(const std::string& filePath, size_t numPoints, size_t numCells, int cellType, int nodesPerCell, const std::vector<DataArrayInfo>& cellArrays);
+
+  /**
+   * @brief Starts the next appended block. The previous block must have been written completely.
+   * @return Negative value on error
+   */
+  int beginBlock();
+
+  /**
+   * @brief Appends bytes to the current block
+   * @param data
+   * @param numBytes
+   * @return Negative value on error or if the block would overflow
+   */
+  int writeData(const void* data, size_t numBytes);
+
+  /**
+   * @brief Writes the closing XML and closes the file. Every block must have been written completely.
+   * @return Negative value on error
+   */
+  int closeFile();
+
+  /**
+   * @brief Returns the VTK cell type passed to openFile()
+   * @return
+   */
+  int getCellType() const;
+
+private:
+  std::ofstream m_Out;
+  std::vector<uint64_t> m_BlockSizes;
+  size_t m_CurrentBlock = 0;
+  uint64_t m_Remaining = 0;
+  int m_CellType = 0;
+  bool m_InBlock = false;
+
+public:
+  VtuStreamWriter(const VtuStreamWriter&) = delete;            // Copy Constructor Not Implemented
+  VtuStreamWriter(VtuStreamWriter&&) = delete;                 // Move Constructor Not Implemented
+  VtuStreamWriter& operator=(const VtuStreamWriter&) = delete; // Copy Assignment Not Implemented
+  VtuStreamWriter& operator=(VtuStreamWriter&&) = delete;      // Move Assignment Not Implemented
+};